@@ -8,6 +8,7 @@
 #include "Engine/Core/AssetDatabase.hpp"
 #include "Engine/Core/ImGuiDrawer.hpp"
 #include "Engine/Core/ImGuiUtility.h"
+#include "Engine/Core/JobSystem.h"
 #include "Engine/Core/Platform.h"
 #include "Engine/Core/ServiceLocator.hpp"
 #include "Engine/Graphics/BuiltinShaders.h"
@@ -22,12 +23,12 @@
 #include "Engine/Math/Matrix.h"
 #include "Engine/Math/Random.hpp"
 #include "Engine/Math/VectorConversion.hpp"
+#include "Engine/Scene/TransformBatch.h"
 
 // Vendor Includes.
 #include <IconFontCppHeaders/IconsFontAwesome6.h>
 
 // std Includes.
-#include <execution>
 #include <fstream>
 
 #define AssetDir "../Common/Asset/Texture/"
@@ -204,24 +205,8 @@ void SandboxApplication::Initialize()
 			random_angles[ i ].inclination_angle = Kakadu::Math::Random::Generate( 0.0_rad, inclination_limit );
 		}
 
-		constexpr i32 thread_work_size = 1000;
-
-		// Ensure CUBE_COUNT is divisible by thread_work_size or adjust accordingly.
-		constexpr i32 thread_group_count = ( CUBE_COUNT + thread_work_size - 1 ) / thread_work_size;
-
-		constexpr std::array< i32, thread_group_count > thread_group_indices = [ thread_group_count ]()
+		Kakadu::ServiceLocator< Kakadu::JobSystem >::Get().ParallelFor( CUBE_COUNT, 1000 /* grain size. */, [ & ]( const std::size_t start_index, const std::size_t end_index )
 		{
-			std::array< i32, thread_group_count > indices;
-			std::iota( indices.begin(), indices.end(), 0 );
-			return indices;
-		}();
-
-		std::for_each( std::execution::par, thread_group_indices.cbegin(), thread_group_indices.cend(), [ & ]( auto&& thread_group_index )
-		{
-			// Calculate the range of indices for this group:
-			const i32 start_index = thread_group_index * thread_work_size;
-			const i32 end_index   = Kakadu::Math::Min( start_index + thread_work_size, CUBE_COUNT );
-
 			for( auto cube_index = start_index; cube_index < end_index; cube_index++ )
 			{
 				const Radians random_xz_angle          = random_angles[ cube_index ].xz_angle;
@@ -246,8 +231,8 @@ void SandboxApplication::Initialize()
 			.SetTranslation( 1.0f, 0.5f, -3.0f );
 	}
 
-	for( auto cube_index = 0; cube_index < CUBE_COUNT; cube_index++ )
-		cube_instance_data_array[ cube_index ] = cube_transform_array[ cube_index ].GetFinalMatrix().Transposed(); // Vertex attribute matrices' major can not be flipped in GLSL.
+	// Vertex attribute matrices' major can not be flipped in GLSL.
+	Kakadu::TransformBatch::Compose( cube_transform_array, cube_instance_data_array, Kakadu::TransformBatch::Layout::Transposed, Kakadu::TransformBatch::Execution::Parallel );
 
 	window_transform_array[ 0 ].SetTranslation( Vector3( -1.5f,	5.0f, -0.48f ) );
 	window_transform_array[ 1 ].SetTranslation( Vector3(  1.5f,	5.0f,  0.51f ) );
@@ -578,7 +563,7 @@ void SandboxApplication::RenderToolsUI()
 
 				if( Kakadu::ImGuiDrawer::Draw( model_info.transform ) )
 				{
-					model_info.model_instance.SetTransformation( model_info.transform.GetFinalMatrix() );
+					model_info.model_instance.SetTransformation( model_info.transform.GetScaling(), model_info.transform.GetRotation(), model_info.transform.GetTranslation() );
 				}
 			}
 			else
@@ -10,6 +10,9 @@
 #define ENGINE_TEXTURE_ROOT_ABSOLUTE	ENGINE_ASSET_ROOT_ABSOLUTE	"/Texture"
 #define ENGINE_FONT_ROOT_ABSOLUTE		ENGINE_ASSET_ROOT_ABSOLUTE	"/Font"
 
+// Derived data; Safe to delete at any time:
+#define ENGINE_SHADER_CACHE_ROOT_ABSOLUTE	ENGINE_ASSET_ROOT_ABSOLUTE	"/Cache/Shader"
+
 // With slashes:
 #define ENGINE_SHADER_PATH_ABSOLUTE( filename_with_extension )	ENGINE_SHADER_ROOT_ABSOLUTE		"/" filename_with_extension
 #define ENGINE_TEXTURE_PATH_ABSOLUTE( filename_with_extension ) ENGINE_TEXTURE_ROOT_ABSOLUTE	"/" filename_with_extension
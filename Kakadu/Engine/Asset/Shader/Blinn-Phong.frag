@@ -21,7 +21,7 @@ in VS_To_FS
 #endif
 
 #ifdef SHADOWS_ENABLED
-    vec4 position_light_directional_clip_space;
+    vec4 position_world_space;
 #endif
 } fs_in;
 
@@ -54,7 +54,7 @@ uniform float uniform_reflectivity;
 
 #ifdef SHADOWS_ENABLED
 #pragma driven
-uniform sampler2D uniform_tex_shadow;
+uniform sampler2DArray uniform_tex_shadow; // One layer per cascade.
 #endif
 
 #ifdef PARALLAX_MAPPING_ENABLED
@@ -69,7 +69,18 @@ uniform uvec2 uniform_parallax_depth_layer_count_min_max;
  * For the soft-shadows case, it returns a value between 0 and 1 (inclusive). */
 float CalculateShadowAmount( float light_dot_normal )
 {
-	vec3 ndc       = fs_in.position_light_directional_clip_space.xyz / fs_in.position_light_directional_clip_space.w;
+	/* Pick the nearest cascade covering the fragment; Fragments beyond the last cascade receive no shadows. */
+	uint cascade_index = 0;
+	while( cascade_index < _INTRINSIC_SHADOW_CASCADE_COUNT &&
+		   fs_in.position_view_space.z > _INTRINSIC_SHADOW_CASCADES[ cascade_index ].far_depth_view_space_texel_depth_2_reserved.x )
+		cascade_index++;
+
+	if( cascade_index == _INTRINSIC_SHADOW_CASCADE_COUNT )
+		return 0.0f;
+
+	vec4 position_light_directional_clip_space = fs_in.position_world_space * _INTRINSIC_SHADOW_CASCADES[ cascade_index ].view_projection_transform;
+
+	vec3 ndc       = position_light_directional_clip_space.xyz / position_light_directional_clip_space.w;
 	vec3 ndc_unorm = ndc * 0.5f + 0.5f;
 
 	/* Since position_light_directional_clip_space values are not actually clipped, there may be values outside the frustum of the light.
@@ -80,10 +91,15 @@ float CalculateShadowAmount( float light_dot_normal )
 		return 0.0f;
 
 	float current_depth = ndc_unorm.z;
+	float layer         = float( cascade_index );
+
+	/* Bias is given in texels, so that it scales with each cascade's texel footprint. */
+	float bias = max( _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.y * ( 1.0f - light_dot_normal ), _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.x ) *
+				 _INTRINSIC_SHADOW_CASCADES[ cascade_index ].far_depth_view_space_texel_depth_2_reserved.y;
 
 #ifdef SOFT_SHADOWS
 	float shadow = 0.0f;
-	vec2 texel_size = 1.0f / textureSize( uniform_tex_shadow, 0 );
+	vec2 texel_size = 1.0f / textureSize( uniform_tex_shadow, 0 ).xy;
 
 	int x_limit = _INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y.x / 2;
 	int y_limit = _INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y.y / 2;
@@ -95,18 +111,14 @@ float CalculateShadowAmount( float light_dot_normal )
 	{
 		for( int y = -y_limit; y <= y_limit; y++ )
 		{
-			float shadow_map_sample_z = texture( uniform_tex_shadow, ndc_unorm.xy + vec2( x, y ) * texel_size ).r;
-
-			float bias = max( _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.y * ( 1.0f - light_dot_normal ), _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.x );  
+			float shadow_map_sample_z = texture( uniform_tex_shadow, vec3( ndc_unorm.xy + vec2( x, y ) * texel_size, layer ) ).r;
 			shadow += ( current_depth - bias ) > shadow_map_sample_z ? 1.0f : 0.0f;
 		}
 	}
 
 	return shadow / sample_count;
 #else
-	float shadow_map_sample_z = texture( uniform_tex_shadow, ndc_unorm.xy ).r;
-
-	float bias = max( _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.y * ( 1.0f - light_dot_normal ), _INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED.x );  
+	float shadow_map_sample_z = texture( uniform_tex_shadow, vec3( ndc_unorm.xy, layer ) ).r;
 	return ( current_depth - bias ) > shadow_map_sample_z ? 1.0f : 0.0f;
 #endif
 }
@@ -193,8 +205,7 @@ vec3 CalculateColorFromSpotLight( const int spot_light_index,
 									 ( cos_cutoff_angle_inner - cos_cutoff_angle_outer ),
 									 0, 1 );
 
-/* Ambient term: */
-	vec3 ambient = diffuse_sample * _INTRINSIC_SPOT_LIGHTS[ spot_light_index ].ambient.rgb;
+/* Ambient term: Not included here, as it is not limited to the cone; See _INTRINSIC_SPOT_LIGHT_AMBIENT_SUM. */
 
 /* Diffuse term: */
 	float diffuse_contribution = max( dot( to_light_view_space, normal_view_space ), 0.0f );
@@ -206,7 +217,7 @@ vec3 CalculateColorFromSpotLight( const int spot_light_index,
 	float specular_contribution = pow( max( dot( halfway_angle_view_space, normal_view_space ), 0.0f ), uniform_blinn_phong_material_data.shininess );
 	vec3 specular               = specular_sample * _INTRINSIC_SPOT_LIGHTS[ spot_light_index ].specular.rgb * specular_contribution;
 
-	return ambient + cut_off_intensity * ( diffuse + specular );
+	return cut_off_intensity * ( diffuse + specular );
 }
 
 #ifdef PARALLAX_MAPPING_ENABLED
@@ -287,15 +298,23 @@ void main()
 
 	vec3 emission = texture( uniform_tex_emission, uvs ).rgb;
 
-	vec3 from_point_light = vec3( 0 );																		
-	for( int i = 0; i < _INTRINSIC_POINT_LIGHT_ACTIVE_COUNT; i++ )
-		from_point_light += CalculateColorFromPointLight( i,
+	/* Only the lights affecting the cluster this fragment is in are evaluated. */
+	uvec2 light_cluster            = _INTRINSIC_LIGHT_CLUSTERS[ LightClusterIndex( fs_in.position_view_space ) ];
+	uint light_index_offset        = light_cluster.x;
+	uint light_cluster_point_count = light_cluster.y & 0xFFFFu;
+	uint light_cluster_spot_count  = light_cluster.y >> 16;
+
+	vec3 from_point_light = vec3( 0 );
+	for( uint i = 0; i < light_cluster_point_count; i++ )
+		from_point_light += CalculateColorFromPointLight( int( _INTRINSIC_LIGHT_INDICES[ light_index_offset + i ] ),
 														  normal_sample_view_space, viewing_direction_view_space,
 														  diffuse_sample, specular_sample );
 
-	vec3 from_spot_light = vec3( 0 );																		
-	for( int i = 0; i < _INTRINSIC_SPOT_LIGHT_ACTIVE_COUNT; i++ )
-		from_spot_light += CalculateColorFromSpotLight( i,
+	light_index_offset += light_cluster_point_count;
+
+	vec3 from_spot_light = diffuse_sample * _INTRINSIC_SPOT_LIGHT_AMBIENT_SUM.rgb;
+	for( uint i = 0; i < light_cluster_spot_count; i++ )
+		from_spot_light += CalculateColorFromSpotLight( int( _INTRINSIC_LIGHT_INDICES[ light_index_offset + i ] ),
 														normal_sample_view_space, viewing_direction_view_space,
 														diffuse_sample, specular_sample );
 
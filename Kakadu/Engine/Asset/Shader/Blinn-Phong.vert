@@ -30,12 +30,12 @@ out VS_To_FS
 #endif
 
 #ifdef SHADOWS_ENABLED
-    vec4 position_light_directional_clip_space;
+    vec4 position_world_space; // The shadow cascade (& thus the light's transform) is selected per-fragment.
 #endif
 } vs_out;
 
 #ifndef INSTANCING_ENABLED
-uniform mat4x4 uniform_transform_world;
+#include "_Intrinsic_DrawTransforms.glsl"
 #endif
 
 uniform vec4 uniform_texture_scale_and_offset;
@@ -45,16 +45,16 @@ void main()
 #ifdef INSTANCING_ENABLED
     mat4x4 world_view_transform = world_transform * _INTRINSIC_TRANSFORM_VIEW;
 #else
-    mat4x4 world_view_transform = uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW;
+    mat4x4 world_view_transform = _INTRINSIC_TRANSFORM_WORLD * _INTRINSIC_TRANSFORM_VIEW;
 #endif
 
     mat3x3 world_view_transform_for_normals = mat3x3( transpose( inverse( world_view_transform ) ) );
 
 #ifdef SHADOWS_ENABLED
     #ifdef INSTANCING_ENABLED
-        vs_out.position_light_directional_clip_space = vec4( position, 1.0 ) * world_transform * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
+        vs_out.position_world_space = vec4( position, 1.0 ) * world_transform;
     #else
-        vs_out.position_light_directional_clip_space = vec4( position, 1.0 ) * uniform_transform_world * _INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
+        vs_out.position_world_space = vec4( position, 1.0 ) * _INTRINSIC_TRANSFORM_WORLD;
     #endif
 #endif
 
@@ -13,7 +13,7 @@ INSTANCE_WORLD_TRANSFORM mat4 world_transform;
 #endif
 
 #ifndef INSTANCING_ENABLED
-uniform mat4x4 uniform_transform_world;
+#include "_Intrinsic_DrawTransforms.glsl"
 #endif
 
 void main()
@@ -21,6 +21,6 @@ void main()
 #ifdef INSTANCING_ENABLED
     gl_Position = vec4( position, 1.0f ) * world_transform * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
 #else
-    gl_Position = vec4( position, 1.0f ) * uniform_transform_world * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
+    gl_Position = vec4( position, 1.0f ) * _INTRINSIC_TRANSFORM_WORLD * _INTRINSIC_TRANSFORM_VIEW_PROJECTION;
 #endif
 }
\ No newline at end of file
@@ -0,0 +1,14 @@
+#ifndef _INTRINSIC_DRAW_TRANSFORMS_GLSL
+#define _INTRINSIC_DRAW_TRANSFORMS_GLSL
+
+/* World transforms of all non-instanced draws of the current frame, written by the Renderer into a persistently mapped ring buffer.
+ * The Renderer passes the index of the draw's (first) transform as the base instance of the draw call.
+ * Renderables sharing a Mesh & Material are merged into a single instanced draw call, with their transforms in consecutive slots. */
+layout ( row_major, std430, binding = 0 ) readonly buffer _Intrinsic_DrawTransforms
+{
+    mat4x4 _INTRINSIC_DRAW_TRANSFORMS_WORLD[];
+};
+
+#define _INTRINSIC_TRANSFORM_WORLD _INTRINSIC_DRAW_TRANSFORMS_WORLD[ gl_BaseInstance + gl_InstanceID ]
+
+#endif // _INTRINSIC_DRAW_TRANSFORMS_GLSL
@@ -1,8 +1,16 @@
 #ifndef _INTRINSIC_LIGHTING_GLSL
 #define _INTRINSIC_LIGHTING_GLSL
 
-#define POINT_LIGHT_MAX_COUNT 15
-#define SPOT_LIGHT_MAX_COUNT 15
+#include "_Intrinsic_Other.glsl"
+
+/* These have to match the constants in LightClusterGrid.h. */
+#define LIGHT_CLUSTER_TILE_COUNT_X 16
+#define LIGHT_CLUSTER_TILE_COUNT_Y 9
+#define LIGHT_CLUSTER_SLICE_COUNT  24
+#define LIGHT_CLUSTER_COUNT ( LIGHT_CLUSTER_TILE_COUNT_X * LIGHT_CLUSTER_TILE_COUNT_Y * LIGHT_CLUSTER_SLICE_COUNT )
+
+/* Has to match CascadedShadowMapSettings::CASCADE_MAX_COUNT. */
+#define SHADOW_CASCADE_MAX_COUNT 4
 
 struct DirectionalLightData
 {
@@ -22,12 +30,19 @@ struct SpotLightData
 	vec4 position_view_space_and_cos_cutoff_angle_inner, direction_view_space_and_cos_cutoff_angle_outer;
 };
 
+struct ShadowCascadeData
+{
+	mat4x4 view_projection_transform; // World space to the cascade's clip space.
+	vec4 far_depth_view_space_texel_depth_2_reserved; // x = camera's view-space depth where the cascade ends, y = size of a shadow-map texel in the cascade's [0, 1] depth range.
+};
+
 layout ( row_major, std140 ) uniform _Intrinsic_Lighting
 {
 /* Shadow-mapping: */
-	mat4x4					_INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM;
-	vec4					_INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED;
+	ShadowCascadeData		_INTRINSIC_SHADOW_CASCADES[ SHADOW_CASCADE_MAX_COUNT ]; // Ordered from the nearest to the farthest.
+	vec4					_INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED; // In shadow-map texels.
 	ivec2					_INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y;
+	uint					_INTRINSIC_SHADOW_CASCADE_COUNT;
 
 /* Lighting: */
 	uint					_INTRINSIC_DIRECTIONAL_LIGHT_IS_ACTIVE;
@@ -37,8 +52,48 @@ layout ( row_major, std140 ) uniform _Intrinsic_Lighting
 uvec3 padding;
 
 	DirectionalLightData	_INTRINSIC_DIRECTIONAL_LIGHT;
-	PointLightData			_INTRINSIC_POINT_LIGHTS[ POINT_LIGHT_MAX_COUNT ];
-	SpotLightData			_INTRINSIC_SPOT_LIGHTS[ SPOT_LIGHT_MAX_COUNT ];
+
+	/* Spot lights' ambient terms are neither attenuated nor limited to their cones, so they are summed on the cpu & applied to every fragment instead. */
+	vec4					_INTRINSIC_SPOT_LIGHT_AMBIENT_SUM;
+
+/* Light clusters: */
+	vec4					_INTRINSIC_LIGHT_CLUSTER_DEPTH_SCALE_BIAS_IS_LOGARITHMIC_RESERVED;
+};
+
+/* Point & spot lights, as well as the per-cluster light lists are written by the Renderer into a persistently mapped ring buffer each frame (see LightClusterBuffer).
+ * The view volume is split into a grid of clusters (screen-space tiles x depth slices). Each cluster refers to a range of _INTRINSIC_LIGHT_INDICES:
+ * Indices of the point lights affecting the cluster, followed by the indices of the spot lights affecting it. */
+
+layout ( std430, binding = 1 ) readonly buffer _Intrinsic_PointLights
+{
+	PointLightData _INTRINSIC_POINT_LIGHTS[];
 };
 
+layout ( std430, binding = 2 ) readonly buffer _Intrinsic_SpotLights
+{
+	SpotLightData _INTRINSIC_SPOT_LIGHTS[];
+};
+
+layout ( std430, binding = 3 ) readonly buffer _Intrinsic_LightClusters
+{
+	uvec2 _INTRINSIC_LIGHT_CLUSTERS[ LIGHT_CLUSTER_COUNT ]; // x = offset into _INTRINSIC_LIGHT_INDICES, y = point light count (lower 16 bits) & spot light count (upper 16 bits).
+	uint  _INTRINSIC_LIGHT_INDICES[];
+};
+
+uint LightClusterIndex( vec4 position_view_space )
+{
+	vec4 position_clip_space = position_view_space * _INTRINSIC_TRANSFORM_PROJECTION;
+	vec2 tile_coordinates    = ( position_clip_space.xy / position_clip_space.w * 0.5f + 0.5f ) * vec2( LIGHT_CLUSTER_TILE_COUNT_X, LIGHT_CLUSTER_TILE_COUNT_Y );
+	uvec2 tile               = uvec2( clamp( tile_coordinates, vec2( 0.0f ), vec2( LIGHT_CLUSTER_TILE_COUNT_X - 1, LIGHT_CLUSTER_TILE_COUNT_Y - 1 ) ) );
+
+	/* Slices are distributed exponentially for perspective projections & linearly for orthographic ones. */
+	float depth = _INTRINSIC_LIGHT_CLUSTER_DEPTH_SCALE_BIAS_IS_LOGARITHMIC_RESERVED.z != 0.0f
+					? log2( max( position_view_space.z, 1e-4f ) )
+					: position_view_space.z;
+	uint slice  = uint( clamp( floor( depth * _INTRINSIC_LIGHT_CLUSTER_DEPTH_SCALE_BIAS_IS_LOGARITHMIC_RESERVED.x + _INTRINSIC_LIGHT_CLUSTER_DEPTH_SCALE_BIAS_IS_LOGARITHMIC_RESERVED.y ),
+							   0.0f, float( LIGHT_CLUSTER_SLICE_COUNT - 1 ) ) );
+
+	return tile.x + tile.y * LIGHT_CLUSTER_TILE_COUNT_X + slice * LIGHT_CLUSTER_TILE_COUNT_X * LIGHT_CLUSTER_TILE_COUNT_Y;
+}
+
 #endif // _INTRINSIC_LIGHTING_GLSL
\ No newline at end of file
@@ -196,9 +196,11 @@ namespace Kakadu
 
 	void Application::Initialize()
 	{
+		ServiceLocator< JobSystem >::Register( &job_system );
 		ServiceLocator< AssetDatabase< RHI::Texture > >::Register( &asset_database_texture );
 		ServiceLocator< AssetDatabase_Tracked< RHI::Texture* > >::Register( &asset_database_texture_tracked );
 		ServiceLocator< AssetDatabase< Model > >::Register( &asset_database_model );
+		ServiceLocator< GeometryPool >::Register( &geometry_pool );
 		ServiceLocator< MorphSystem >::Register( &morph_system );
 
 		Platform::InitializeAndCreateWindows( vsync_is_enabled );
@@ -243,7 +245,18 @@ namespace Kakadu
 		ProcessEditorCommands();
 #endif // _EDITOR
 
+		{
+			ZoneScopedN( "JobSystem::ExecuteMainThreadJobs" );
+			job_system.ExecuteMainThreadJobs();
+		}
+
 		morph_system.Execute( frame_time.time_delta, frame_time.time_delta_real );
+
+		{
+			ZoneScopedN( "Texture::ProcessAsyncUploads" );
+			RHI::Texture::ProcessAsyncUploads( 2.0f /* milliseconds. */ );
+		}
+
 		renderer->Update();
 
 		if( callbacks.on_update )
@@ -252,6 +265,8 @@ namespace Kakadu
 
 	void Application::Shutdown()
 	{
+		RHI::Texture::ShutdownAsyncLoading();
+
 		ImGuiSetup::Shutdown();
 
 		Platform::Shutdown();
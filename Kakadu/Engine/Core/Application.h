@@ -4,6 +4,7 @@
 #include "AssetDatabase.hpp"
 #include "AssetDatabase_Tracked.hpp"
 #include "BitFlags.hpp"
+#include "JobSystem.h"
 #include "MorphSystem.h"
 #include "Platform.h"
 #include "FrameTime.h"
@@ -79,11 +80,16 @@ namespace Kakadu
 #endif // _EDITOR
 
 	protected:
+		/* Declared first, so that it outlives everything that may schedule jobs. */
+		JobSystem job_system;
 
 #ifdef _EDITOR
 		std::unique_ptr< Editor::Context > editor_context;
 #endif // _EDITOR
 
+		/* Declared before the Model database, as pooled Meshes release their geometry back to it on destruction. */
+		GeometryPool geometry_pool;
+
 		AssetDatabase< RHI::Texture > asset_database_texture;
 		AssetDatabase_Tracked< RHI::Texture* > asset_database_texture_tracked;
 		AssetDatabase< Model > asset_database_model;
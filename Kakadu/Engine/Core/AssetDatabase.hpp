@@ -111,6 +111,58 @@ namespace Kakadu
 				return Load( name );
 		}
 
+		/* Returns a placeholder asset right away, which is filled in once the file is decoded in the background (see AssetType::IsLoading()).
+		 * The returned pointer stays valid & is the handle to the asset, before & after loading completes.
+		 * Overwrite/rename is prohibited; returns nullptr on failure. */
+		AssetType* CreateAssetFromFile_Async( const std::string& name,
+											  const std::string& file_path,
+											  const typename AssetType::ImportSettings& import_settings = AssetType::DEFAULT_IMPORT_SETTINGS )
+		{
+			if( asset_map.contains( name ) )
+				return nullptr;
+
+			if( reverse_asset_path_map.contains( file_path ) )
+				return nullptr;
+
+			auto [ it, inserted_for_sure ] = asset_map.emplace( name, AssetType::Loader::Placeholder( name, import_settings ) );
+
+			asset_path_map[ name ] = file_path;
+			reverse_asset_path_map[ file_path ] = name;
+
+			AssetType::Loader::FromFile_Async( it->second, file_path, import_settings );
+			return &( it->second );
+		}
+
+		/* Asynchronous version of CreateAssetFromFileBytes(); See CreateAssetFromFile_Async().
+		 * The 'data' is copied, so it does not need to outlive this call.
+		 * Overwrite/rename is prohibited; returns nullptr on failure. */
+		AssetType* CreateAssetFromFileBytes_Async( const std::string& name,
+												   const std::byte* data,
+												   const i32 length,
+												   const typename AssetType::ImportSettings& import_settings = AssetType::DEFAULT_IMPORT_SETTINGS )
+		{
+			auto Load = [ & ]( const std::string& asset_name ) -> AssetType*
+			{
+				if( asset_map.contains( asset_name ) )
+					return nullptr;
+
+				auto [ it, inserted_for_sure ] = asset_map.emplace( asset_name, AssetType::Loader::Placeholder( asset_name, import_settings ) );
+
+				const std::string pseudo_path = "<not-on-disk>:" + asset_name;
+
+				asset_path_map.emplace( asset_name, pseudo_path );
+				reverse_asset_path_map.emplace( pseudo_path, asset_name );
+
+				AssetType::Loader::FromFileBytes_Async( it->second, data, length, import_settings );
+				return &( it->second );
+			};
+
+			if( name.empty() )
+				return Load( "<unnamed>_" + std::to_string( ( i32 )unique_name_counter++ ) );
+			else
+				return Load( name );
+		}
+
 		/* The 'data' argument here is already decoded and ready to be consumed directly. */
 		AssetType* CreateAssetFromRawBytes( const std::string& name,
 											const std::byte* data,
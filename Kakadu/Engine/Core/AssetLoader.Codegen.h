@@ -40,3 +40,32 @@ private:\
 		return instance;\
 	}\
 };
+
+/* Same as ASSET_LOADER_CLASS_DECLARATION, plus asynchronous loading:
+ * The AssetDatabase inserts a ready-to-use placeholder asset immediately & the Loader fills it in later, once the source is decoded on a worker thread.
+ * The GL side of the work is done on the main thread, inside ProcessAsyncUploads(). */
+#define ASSET_LOADER_CLASS_DECLARATION_WITH_ASYNC( class_name ) \
+class Loader\
+{\
+public:\
+	Loader( const Loader& ) = delete;\
+	Loader& operator =( const Loader& ) = delete;\
+	static std::optional< class_name > FromFile( const std::string_view name, const std::string& file_path, const ImportSettings& import_settings );\
+	static std::optional< class_name > FromFile( const std::string_view name, const std::initializer_list< std::string > file_paths, const ImportSettings& import_settings );\
+	static std::optional< class_name > FromFileBytes( const std::string_view name, const std::byte* data, const i32 length, const ImportSettings& import_settings );\
+	static std::optional< class_name > FromRawBytes( const std::string_view name, const std::byte* data, const SizeType size, const ImportSettings& import_settings );\
+	static class_name Placeholder( const std::string_view name, const ImportSettings& import_settings );\
+	static void FromFile_Async( class_name& placeholder, const std::string& file_path, const ImportSettings& import_settings );\
+	static void FromFileBytes_Async( class_name& placeholder, const std::byte* data, const i32 length, const ImportSettings& import_settings );\
+	static void CancelAsync( const class_name& asset );\
+	static void ProcessAsyncUploads( const float time_budget_in_milliseconds );\
+	static void ShutdownAsync();\
+private:\
+	Loader()\
+	{}\
+	static Loader& Instance()\
+	{\
+		local_persist Loader instance;\
+		return instance;\
+	}\
+};
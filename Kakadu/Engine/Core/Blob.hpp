@@ -5,6 +5,7 @@
 
 // std Includes.
 #include <cstddef> // std::byte.
+#include <span>
 #include <vector>
 
 namespace Kakadu
@@ -47,6 +48,10 @@ namespace Kakadu
 
 		std::size_t CurrentSize() const { return bytes.size(); }
 
+		std::span< const std::byte > Bytes() const { return bytes; }
+
+		bool operator==( const Blob& other ) const { return bytes == other.bytes; }
+
 	/* Allocation/Deallocation: */
 		void Allocate( const std::size_t size, const std::byte value = std::byte{ 0 } );
 		void Deallocate( const std::size_t size );
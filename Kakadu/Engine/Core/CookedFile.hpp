@@ -0,0 +1,149 @@
+#pragma once
+
+// Engine Includes.
+#include "Hash.h"
+#include "Macros.h"
+#include "Types.h"
+
+// std Includes.
+#include <cstddef> // std::byte.
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/* Helpers for the binary caches derived from source assets (cooked Models, program binaries etc.). */
+
+namespace Kakadu
+{
+	class CookedFileWriter
+	{
+	public:
+		template< typename Type >
+		void Write( const Type& value )
+		{
+			static_assert( std::is_trivially_copyable_v< Type > );
+
+			const auto* value_bytes = reinterpret_cast< const std::byte* >( &value );
+			bytes.insert( bytes.end(), value_bytes, value_bytes + sizeof( Type ) );
+		}
+
+		void WriteString( const std::string_view string )
+		{
+			Write( ( u32 )string.size() );
+			const auto* string_bytes = reinterpret_cast< const std::byte* >( string.data() );
+			bytes.insert( bytes.end(), string_bytes, string_bytes + string.size() );
+		}
+
+		template< typename Type >
+		void WriteArray( const std::span< const Type > array )
+		{
+			static_assert( std::is_trivially_copyable_v< Type > );
+
+			Write( ( u32 )array.size() );
+			bytes.resize( ( bytes.size() + alignof( Type ) - 1 ) / alignof( Type ) * alignof( Type ) );
+			const auto array_bytes = std::as_bytes( array );
+			bytes.insert( bytes.end(), array_bytes.begin(), array_bytes.end() );
+		}
+
+		/* Writes to a temporary file first, so that a half-written cooked file can never be picked up. */
+		bool SaveToFile( const std::filesystem::path& file_path ) const
+		{
+			std::filesystem::path temporary_file_path( file_path );
+			temporary_file_path += ".tmp";
+
+			{
+				std::ofstream file( temporary_file_path, std::ios::binary | std::ios::trunc );
+				if( not file )
+					return false;
+
+				file.write( reinterpret_cast< const char* >( bytes.data() ), ( std::streamsize )bytes.size() );
+				if( not file )
+					return false;
+			}
+
+			std::error_code error_code;
+			std::filesystem::rename( temporary_file_path, file_path, error_code );
+			return not error_code;
+		}
+
+	private:
+		std::vector< std::byte > bytes;
+	};
+
+	/* Reads from a memory-mapped cooked file; Strings & arrays are views into the mapping. Reading past the end sets the failed state instead of crashing. */
+	class CookedFileReader
+	{
+	public:
+		CookedFileReader( const std::span< const std::byte > bytes )
+			:
+			bytes( bytes ),
+			cursor( 0 ),
+			failed( false )
+		{}
+
+		template< typename Type >
+		Type Read()
+		{
+			static_assert( std::is_trivially_copyable_v< Type > );
+
+			Type value{};
+			if( not Reserve( sizeof( Type ) ) )
+				return value;
+
+			std::memcpy( &value, bytes.data() + cursor, sizeof( Type ) );
+			cursor += sizeof( Type );
+			return value;
+		}
+
+		std::string_view ReadString()
+		{
+			const u32 length = Read< u32 >();
+			if( not Reserve( length ) )
+				return {};
+
+			const std::string_view string( reinterpret_cast< const char* >( bytes.data() + cursor ), length );
+			cursor += length;
+			return string;
+		}
+
+		template< typename Type >
+		std::span< const Type > ReadArray()
+		{
+			const u32 count = Read< u32 >();
+			cursor = ( cursor + alignof( Type ) - 1 ) / alignof( Type ) * alignof( Type );
+			if( not Reserve( ( std::size_t )count * sizeof( Type ) ) )
+				return {};
+
+			const std::span< const Type > array( reinterpret_cast< const Type* >( bytes.data() + cursor ), count );
+			cursor += ( std::size_t )count * sizeof( Type );
+			return array;
+		}
+
+		bool Failed() const { return failed; }
+
+	private:
+		bool Reserve( const std::size_t size )
+		{
+			failed |= cursor > bytes.size() || size > bytes.size() - cursor;
+			return not failed;
+		}
+
+	private:
+		std::span< const std::byte > bytes;
+		std::size_t cursor;
+		bool failed;
+		/* 7 bytes of padding. */
+	};
+
+	constexpr u64 HASH_BYTES_INITIAL_VALUE = Hash::FNV1A_OFFSET_BASIS;
+
+	/* FNV-1a; Pass the result of a previous call as the initial value to hash multiple spans as if they were contiguous. */
+	header_function u64 HashBytes( const std::span< const std::byte > bytes, const u64 initial_value = HASH_BYTES_INITIAL_VALUE )
+	{
+		return Hash::FNV1a( bytes, initial_value );
+	}
+}
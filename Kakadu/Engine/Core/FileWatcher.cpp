@@ -0,0 +1,270 @@
+#ifdef _WIN32
+// Windows Includes.
+#define WIN32_LEAN_AND_MEAN // Exclude rarely-used stuff from Windows headers
+#include <Windows.h>
+#else
+// POSIX Includes.
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Engine Includes.
+#include "FileWatcher.h"
+#include "Log.h"
+
+// std Includes.
+#include <algorithm>
+#include <cerrno>
+#include <cstddef> // std::byte.
+
+namespace Kakadu
+{
+	struct FileWatcher::WatchedDirectory
+	{
+		std::filesystem::path path;
+#ifdef _WIN32
+		HANDLE handle;
+		OVERLAPPED overlapped;
+		alignas( DWORD ) std::byte notification_buffer[ 16 * 1024 ];
+
+		bool IssueRead()
+		{
+			overlapped = {};
+			return ReadDirectoryChangesW( handle, notification_buffer, sizeof( notification_buffer ), /* subtree: */ FALSE,
+										  FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME, nullptr, &overlapped, nullptr );
+		}
+#else
+		int watch_descriptor;
+#endif // _WIN32
+	};
+
+	FileWatcher::FileWatcher()
+		:
+#ifdef _WIN32
+		completion_port( CreateIoCompletionPort( INVALID_HANDLE_VALUE, nullptr, 0, 1 ) )
+#else
+		inotify_descriptor( inotify_init1( IN_CLOEXEC | IN_NONBLOCK ) ),
+		wake_up_descriptor( eventfd( 0, EFD_CLOEXEC ) )
+#endif // _WIN32
+	{
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		if( thread.joinable() )
+		{
+#ifdef _WIN32
+			PostQueuedCompletionStatus( completion_port, 0, /* completion key; 0 means stop: */ 0, nullptr );
+#else
+			const u64 value = 1;
+			write( wake_up_descriptor, &value, sizeof( value ) );
+#endif // _WIN32
+
+			thread.join();
+		}
+
+#ifdef _WIN32
+		for( auto& directory : watched_directories )
+		{
+			/* The notification buffer must outlive the cancelled read. */
+			DWORD byte_count_dont_care;
+			CancelIoEx( directory->handle, &directory->overlapped );
+			GetOverlappedResult( directory->handle, &directory->overlapped, &byte_count_dont_care, TRUE );
+			CloseHandle( directory->handle );
+		}
+
+		if( completion_port )
+			CloseHandle( completion_port );
+#else
+		/* Closing the inotify instance removes all its watches. */
+		if( inotify_descriptor >= 0 )
+			close( inotify_descriptor );
+		if( wake_up_descriptor >= 0 )
+			close( wake_up_descriptor );
+#endif // _WIN32
+	}
+
+	void FileWatcher::Watch( const std::filesystem::path& file_path )
+	{
+		const auto normalized_path = NormalizedPath( file_path );
+
+		std::scoped_lock lock( mutex );
+
+		if( not watched_file_paths.insert( normalized_path ).second )
+			return;
+
+		const std::filesystem::path directory_path( std::filesystem::path( normalized_path ).parent_path() );
+
+		if( std::find_if( watched_directories.begin(), watched_directories.end(),
+						  [ & ]( const auto& directory ) { return directory->path == directory_path; } ) == watched_directories.end() )
+			WatchDirectory( directory_path );
+
+		if( not thread.joinable() && not watched_directories.empty() )
+			thread = std::thread( &FileWatcher::ThreadLoop, this );
+	}
+
+	std::vector< std::string > FileWatcher::ConsumeModifiedFiles()
+	{
+		std::scoped_lock lock( mutex );
+
+		std::vector< std::string > modified_files( modified_file_paths.begin(), modified_file_paths.end() );
+		modified_file_paths.clear();
+
+		return modified_files;
+	}
+
+	std::string FileWatcher::NormalizedPath( const std::filesystem::path& file_path )
+	{
+		std::error_code error_code;
+		const auto absolute_path = std::filesystem::absolute( file_path, error_code );
+
+		return ( error_code ? file_path : absolute_path ).lexically_normal().generic_string();
+	}
+
+	/* Expects the mutex to be locked. */
+	void FileWatcher::WatchDirectory( const std::filesystem::path& directory_path )
+	{
+		auto directory = std::make_unique< WatchedDirectory >();
+		directory->path = directory_path;
+
+#ifdef _WIN32
+		directory->handle = CreateFileW( directory_path.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+										 OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr );
+		if( directory->handle == INVALID_HANDLE_VALUE )
+		{
+			Log::Warning( "FileWatcher: Could not open directory \"" + directory_path.generic_string() + "\" for watching." );
+			return;
+		}
+
+		/* The completion key identifies the directory in the thread loop. */
+		if( not CreateIoCompletionPort( directory->handle, completion_port, reinterpret_cast< ULONG_PTR >( directory.get() ), 0 ) ||
+			not directory->IssueRead() )
+		{
+			Log::Warning( "FileWatcher: Could not watch directory \"" + directory_path.generic_string() + "\"." );
+			CloseHandle( directory->handle );
+			return;
+		}
+#else
+		/* Editors commonly save by writing a temporary file & renaming it over the original, hence IN_MOVED_TO. */
+		directory->watch_descriptor = inotify_add_watch( inotify_descriptor, directory_path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO );
+		if( directory->watch_descriptor < 0 )
+		{
+			Log::Warning( "FileWatcher: Could not watch directory \"" + directory_path.generic_string() + "\"." );
+			return;
+		}
+
+		watched_directory_per_watch_descriptor[ directory->watch_descriptor ] = directory.get();
+#endif // _WIN32
+
+		watched_directories.push_back( std::move( directory ) );
+	}
+
+	void FileWatcher::ThreadLoop()
+	{
+#ifdef _WIN32
+		while( true )
+		{
+			DWORD byte_count;
+			ULONG_PTR completion_key;
+			OVERLAPPED* overlapped;
+
+			const bool succeeded = GetQueuedCompletionStatus( completion_port, &byte_count, &completion_key, &overlapped, INFINITE );
+
+			/* Either a stop request or a failure of the completion port itself (in which case no packet was dequeued). */
+			if( completion_key == 0 || ( not succeeded && not overlapped ) )
+				break;
+
+			auto& directory = *reinterpret_cast< WatchedDirectory* >( completion_key );
+
+			if( succeeded && byte_count != 0 )
+			{
+				for( std::size_t offset = 0; ; )
+				{
+					const auto& notification = *reinterpret_cast< const FILE_NOTIFY_INFORMATION* >( directory.notification_buffer + offset );
+
+					OnFileModified( directory.path, std::wstring( notification.FileName, notification.FileNameLength / sizeof( WCHAR ) ) );
+
+					if( notification.NextEntryOffset == 0 )
+						break;
+
+					offset += notification.NextEntryOffset;
+				}
+			}
+			else if( succeeded )
+			{
+				/* The notification buffer overflowed; Consider every watched file in this directory modified. */
+				std::scoped_lock lock( mutex );
+
+				for( const auto& watched_file_path : watched_file_paths )
+					if( std::filesystem::path( watched_file_path ).parent_path() == directory.path )
+						modified_file_paths.insert( watched_file_path );
+			}
+
+			directory.IssueRead();
+		}
+#else
+		alignas( inotify_event ) char event_buffer[ 16 * 1024 ];
+
+		pollfd poll_descriptors[ 2 ] =
+		{
+			{ .fd = inotify_descriptor, .events = POLLIN, .revents = 0 },
+			{ .fd = wake_up_descriptor, .events = POLLIN, .revents = 0 }
+		};
+
+		while( true )
+		{
+			if( poll( poll_descriptors, 2, -1 ) < 0 )
+			{
+				if( errno == EINTR )
+					continue;
+
+				break;
+			}
+
+			if( poll_descriptors[ 1 ].revents & POLLIN )
+				break;
+
+			if( not ( poll_descriptors[ 0 ].revents & POLLIN ) )
+				continue;
+
+			for( ssize_t byte_count = read( inotify_descriptor, event_buffer, sizeof( event_buffer ) );
+				 byte_count > 0;
+				 byte_count = read( inotify_descriptor, event_buffer, sizeof( event_buffer ) ) )
+			{
+				for( char* event_pointer = event_buffer; event_pointer < event_buffer + byte_count; )
+				{
+					const auto& event = *reinterpret_cast< const inotify_event* >( event_pointer );
+
+					if( event.len != 0 )
+					{
+						std::filesystem::path directory_path;
+						{
+							std::scoped_lock lock( mutex );
+							if( auto iterator = watched_directory_per_watch_descriptor.find( event.wd );
+								iterator != watched_directory_per_watch_descriptor.end() )
+								directory_path = iterator->second->path;
+						}
+
+						if( not directory_path.empty() )
+							OnFileModified( directory_path, event.name );
+					}
+
+					event_pointer += sizeof( inotify_event ) + event.len;
+				}
+			}
+		}
+#endif // _WIN32
+	}
+
+	void FileWatcher::OnFileModified( const std::filesystem::path& directory_path, const std::filesystem::path& file_name )
+	{
+		auto file_path = ( directory_path / file_name ).lexically_normal().generic_string();
+
+		std::scoped_lock lock( mutex );
+
+		if( watched_file_paths.contains( file_path ) )
+			modified_file_paths.insert( std::move( file_path ) );
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+// Engine Includes.
+#include "Macros.h"
+#include "Types.h"
+
+// std Includes.
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Kakadu
+{
+	/* Reports modifications of individual files, driven by OS notifications (ReadDirectoryChangesW() on Windows, inotify on Linux) instead of polling.
+	 * The directories containing watched files are watched (non-recursively) by a background thread, which is started on the first Watch() call.
+	 * Querying changes does not make any system calls. */
+	class FileWatcher
+	{
+	public:
+		FileWatcher();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( FileWatcher );
+
+		~FileWatcher();
+
+	/* Usage: */
+
+		void Watch( const std::filesystem::path& file_path );
+
+		/* Returns the (normalized, see NormalizedPath()) paths of watched files modified since the last call & forgets about them. */
+		std::vector< std::string > ConsumeModifiedFiles();
+
+	/* Queries: */
+
+		/* Absolute, lexically normal & with generic separators; Use to compare against the paths returned by ConsumeModifiedFiles(). */
+		static std::string NormalizedPath( const std::filesystem::path& file_path );
+
+	private:
+		struct WatchedDirectory;
+
+	private:
+		void WatchDirectory( const std::filesystem::path& directory_path );
+		void ThreadLoop();
+		void OnFileModified( const std::filesystem::path& directory_path, const std::filesystem::path& file_name );
+
+	private:
+		std::mutex mutex;
+
+		std::unordered_set< std::string > watched_file_paths;
+		std::unordered_set< std::string > modified_file_paths;
+
+		std::vector< std::unique_ptr< WatchedDirectory > > watched_directories;
+
+#ifdef _WIN32
+		void* completion_port;
+#else
+		int inotify_descriptor;
+		int wake_up_descriptor; // Signaled to stop the thread.
+		std::unordered_map< int, WatchedDirectory* > watched_directory_per_watch_descriptor;
+#endif // _WIN32
+
+		std::thread thread;
+	};
+}
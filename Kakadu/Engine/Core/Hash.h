@@ -0,0 +1,42 @@
+#pragma once
+
+// Engine Includes.
+#include "Types.h"
+
+// std Includes.
+#include <cstddef> // std::byte.
+#include <span>
+#include <string_view>
+
+namespace Kakadu::Hash
+{
+	/* 64-bit FNV-1a: Cheap & well distributed for short keys; Not suitable against adversarial input.
+	 * Pass the result of a previous call as the initial value to hash multiple inputs as if they were contiguous. */
+
+	constexpr u64 FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+	constexpr u64 FNV1A_PRIME		 = 1099511628211ull;
+
+	constexpr u64 FNV1a( const std::span< const std::byte > bytes, const u64 initial_value = FNV1A_OFFSET_BASIS )
+	{
+		u64 hash = initial_value;
+		for( const auto byte : bytes )
+		{
+			hash ^= ( u64 )byte;
+			hash *= FNV1A_PRIME;
+		}
+
+		return hash;
+	}
+
+	constexpr u64 FNV1a( const std::string_view string, const u64 initial_value = FNV1A_OFFSET_BASIS )
+	{
+		u64 hash = initial_value;
+		for( const char character : string )
+		{
+			hash ^= u64( u8( character ) );
+			hash *= FNV1A_PRIME;
+		}
+
+		return hash;
+	}
+}
@@ -645,6 +645,10 @@ namespace Kakadu::ImGuiDrawer
 						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " 2D Texture (Multisampled) Preview Unavailable" );
 						break;
 
+					case RHI::TextureType::Texture2DArray:
+						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " 2D Texture Array Preview Unavailable" );
+						break;
+
 					case RHI::TextureType::Cubemap:
 						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " Cubemap Texture Preview Unavailable" );
 						break;
@@ -749,6 +753,10 @@ namespace Kakadu::ImGuiDrawer
 						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " 2D Texture (Multisampled) Preview Unavailable" );
 						break;
 
+					case RHI::TextureType::Texture2DArray:
+						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " 2D Texture Array Preview Unavailable" );
+						break;
+
 					case RHI::TextureType::Cubemap:
 						DisplayPreviewUnavailableTextInsteadOfImage( ICON_FA_NOTDEF " Cubemap Texture Preview Unavailable" );
 						break;
@@ -868,9 +876,9 @@ namespace Kakadu::ImGuiDrawer
 				const auto table_flags = ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_SizingStretchProp;
 				if( ImGui::BeginTable( material.Name().c_str(), 2, table_flags ) )
 				{
-					const auto& uniform_info_map        = material.GetUniformInfoMap();
-					const auto& uniform_buffer_info_map = material.GetUniformBufferInfoMap();
-					const auto& texture_map             = material.GetTextureMap();
+					const auto& uniform_info_map          = material.GetUniformInfoMap();
+					const auto& uniform_buffer_record_map = material.GetUniformBufferRecordMap();
+					const auto& texture_map               = material.GetTextureMap();
 
 					ImGui::TableNextRow();
 
@@ -1006,19 +1014,21 @@ namespace Kakadu::ImGuiDrawer
 						ImGui::PopID();
 					}
 
-					for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map )
+					for( const auto& [ uniform_buffer_id, uniform_buffer_record ] : uniform_buffer_record_map )
 					{
+						const auto& uniform_buffer_info = uniform_buffer_record.info;
+
 						ASSERT_DEBUG_ONLY( not uniform_buffer_info.IsGlobalOrIntrinsic() && "Materials can not have Intrinsic/Global uniforms!" );
 
 						ImGui::TableNextColumn();
 
-						if( ImGui::TreeNodeEx( uniform_buffer_name.c_str(), ImGuiTreeNodeFlags_Framed ) )
+						if( ImGui::TreeNodeEx( uniform_buffer_id.Name().c_str(), ImGuiTreeNodeFlags_Framed ) )
 						{
 							ImGui::TableNextRow();
 
-							std::byte* memory_blob = ( std::byte* )material.Get( uniform_buffer_name );
+							std::byte* memory_blob = ( std::byte* )material.Get( uniform_buffer_id );
 
-							for( const auto& [ uniform_buffer_member_struct_name, uniform_buffer_member_struct_info ] : uniform_buffer_info.members_struct_map )
+							for( const auto& [ uniform_buffer_member_struct_id, uniform_buffer_member_struct_info ] : uniform_buffer_info.members_struct_map )
 							{
 								ImGui::TableNextColumn();
 
@@ -1042,7 +1052,7 @@ namespace Kakadu::ImGuiDrawer
 																	effective_offset );
 										/* Draw() call in the above lambda modifies the memory provided but an explicit material.SetPartial_Struct() call is necessary for proper registration of the modification. */
 										if( is_modified )
-											material.SetPartial_Struct( uniform_buffer_name, uniform_buffer_member_struct_name.c_str(), effective_offset );
+											material.SetPartial_Struct( uniform_buffer_id, uniform_buffer_member_struct_id, effective_offset );
 										ImGui::PopID();
 									}
 
@@ -1052,7 +1062,7 @@ namespace Kakadu::ImGuiDrawer
 									ImGui::TableNextRow();
 							}
 
-							for( const auto& [ uniform_buffer_member_array_name, uniform_buffer_member_array_info ] : uniform_buffer_info.members_array_map )
+							for( const auto& [ uniform_buffer_member_array_id, uniform_buffer_member_array_info ] : uniform_buffer_info.members_array_map )
 							{
 								ImGui::TableNextColumn();
 
@@ -1087,7 +1097,7 @@ namespace Kakadu::ImGuiDrawer
 																			effective_offset );
 												/* Draw() call in the above lambda modifies the memory provided but an explicit material.SetPartial_Array() call is necessary for proper registration of the modification. */
 												if( is_modified )
-													material.SetPartial_Array( uniform_buffer_name, uniform_buffer_member_array_name.c_str(), array_index, effective_offset );
+													material.SetPartial_Array( uniform_buffer_id, uniform_buffer_member_array_id, array_index, effective_offset );
 												ImGui::PopID();
 											}
 
@@ -1103,7 +1113,7 @@ namespace Kakadu::ImGuiDrawer
 									ImGui::TableNextRow();
 							}
 
-							for( const auto& [ uniform_buffer_member_name, uniform_buffer_member_info ] : uniform_buffer_info.members_single_map )
+							for( const auto& [ uniform_buffer_member_id, uniform_buffer_member_info ] : uniform_buffer_info.members_single_map )
 							{
 								const bool is_padding = uniform_buffer_member_info->editor_name.compare( 0, 8, "Padding", 8 ) == 0;
 
@@ -1126,7 +1136,7 @@ namespace Kakadu::ImGuiDrawer
 								ImGui::EndDisabled();
 								/* Draw() call in the above lambda modifies the memory provided but an explicit material.SetPartial() call is necessary for proper registration of the modification. */
 								if( is_modified )
-									material.SetPartial( uniform_buffer_name, uniform_buffer_member_name.c_str(), effective_offset );
+									material.SetPartial( uniform_buffer_id, uniform_buffer_member_id, effective_offset );
 								ImGui::PopID();
 							}
 
@@ -342,7 +342,7 @@ namespace Kakadu::ImGuiDrawer
 		requires( std::is_base_of_v< Blob, BlobType > )
 	bool Draw( UniformBufferManagement< BlobType >& buffer_management, const char* name = "##buffer-management", ImGuiWindowFlags window_flags = ImGuiWindowFlags_NoFocusOnAppearing )
 	{
-		if( buffer_management.GetBufferInformationMap().empty() )
+		if( buffer_management.GetBufferRecordMap().empty() )
 			return false;
 
 		bool is_modified = false;
@@ -351,7 +351,7 @@ namespace Kakadu::ImGuiDrawer
 		{
 			if( ImGui::BeginTable( name, 2, ImGuiTableFlags_NoBordersInBody | ImGuiTableFlags_SizingStretchSame | ImGuiTableFlags_PreciseWidths ) )
 			{
-				const auto& uniform_buffer_info_map = buffer_management.GetBufferInformationMap();
+				const auto& uniform_buffer_record_map = buffer_management.GetBufferRecordMap();
 
 				ImGui::TableSetupColumn( "Name"	 );
 				ImGui::TableSetupColumn( "Value" );
@@ -359,18 +359,20 @@ namespace Kakadu::ImGuiDrawer
 				ImGui::TableHeadersRow();
 				ImGui::TableNextRow();
 
-				for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map )
+				for( const auto& [ uniform_buffer_id, uniform_buffer_record ] : uniform_buffer_record_map )
 				{
+					const auto& uniform_buffer_info = uniform_buffer_record.info;
+
 					ImGui::TableNextColumn();
 
-					if( ImGui::TreeNodeEx( uniform_buffer_name.c_str(), ImGuiTreeNodeFlags_Framed ) )
+					if( ImGui::TreeNodeEx( uniform_buffer_id.Name().c_str(), ImGuiTreeNodeFlags_Framed ) )
 					{
 						ImGui::TableNextRow();
 						/* No need to update the Material when the Draw() call below returns true; Memory from the blob is provided directly to Draw(), so the Material is updated. */
 
-						std::byte* memory_blob = ( std::byte* )buffer_management.Get( uniform_buffer_name );
+						std::byte* memory_blob = ( std::byte* )buffer_management.Get( uniform_buffer_id );
 
-						for( const auto& [ uniform_buffer_member_name, uniform_buffer_member_struct_info ] : uniform_buffer_info.members_struct_map )
+						for( const auto& [ uniform_buffer_member_id, uniform_buffer_member_struct_info ] : uniform_buffer_info.members_struct_map )
 						{
 							ImGui::TableNextColumn();
 
@@ -389,7 +391,7 @@ namespace Kakadu::ImGuiDrawer
 									{
 										if( Draw( uniform_buffer_member_info->type, memory_blob + uniform_buffer_member_info->offset ) )
 										{
-											buffer_management.SetPartial_Struct( uniform_buffer_name, uniform_buffer_member_name.c_str(), 
+											buffer_management.SetPartial_Struct( uniform_buffer_id, uniform_buffer_member_id, 
 																				 memory_blob + uniform_buffer_member_info->offset );
 											is_modified = true;
 										}
@@ -405,7 +407,7 @@ namespace Kakadu::ImGuiDrawer
 								ImGui::TableNextRow();
 						}
 
-						for( const auto& [ uniform_buffer_member_name, uniform_buffer_member_array_info ] : uniform_buffer_info.members_array_map )
+						for( const auto& [ uniform_buffer_member_id, uniform_buffer_member_array_info ] : uniform_buffer_info.members_array_map )
 						{
 							ImGui::TableNextColumn();
 
@@ -437,7 +439,7 @@ namespace Kakadu::ImGuiDrawer
 											{
 												if( Draw( uniform_buffer_member_info->type, effective_offset ) )
 												{
-													buffer_management.SetPartial_Array( uniform_buffer_name, uniform_buffer_member_name.c_str(), 
+													buffer_management.SetPartial_Array( uniform_buffer_id, uniform_buffer_member_id, 
 																						array_index, effective_offset );
 													is_modified = true;
 												}
@@ -459,7 +461,7 @@ namespace Kakadu::ImGuiDrawer
 								ImGui::TableNextRow();
 						}
 
-						for( const auto& [ uniform_buffer_member_name, uniform_buffer_member_single_info ] : uniform_buffer_info.members_single_map )
+						for( const auto& [ uniform_buffer_member_id, uniform_buffer_member_single_info ] : uniform_buffer_info.members_single_map )
 						{
 							ImGui::TableNextColumn(); ImGui::TextUnformatted( uniform_buffer_member_single_info->editor_name.c_str() );
 
@@ -470,7 +472,7 @@ namespace Kakadu::ImGuiDrawer
 							{
 								if( Draw( uniform_buffer_member_single_info->type, memory_blob + uniform_buffer_member_single_info->offset ) )
 								{
-									buffer_management.SetPartial( uniform_buffer_name, uniform_buffer_member_name.c_str(), 
+									buffer_management.SetPartial( uniform_buffer_id, uniform_buffer_member_id, 
 																  memory_blob + uniform_buffer_member_single_info->offset );
 									is_modified = true;
 								}
@@ -504,7 +506,7 @@ namespace Kakadu::ImGuiDrawer
 		{
 			if( ImGui::BeginTable( name, 2, ImGuiTableFlags_NoBordersInBody | ImGuiTableFlags_SizingStretchSame | ImGuiTableFlags_PreciseWidths ) )
 			{
-				const auto& uniform_buffer_info_map = buffer_management.GetBufferInformationMap();
+				const auto& uniform_buffer_record_map = buffer_management.GetBufferRecordMap();
 
 				ImGui::TableSetupColumn( "Name"	 );
 				ImGui::TableSetupColumn( "Value" );
@@ -512,16 +514,18 @@ namespace Kakadu::ImGuiDrawer
 				ImGui::TableHeadersRow();
 				ImGui::TableNextRow();
 
-				for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map )
+				for( const auto& [ uniform_buffer_id, uniform_buffer_record ] : uniform_buffer_record_map )
 				{
+					const auto& uniform_buffer_info = uniform_buffer_record.info;
+
 					ImGui::TableNextColumn();
 
-					if( ImGui::TreeNodeEx( uniform_buffer_name.c_str(), ImGuiTreeNodeFlags_Framed ) )
+					if( ImGui::TreeNodeEx( uniform_buffer_id.Name().c_str(), ImGuiTreeNodeFlags_Framed ) )
 					{
 						ImGui::TableNextRow();
 						/* No need to update the Material when the Draw() call below returns true; Memory from the blob is provided directly to Draw(), so the Material is updated. */
 
-						std::byte* memory_blob = ( std::byte* )buffer_management.Get( uniform_buffer_name );
+						std::byte* memory_blob = ( std::byte* )buffer_management.Get( uniform_buffer_id );
 
 						for( const auto& [ dont_care, uniform_buffer_member_struct_info ] : uniform_buffer_info.members_struct_map )
 						{
@@ -0,0 +1,393 @@
+// Engine Includes.
+#include "JobSystem.h"
+#include "Core/Assertion.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+
+namespace Kakadu
+{
+	struct JobSystem::Job
+	{
+		Function function;
+		Counter* counter;
+		bool is_main_thread_only;
+	};
+
+	/* Chase-Lev work-stealing deque with a fixed capacity: The owner thread pushes & pops at the bottom, any other thread steals from the top.
+	 * Source: "Correct and Efficient Work-Stealing for Weak Memory Models", Lê et al. (2013). */
+	struct JobSystem::WorkerQueue
+	{
+		static constexpr i64 CAPACITY = 4096;
+		static constexpr i64 MASK	  = CAPACITY - 1;
+
+		static_assert( ( CAPACITY & MASK ) == 0, "WorkerQueue::CAPACITY must be a power of 2." );
+
+		WorkerQueue()
+			:
+			top( 0 ),
+			bottom( 0 )
+		{
+		}
+
+		/* Owner only. Returns false if the queue is full. */
+		bool Push( Job* job )
+		{
+			const i64 bottom_value = bottom.load( std::memory_order_relaxed );
+			const i64 top_value	   = top.load( std::memory_order_acquire );
+
+			if( bottom_value - top_value >= CAPACITY )
+				return false;
+
+			buffer[ bottom_value & MASK ].store( job, std::memory_order_relaxed );
+			bottom.store( bottom_value + 1, std::memory_order_release ); // Publishes the job to thieves.
+
+			return true;
+		}
+
+		/* Owner only. LIFO, so that the owner keeps working on the most recent (cache-hot) jobs. */
+		Job* Pop()
+		{
+			const i64 bottom_value = bottom.load( std::memory_order_relaxed ) - 1;
+			bottom.store( bottom_value, std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_seq_cst );
+			i64 top_value = top.load( std::memory_order_relaxed );
+
+			if( top_value > bottom_value ) // Empty.
+			{
+				bottom.store( bottom_value + 1, std::memory_order_relaxed );
+				return nullptr;
+			}
+
+			Job* job = buffer[ bottom_value & MASK ].load( std::memory_order_relaxed );
+
+			if( top_value == bottom_value ) // Last job: Race against thieves.
+			{
+				if( not top.compare_exchange_strong( top_value, top_value + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+					job = nullptr;
+
+				bottom.store( bottom_value + 1, std::memory_order_relaxed );
+			}
+
+			return job;
+		}
+
+		/* Any thread. FIFO, so that thieves take the oldest (usually largest) jobs. Returns nullptr if empty or if another thread won the race. */
+		Job* Steal()
+		{
+			i64 top_value = top.load( std::memory_order_acquire );
+			std::atomic_thread_fence( std::memory_order_seq_cst );
+			const i64 bottom_value = bottom.load( std::memory_order_acquire );
+
+			if( top_value >= bottom_value )
+				return nullptr;
+
+			Job* job = buffer[ top_value & MASK ].load( std::memory_order_relaxed );
+
+			if( not top.compare_exchange_strong( top_value, top_value + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+				return nullptr;
+
+			return job;
+		}
+
+		/* Separate cache lines, as top is contended by thieves while bottom is mostly touched by the owner. */
+		alignas( 64 ) std::atomic< i64 > top;
+		alignas( 64 ) std::atomic< i64 > bottom;
+		std::array< std::atomic< Job* >, CAPACITY > buffer;
+	};
+
+	/* Which JobSystem's WorkerQueue (if any) the calling thread owns. */
+	internal_variable thread_local JobSystem* this_thread_job_system  = nullptr;
+	internal_variable thread_local u32		  this_thread_queue_index = 0;
+
+	JobSystem::Counter::Counter()
+		:
+		pending_job_count( 0 )
+	{
+	}
+
+	JobSystem::Counter::~Counter()
+	{
+		ASSERT_DEBUG_ONLY( IsDone() && "JobSystem::Counter destroyed while it still has pending jobs." );
+	}
+
+	JobSystem::JobSystem( const u32 worker_count )
+		:
+		shared_queue_size( 0 ),
+		wake_up_generation( 0 ),
+		is_running( true ),
+		main_thread_id( std::this_thread::get_id() )
+	{
+		worker_queues.reserve( worker_count + 1 );
+		for( u32 queue_index = 0; queue_index <= worker_count; queue_index++ )
+			worker_queues.push_back( std::make_unique< WorkerQueue >() );
+
+		this_thread_job_system  = this;
+		this_thread_queue_index = 0;
+
+		workers.reserve( worker_count );
+		for( u32 worker_index = 0; worker_index < worker_count; worker_index++ )
+			workers.emplace_back( &JobSystem::WorkerThreadLoop, this, worker_index + 1 );
+	}
+
+	JobSystem::~JobSystem()
+	{
+		is_running.store( false, std::memory_order_release );
+		wake_up_generation.fetch_add( 1, std::memory_order_release );
+		wake_up_generation.notify_all();
+
+		for( auto& worker : workers )
+			worker.join();
+
+		for( auto& worker_queue : worker_queues )
+			while( Job* job = worker_queue->Steal() )
+				delete job;
+
+		for( Job* job : shared_queue )
+			delete job;
+		for( Job* job : main_thread_queue )
+			delete job;
+
+		if( this_thread_job_system == this )
+			this_thread_job_system = nullptr;
+	}
+
+	void JobSystem::Run( Function&& function, Counter* counter )
+	{
+		Schedule( CreateJob( std::move( function ), counter, false ) );
+	}
+
+	void JobSystem::RunAfter( Counter& dependency, Function&& function, Counter* counter )
+	{
+		ScheduleAfter( dependency, CreateJob( std::move( function ), counter, false ) );
+	}
+
+	void JobSystem::RunOnMainThread( Function&& function, Counter* counter )
+	{
+		Schedule( CreateJob( std::move( function ), counter, true ) );
+	}
+
+	void JobSystem::RunOnMainThreadAfter( Counter& dependency, Function&& function, Counter* counter )
+	{
+		ScheduleAfter( dependency, CreateJob( std::move( function ), counter, true ) );
+	}
+
+	void JobSystem::ParallelFor( const std::size_t count, const std::size_t grain_size, const RangeFunction& function )
+	{
+		ASSERT_DEBUG_ONLY( grain_size > 0 && "JobSystem::ParallelFor(): Grain size can not be zero." );
+
+		if( count <= grain_size || workers.empty() )
+		{
+			if( count > 0 )
+				function( 0, count );
+
+			return;
+		}
+
+		Counter counter;
+
+		/* Schedule all but the first range, which the calling thread processes right away. */
+		for( std::size_t begin = grain_size; begin < count; begin += grain_size )
+		{
+			const std::size_t end = std::min( begin + grain_size, count );
+			Run( [ &function, begin, end ]() { function( begin, end ); }, &counter );
+		}
+
+		function( 0, grain_size );
+
+		Wait( counter );
+	}
+
+	void JobSystem::Wait( Counter& counter )
+	{
+		const bool is_main_thread = IsMainThread();
+
+		while( not counter.IsDone() )
+		{
+			if( is_main_thread && ExecuteOneMainThreadJob() )
+				continue;
+
+			if( Job* job = FindJob() )
+				Execute( job );
+			else
+				std::this_thread::yield();
+		}
+
+		/* The job completing counter might still be inside the critical section that zeroed it; Make sure it left before the Counter can be destroyed. */
+		std::scoped_lock lock( counter.mutex );
+	}
+
+	void JobSystem::ExecuteMainThreadJobs()
+	{
+		ASSERT_DEBUG_ONLY( IsMainThread() && "JobSystem::ExecuteMainThreadJobs(): Can only be called from the main thread." );
+
+		std::vector< Job* > jobs_to_execute;
+
+		{
+			std::scoped_lock lock( main_thread_queue_mutex );
+			jobs_to_execute.swap( main_thread_queue );
+		}
+
+		/* Jobs scheduled by these jobs are left to the next call, so that a self-rescheduling job can not hang the frame. */
+		for( Job* job : jobs_to_execute )
+			Execute( job );
+	}
+
+	u32 JobSystem::DefaultWorkerCount()
+	{
+		return std::max( std::thread::hardware_concurrency(), 2u ) - 1;
+	}
+
+	JobSystem::Job* JobSystem::CreateJob( Function&& function, Counter* counter, const bool is_main_thread_only )
+	{
+		if( counter )
+			counter->pending_job_count.fetch_add( 1, std::memory_order_relaxed );
+
+		return new Job{ .function = std::move( function ), .counter = counter, .is_main_thread_only = is_main_thread_only };
+	}
+
+	void JobSystem::Schedule( Job* job )
+	{
+		if( job->is_main_thread_only )
+		{
+			std::scoped_lock lock( main_thread_queue_mutex );
+			main_thread_queue.push_back( job );
+			return;
+		}
+
+		if( this_thread_job_system != this || not worker_queues[ this_thread_queue_index ]->Push( job ) )
+		{
+			std::scoped_lock lock( shared_queue_mutex );
+			shared_queue.push_back( job );
+			shared_queue_size.fetch_add( 1, std::memory_order_release );
+		}
+
+		WakeUpWorker();
+	}
+
+	void JobSystem::ScheduleAfter( Counter& dependency, Job* job )
+	{
+		{
+			std::scoped_lock lock( dependency.mutex );
+
+			if( not dependency.IsDone() )
+			{
+				dependency.continuations.push_back( job );
+				return;
+			}
+		}
+
+		Schedule( job );
+	}
+
+	JobSystem::Job* JobSystem::FindJob()
+	{
+		const bool owns_a_queue = this_thread_job_system == this;
+
+		if( owns_a_queue )
+			if( Job* job = worker_queues[ this_thread_queue_index ]->Pop() )
+				return job;
+
+		if( shared_queue_size.load( std::memory_order_acquire ) > 0 )
+		{
+			std::scoped_lock lock( shared_queue_mutex );
+
+			if( not shared_queue.empty() )
+			{
+				Job* job = shared_queue.back();
+				shared_queue.pop_back();
+				shared_queue_size.fetch_sub( 1, std::memory_order_relaxed );
+				return job;
+			}
+		}
+
+		/* Start stealing from the next queue, so that thieves spread over victims instead of all hammering queue 0. */
+		const u32 queue_count = ( u32 )worker_queues.size();
+		const u32 first_index = owns_a_queue ? this_thread_queue_index + 1 : 0;
+
+		for( u32 attempt = 0; attempt < queue_count; attempt++ )
+		{
+			const u32 victim_index = ( first_index + attempt ) % queue_count;
+
+			if( owns_a_queue && victim_index == this_thread_queue_index )
+				continue;
+
+			if( Job* job = worker_queues[ victim_index ]->Steal() )
+				return job;
+		}
+
+		return nullptr;
+	}
+
+	void JobSystem::Execute( Job* job )
+	{
+		job->function();
+
+		if( job->counter )
+			OnJobCompleted( *job->counter );
+
+		delete job;
+	}
+
+	void JobSystem::OnJobCompleted( Counter& counter )
+	{
+		std::vector< Job* > continuations;
+
+		{
+			std::scoped_lock lock( counter.mutex );
+
+			if( counter.pending_job_count.fetch_sub( 1, std::memory_order_acq_rel ) != 1 )
+				return;
+
+			continuations.swap( counter.continuations );
+		}
+
+		for( Job* continuation : continuations )
+			Schedule( continuation );
+	}
+
+	bool JobSystem::ExecuteOneMainThreadJob()
+	{
+		Job* job = nullptr;
+
+		{
+			std::scoped_lock lock( main_thread_queue_mutex );
+
+			if( main_thread_queue.empty() )
+				return false;
+
+			job = main_thread_queue.front();
+			main_thread_queue.erase( main_thread_queue.begin() );
+		}
+
+		Execute( job );
+
+		return true;
+	}
+
+	void JobSystem::WorkerThreadLoop( const u32 queue_index )
+	{
+		this_thread_job_system  = this;
+		this_thread_queue_index = queue_index;
+
+		while( true )
+		{
+			const u32 generation = wake_up_generation.load( std::memory_order_acquire );
+
+			if( not is_running.load( std::memory_order_acquire ) )
+				break;
+
+			if( Job* job = FindJob() )
+				Execute( job );
+			else
+				wake_up_generation.wait( generation, std::memory_order_acquire );
+		}
+	}
+
+	void JobSystem::WakeUpWorker()
+	{
+		wake_up_generation.fetch_add( 1, std::memory_order_release );
+		wake_up_generation.notify_one();
+	}
+}
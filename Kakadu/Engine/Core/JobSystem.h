@@ -0,0 +1,130 @@
+#pragma once
+
+// Engine Includes.
+#include "Macros.h"
+#include "Types.h"
+
+// std Includes.
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Kakadu
+{
+	/* A fixed pool of worker threads executing small jobs, with work-stealing: Every worker (& the main thread) pushes to/pops from its own lock-free deque,
+	 * idle workers steal from the other end of others' deques. Jobs scheduled from threads outside the system go to a shared, mutex-guarded queue.
+	 *
+	 * Jobs can be grouped via Counters to be waited on, or to run other jobs once the group is done (continuations).
+	 * Waiting threads execute other jobs instead of blocking, so jobs may schedule & wait on other jobs themselves.
+	 * Main-thread jobs (e.g., GL work depending on results of worker jobs) are only ever executed on the main thread; by ExecuteMainThreadJobs() or while it waits.
+	 *
+	 * Registered through ServiceLocator by the Application, which also executes main-thread jobs once per frame. */
+	class JobSystem
+	{
+	private:
+		struct Job;
+		struct WorkerQueue;
+
+	public:
+		using Function		= std::function< void() >;
+		using RangeFunction = std::function< void( const std::size_t begin, const std::size_t end ) >;
+
+		/* Counts the pending jobs (scheduled or waiting on a dependency) it was passed to. Must not be destroyed before it is done. */
+		class Counter
+		{
+			friend class JobSystem;
+
+		public:
+			Counter();
+
+			DELETE_COPY_AND_MOVE_CONSTRUCTORS( Counter );
+
+			~Counter();
+
+			bool IsDone() const { return pending_job_count.load( std::memory_order_acquire ) == 0; }
+
+		private:
+			std::atomic< u32 > pending_job_count;
+
+			/* Guards continuations, as well as the transition of pending_job_count to zero. */
+			std::mutex mutex;
+			std::vector< Job* > continuations;
+		};
+
+	public:
+		/* The calling thread becomes the main thread. */
+		JobSystem( const u32 worker_count = DefaultWorkerCount() );
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( JobSystem );
+
+		/* Jobs that have not started yet are discarded. */
+		~JobSystem();
+
+	/* Usage: */
+
+		void Run( Function&& function, Counter* counter = nullptr );
+		/* Schedules function once dependency is done. The job counts as pending for counter in the meantime. */
+		void RunAfter( Counter& dependency, Function&& function, Counter* counter = nullptr );
+
+		void RunOnMainThread( Function&& function, Counter* counter = nullptr );
+		/* Schedules function on the main thread once dependency is done. The job counts as pending for counter in the meantime. */
+		void RunOnMainThreadAfter( Counter& dependency, Function&& function, Counter* counter = nullptr );
+
+		/* Splits [ 0, count ) into ranges of (at most) grain_size elements & calls function( begin, end ) for each, in parallel. Returns when all ranges are done.
+		 * The calling thread processes ranges too. Small inputs (count <= grain_size) are processed on the calling thread only. */
+		void ParallelFor( const std::size_t count, const std::size_t grain_size, const RangeFunction& function );
+
+		/* Executes other jobs while counter is not done. On the main thread, this includes main-thread jobs. */
+		void Wait( Counter& counter );
+
+		/* Main thread only. Executes main-thread jobs scheduled so far. */
+		void ExecuteMainThreadJobs();
+
+	/* Queries: */
+
+		u32 WorkerCount() const { return ( u32 )workers.size(); }
+		bool IsMainThread() const { return std::this_thread::get_id() == main_thread_id; }
+
+		/* One per hardware thread, save for the main thread. At least 1. */
+		static u32 DefaultWorkerCount();
+
+	private:
+		Job* CreateJob( Function&& function, Counter* counter, const bool is_main_thread_only );
+
+		void Schedule( Job* job );
+		void ScheduleAfter( Counter& dependency, Job* job );
+
+		/* Own queue first, then the shared queue, then steals from the others'. Returns nullptr if there are no jobs. */
+		Job* FindJob();
+		void Execute( Job* job );
+		void OnJobCompleted( Counter& counter );
+
+		bool ExecuteOneMainThreadJob();
+
+		void WorkerThreadLoop( const u32 queue_index );
+
+		void WakeUpWorker();
+
+	private:
+		/* One per worker, + the main thread's at index 0. */
+		std::vector< std::unique_ptr< WorkerQueue > > worker_queues;
+
+		/* For jobs scheduled from threads without a WorkerQueue, & for overflowing WorkerQueues. */
+		std::mutex shared_queue_mutex;
+		std::vector< Job* > shared_queue;
+		std::atomic< u32 > shared_queue_size;
+
+		std::mutex main_thread_queue_mutex;
+		std::vector< Job* > main_thread_queue;
+
+		/* Bumped whenever a job is scheduled; Idle workers wait for it to change, which can not be missed, as they read it before looking for jobs. */
+		std::atomic< u32 > wake_up_generation;
+		std::atomic< bool > is_running;
+
+		std::thread::id main_thread_id;
+		std::vector< std::thread > workers;
+	};
+}
@@ -0,0 +1,147 @@
+#ifdef _WIN32
+// Windows Includes.
+#define WIN32_LEAN_AND_MEAN // Exclude rarely-used stuff from Windows headers
+#include <Windows.h>
+#else
+// POSIX Includes.
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+// Engine Includes.
+#include "MemoryMappedFile.h"
+
+// std Includes.
+#include <utility>
+
+namespace Kakadu
+{
+	MemoryMappedFile::MemoryMappedFile()
+		:
+#ifdef _WIN32
+		file_handle( nullptr ),
+		mapping_handle( nullptr ),
+#else
+		file_descriptor( -1 ),
+#endif // _WIN32
+		data( nullptr ),
+		size( 0 )
+	{
+	}
+
+	MemoryMappedFile::MemoryMappedFile( const std::filesystem::path& file_path )
+		:
+		MemoryMappedFile()
+	{
+#ifdef _WIN32
+		file_handle = CreateFileW( file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+		if( file_handle == INVALID_HANDLE_VALUE )
+		{
+			file_handle = nullptr;
+			return;
+		}
+
+		LARGE_INTEGER file_size;
+		if( not GetFileSizeEx( file_handle, &file_size ) || file_size.QuadPart == 0 )
+		{
+			Close();
+			return;
+		}
+
+		mapping_handle = CreateFileMappingW( file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if( not mapping_handle )
+		{
+			Close();
+			return;
+		}
+
+		data = static_cast< const std::byte* >( MapViewOfFile( mapping_handle, FILE_MAP_READ, 0, 0, 0 ) );
+		size = data ? ( std::size_t )file_size.QuadPart : 0;
+#else
+		file_descriptor = open( file_path.c_str(), O_RDONLY );
+		if( file_descriptor < 0 )
+			return;
+
+		struct stat file_status;
+		if( fstat( file_descriptor, &file_status ) != 0 || file_status.st_size == 0 )
+		{
+			Close();
+			return;
+		}
+
+		void* mapping = mmap( nullptr, ( std::size_t )file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0 );
+		if( mapping == MAP_FAILED )
+		{
+			Close();
+			return;
+		}
+
+		data = static_cast< const std::byte* >( mapping );
+		size = ( std::size_t )file_status.st_size;
+#endif // _WIN32
+
+		if( not data )
+			Close();
+	}
+
+	MemoryMappedFile::MemoryMappedFile( MemoryMappedFile&& donor )
+		:
+#ifdef _WIN32
+		file_handle( std::exchange( donor.file_handle, nullptr ) ),
+		mapping_handle( std::exchange( donor.mapping_handle, nullptr ) ),
+#else
+		file_descriptor( std::exchange( donor.file_descriptor, -1 ) ),
+#endif // _WIN32
+		data( std::exchange( donor.data, nullptr ) ),
+		size( std::exchange( donor.size, 0 ) )
+	{
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=( MemoryMappedFile&& donor )
+	{
+		Close();
+
+#ifdef _WIN32
+		file_handle     = std::exchange( donor.file_handle,		nullptr );
+		mapping_handle  = std::exchange( donor.mapping_handle,	nullptr );
+#else
+		file_descriptor = std::exchange( donor.file_descriptor,	-1 );
+#endif // _WIN32
+		data            = std::exchange( donor.data,			nullptr );
+		size            = std::exchange( donor.size,			0 );
+
+		return *this;
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+
+	void MemoryMappedFile::Close()
+	{
+#ifdef _WIN32
+		if( data )
+			UnmapViewOfFile( data );
+		if( mapping_handle )
+			CloseHandle( mapping_handle );
+		if( file_handle )
+			CloseHandle( file_handle );
+
+		file_handle    = nullptr;
+		mapping_handle = nullptr;
+#else
+		if( data )
+			munmap( const_cast< std::byte* >( data ), size );
+		if( file_descriptor >= 0 )
+			close( file_descriptor );
+
+		file_descriptor = -1;
+#endif // _WIN32
+
+		data = nullptr;
+		size = 0;
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+// Engine Includes.
+#include "Macros.h"
+
+// std Includes.
+#include <cstddef> // std::byte.
+#include <filesystem>
+#include <span>
+
+namespace Kakadu
+{
+	/* Read-only view of a whole file, mapped into the address space; Pages are brought in by the OS on first access, so nothing is read up-front. */
+	class MemoryMappedFile
+	{
+	public:
+		MemoryMappedFile();
+		/* Check IsValid() afterwards; Missing or empty files result in an invalid mapping. */
+		MemoryMappedFile( const std::filesystem::path& file_path );
+
+		DELETE_COPY_CONSTRUCTORS( MemoryMappedFile );
+
+		MemoryMappedFile( MemoryMappedFile&& donor );
+		MemoryMappedFile& operator =( MemoryMappedFile&& donor );
+
+		~MemoryMappedFile();
+
+	/* Queries: */
+
+		bool IsValid() const { return data != nullptr; }
+
+		std::span< const std::byte > Bytes() const { return { data, size }; }
+		std::size_t Size() const { return size; }
+
+	private:
+		void Close();
+
+	private:
+#ifdef _WIN32
+		void* file_handle;
+		void* mapping_handle;
+#else
+		int file_descriptor;
+#endif // _WIN32
+
+		const std::byte* data;
+		std::size_t size;
+	};
+}
@@ -8,6 +8,7 @@
 
 // Engine Includes.
 #include "Graphics/RHI/RHI.h"
+#include "Graphics/RHI/StateCache.h"
 #include "Optimization.h"
 #include "Platform.h"
 #include "Utility.hpp"
@@ -32,6 +33,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 namespace Kakadu::Platform
 {
@@ -45,6 +47,7 @@ namespace Kakadu::Platform
 
 	internal_variable GLFWwindow* SPLASH_WINDOW = nullptr;
 	internal_variable GLFWwindow* MAIN_WINDOW   = nullptr;
+	internal_variable std::vector< GLFWwindow* > SHARED_CONTEXT_WINDOWS;
 
 	internal_variable bool KEYS_THAT_ARE_PRESSED[ ( i32 )KeyCode::KEY_LAST + 1 ] = { 0 };
 	internal_variable bool KEYS_THAT_WERE_PRESSED[ ( i32 )KeyCode::KEY_LAST + 1 ] = { 0 };
@@ -335,6 +338,7 @@ namespace Kakadu::Platform
 
 		// Switch current context to main:
 		glfwMakeContextCurrent( MAIN_WINDOW );
+		Kakadu::RHI::StateCache::Invalidate(); // State is per-context.
 
 #ifdef _EDITOR
 		CreateGLDebugContext();
@@ -566,6 +570,45 @@ namespace Kakadu::Platform
 		glfwSwapBuffers( MAIN_WINDOW );
 	}
 
+	/*
+	 * Shared Contexts:
+	 */
+
+	u32 CreateSharedContexts( const u32 count )
+	{
+		/* Context hints set during initialization are still in effect. */
+		glfwWindowHint( GLFW_VISIBLE, GLFW_FALSE );
+
+		for( u32 index = 0; index < count; index++ )
+		{
+			/* Window size does not matter; These are never shown & never rendered to. */
+			if( auto window = glfwCreateWindow( 1, 1, "Kakadu Shared Context", nullptr, MAIN_WINDOW ) )
+				SHARED_CONTEXT_WINDOWS.push_back( window );
+			else
+				break;
+		}
+
+		return ( u32 )SHARED_CONTEXT_WINDOWS.size();
+	}
+
+	void DestroySharedContexts()
+	{
+		for( auto window : SHARED_CONTEXT_WINDOWS )
+			glfwDestroyWindow( window );
+
+		SHARED_CONTEXT_WINDOWS.clear();
+	}
+
+	void MakeSharedContextCurrent( const u32 context_index )
+	{
+		glfwMakeContextCurrent( SHARED_CONTEXT_WINDOWS[ context_index ] );
+	}
+
+	void ReleaseCurrentContext()
+	{
+		glfwMakeContextCurrent( nullptr );
+	}
+
 	/*
 	 * Events:
 	 */
@@ -201,6 +201,13 @@ namespace Kakadu::Platform
 
 	void SwapBuffers();
 
+	/* Shared GL contexts; For worker threads that create GL objects (e.g., compile shaders) in the background.
+	 * Creation & destruction must happen on the main thread. Each context can only be current on one thread at a time. */
+	u32 CreateSharedContexts( const u32 count ); // Returns the number of contexts that could be created.
+	void DestroySharedContexts(); // Expects none of the contexts to be current on any thread.
+	void MakeSharedContextCurrent( const u32 context_index );
+	void ReleaseCurrentContext();
+
 	/* Events. */
 	void PollEvents();
 
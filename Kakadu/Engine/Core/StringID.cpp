@@ -0,0 +1,63 @@
+// Engine Includes.
+#include "StringID.h"
+#include "Core/Assertion.h"
+#include "Core/Macros.h"
+
+// std Includes.
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Kakadu
+{
+	struct StringIDTable
+	{
+		std::shared_mutex mutex;
+		/* Node-based, so references returned by Name() stay valid as the table grows. */
+		std::unordered_map< StringID, std::string > name_per_id;
+	};
+
+	internal_function StringIDTable& GetStringIDTable()
+	{
+		static StringIDTable table;
+		return table;
+	}
+
+	StringID StringID::Intern( const std::string_view string )
+	{
+		const StringID id( string );
+
+		auto& table = GetStringIDTable();
+
+		{
+			std::shared_lock lock( table.mutex );
+
+			if( const auto iterator = table.name_per_id.find( id );
+				iterator != table.name_per_id.cend() )
+			{
+				ASSERT_DEBUG_ONLY( iterator->second == string && "StringID::Intern(): Hash collision between two different strings!" );
+				return id;
+			}
+		}
+
+		std::unique_lock lock( table.mutex );
+		table.name_per_id.try_emplace( id, string );
+
+		return id;
+	}
+
+	const std::string& StringID::Name() const
+	{
+		static const std::string empty_string;
+
+		auto& table = GetStringIDTable();
+
+		std::shared_lock lock( table.mutex );
+
+		if( const auto iterator = table.name_per_id.find( *this );
+			iterator != table.name_per_id.cend() )
+			return iterator->second;
+
+		return empty_string;
+	}
+}
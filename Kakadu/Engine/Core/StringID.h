@@ -0,0 +1,61 @@
+#pragma once
+
+// Engine Includes.
+#include "Hash.h"
+#include "Types.h"
+
+// std Includes.
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Kakadu
+{
+	/* A 64-bit FNV-1a hash of a string, to be used as a key in place of the string itself: Hashing & comparing it are single integer operations.
+	 * Constructing one from a literal can be done at compile-time (see the _id literal); Construction at run-time only hashes & allocates nothing.
+	 *
+	 * Intern() additionally records the string in a process-wide reverse table, so that Name() can recover it (for the editor, logging etc.).
+	 * Debug builds check interned strings for hash collisions. */
+	class StringID
+	{
+	public:
+		constexpr StringID() : hash( Hash::FNV1a( std::string_view() ) ) {}
+		constexpr StringID( const std::string_view string ) : hash( Hash::FNV1a( string ) ) {}
+		constexpr StringID( const char* string ) : hash( Hash::FNV1a( std::string_view( string ) ) ) {}
+		constexpr StringID( const std::string& string ) : hash( Hash::FNV1a( std::string_view( string ) ) ) {}
+
+		/* Thread-safe. */
+		static StringID Intern( const std::string_view string );
+
+		constexpr bool operator ==( const StringID& other ) const = default;
+		constexpr bool operator !=( const StringID& other ) const = default;
+
+	/* Queries: */
+
+		constexpr u64 Hash() const { return hash; }
+
+		/* Thread-safe. Returns an empty string if the string was never interned. */
+		const std::string& Name() const;
+
+	private:
+		u64 hash;
+	};
+
+	namespace Literals
+	{
+		consteval StringID operator"" _id( const char* string, std::size_t length )
+		{
+			return StringID( std::string_view( string, length ) );
+		}
+	}
+}
+
+namespace std
+{
+	/* The FNV-1a hash is already well distributed; No need to hash it again. */
+	template<>
+	struct hash< Kakadu::StringID >
+	{
+		std::size_t operator()( const Kakadu::StringID id ) const noexcept { return std::size_t( id.Hash() ); }
+	};
+}
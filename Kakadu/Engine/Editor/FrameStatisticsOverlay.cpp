@@ -83,6 +83,31 @@ namespace Kakadu::Editor
 			ImGui::SameLine();
 			if( ImGui::Button( ICON_FA_ARROWS_ROTATE " Reset##time_multiplier", max_size_half_width ) )
 				editor_context.frame_time.time_multiplier = 1.0f;
+
+			/* GPU Timings: */
+			if( auto* gpu_profiler = editor_context.renderer_introspection_surface.gpu_profiler;
+				gpu_profiler && ImGui::TreeNode( ICON_FA_MICROCHIP " GPU Timings" ) )
+			{
+				ImGui::Checkbox( "Enabled##gpu_profiler", &gpu_profiler->is_enabled );
+
+				if( gpu_profiler->is_enabled )
+				{
+					const float duration_column_x = max_width - ImGui::CalcTextSize( "999.999 ms" ).x;
+
+					/* Timings are in depth-first order; Indent each by its depth to show the hierarchy. */
+					for( const auto& timing : gpu_profiler->LastResolvedFrameTimings() )
+					{
+						ImGui::Text( "%*s%s", ( int )timing.depth * 2, "", timing.name.c_str() );
+						ImGui::SameLine( duration_column_x );
+						ImGui::Text( "%7.3f ms", timing.duration_in_ms );
+					}
+
+					if( gpu_profiler->DroppedFrameCount() > 0 )
+						ImGui::TextDisabled( "Dropped frames (results not ready in time): %llu", gpu_profiler->DroppedFrameCount() );
+				}
+
+				ImGui::TreePop();
+			}
 		}
 
 		ImGuiUtility::EndOverlay();
@@ -3,6 +3,8 @@
 
 // Engine Includes.
 #include "Graphics/BuiltinMaterials.h"
+#include "Graphics/RHI/StateCache.h"
+#include "Core/Log.h"
 #include "Core/ImGuiDrawer.hpp"
 #include "Core/ImGuiUtility.h"
 #include "Core/ImGuiCustomColors.h"
@@ -268,35 +270,87 @@ namespace Kakadu::Editor
 
 				if( ImGui::BeginTabItem( "Shadow Mapping" ) )
 				{
-					auto& shadow_mapping_projection_parameters = *introspection_surface.shadow_mapping_projection_parameters;
-
-					ImGui::PushItemWidth( ImGui::CalcTextSize( "999.9" ).x + style.FramePadding.x * 2 );
-
-				/* Row 1: */
-					const float button_width( ImGui::CalcTextSize( "XXXXXX" ).x + style.ItemInnerSpacing.x );
-					ImGui::Dummy( ImVec2{ 2.0f * button_width, 0 } );
-					ImGui::SameLine();
-					ImGui::InputFloat( " Top", &shadow_mapping_projection_parameters.top, 0.0f, 0.0f, "%.1f" );
-				/* Row 2: */
-					ImGui::Dummy( ImVec2{ 3.0f * button_width, 0 } );
-					ImGui::SameLine();
-					ImGui::InputFloat( " Far", &shadow_mapping_projection_parameters.far, 0.0f, 0.0f, "%.1f" );
-				/* Row 3: */
-					ImGui::InputFloat( " Left", &shadow_mapping_projection_parameters.left, 0.0f, 0.0f, "%.1f" );
-					ImGui::SameLine();
-					ImGui::Dummy( ImVec2{ 2.0f * button_width, 0 } );
-					ImGui::SameLine();
-					ImGui::InputFloat( " Right", &shadow_mapping_projection_parameters.right, 0.0f, 0.0f, "%.1f" );
-				/* Row 4: */
-					ImGui::Dummy( ImVec2{ button_width, 0 } );
-					ImGui::SameLine();
-					ImGui::InputFloat( " Near", &shadow_mapping_projection_parameters.near, 0.0f, 0.0f, "%.1f" );
-				/* Row 5: */
-					ImGui::Dummy( ImVec2{ 2.0f * button_width, 0 } );
-					ImGui::SameLine();
-					ImGui::InputFloat( " Bottom", &shadow_mapping_projection_parameters.bottom, 0.0f, 0.0f, "%.1f" );
-
-					ImGui::PopItemWidth();
+					CascadedShadowMapSettings settings = renderer.GetShadowMappingSettings();
+
+					i32 cascade_count = ( i32 )settings.cascade_count;
+					if( ImGui::SliderInt( "Cascade Count", &cascade_count, 1, ( i32 )CascadedShadowMapSettings::CASCADE_MAX_COUNT ) )
+						settings.cascade_count = ( u32 )cascade_count;
+
+					i32 resolution_log_2 = Math::Log2( settings.resolution_in_pixels );
+					const auto resolution_string = std::to_string( settings.resolution_in_pixels ) + " x " + std::to_string( settings.resolution_in_pixels );
+					if( ImGui::SliderInt( "Resolution", &resolution_log_2, 9, 13, resolution_string.c_str() ) )
+						settings.resolution_in_pixels = Math::Pow2( resolution_log_2 );
+
+					ImGui::SliderFloat( "Max. Distance", &settings.max_distance, 1.0f, 1000.0f, "%.1f", ImGuiSliderFlags_Logarithmic );
+					ImGui::SliderFloat( "Split Lambda", &settings.split_lambda, 0.0f, 1.0f, "%.2f" );
+					if( ImGui::IsItemHovered() )
+						ImGui::SetTooltip( "0 = Uniform splits, 1 = Logarithmic splits." );
+
+					ImGui::Checkbox( "Cache Static Casters", &settings.cache_static_casters );
+
+					if( settings != renderer.GetShadowMappingSettings() )
+						renderer.SetShadowMappingSettings( settings );
+
+					ImGui::EndTabItem();
+				}
+
+				if( ImGui::BeginTabItem( ICON_FA_CHART_COLUMN " Frame Statistics" ) )
+				{
+					auto& recorder = renderer.GetFrameStatisticsRecorder();
+
+					/* CSV Capture: */
+					ImGui::SeparatorText( "CSV Capture" );
+					{
+						local_persist char file_path[ 256 ] = "FrameStatistics.csv";
+
+						ImGui::BeginDisabled( recorder.IsCapturingCSV() );
+						ImGui::InputText( "File", file_path, sizeof( file_path ) );
+						ImGui::EndDisabled();
+
+						if( recorder.IsCapturingCSV() )
+						{
+							if( ImGui::Button( ICON_FA_STOP " Stop" ) )
+								recorder.StopCSVCapture();
+							ImGui::SameLine();
+							ImGui::Text( "%llu frames captured.", recorder.CapturedFrameCount() );
+						}
+						else if( ImGui::Button( ICON_FA_CIRCLE " Record" ) && not recorder.StartCSVCapture( file_path ) )
+							Log::Error( ICON_FA_CHART_COLUMN " Could not open \"" + std::string( file_path ) + "\" for the frame statistics capture." );
+					}
+
+					/* Last Frame: */
+					ImGui::NewLine();
+					ImGui::SeparatorText( "Last Frame" );
+
+					if( ImGui::BeginTable( "Frame Statistics", 1 + ( int )RHI::COUNTER_FIELDS.size(), ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit ) )
+					{
+						ImGui::TableSetupColumn( "Scope" );
+						for( const auto& field : RHI::COUNTER_FIELDS )
+							ImGui::TableSetupColumn( field.display_name );
+						ImGui::TableHeadersRow();
+
+						auto DrawRow = []( const char* name, const u32 depth, const RHI::Counters& counters )
+						{
+							ImGui::TableNextRow();
+							ImGui::TableNextColumn();
+							ImGui::Text( "%*s%s", ( int )depth * 2, "", name );
+
+							for( const auto& field : RHI::COUNTER_FIELDS )
+							{
+								ImGui::TableNextColumn();
+								ImGui::Text( "%llu", counters.*field.member );
+							}
+						};
+
+						const auto& statistics = recorder.LastFrameStatistics();
+
+						DrawRow( "Total", 0, statistics.total );
+						/* Scopes are in depth-first order; Indent each by its depth to show the hierarchy. */
+						for( const auto& scope : statistics.scopes )
+							DrawRow( scope.name.c_str(), scope.depth + 1, scope.counters );
+
+						ImGui::EndTable();
+					}
 
 					ImGui::EndTabItem();
 				}
@@ -343,6 +397,17 @@ namespace Kakadu::Editor
 							renderer.SetBloomAntiFlickerSetting( ( Renderer::BloomAntiFlickerSetting )anti_flicker_option );
 					}
 
+					/* State Cache: */
+					ImGui::NewLine();
+					ImGui::SeparatorText( "GL State Changes (Last Frame)" );
+					{
+						const auto& statistics = RHI::StateCache::LastFrameStatistics();
+						const u64 total = statistics.issued + statistics.skipped;
+
+						ImGui::Text( "Issued:  %llu", statistics.issued );
+						ImGui::Text( "Skipped: %llu (%.1f%%)", statistics.skipped, total ? 100.0f * statistics.skipped / total : 0.0f );
+					}
+
 					/* Misc.: */
 					ImGui::NewLine();
 					ImGui::SeparatorText( "Misc." );
@@ -1,285 +1,250 @@
 // Engine Includes.
 #include "BuiltinShaders.h"
 #include "Renderer.h"
+#include "RHI/ShaderCompiler.h"
+#include "Core/Log.h"
 #include "Core/Utility.hpp"
 #include "Asset/Paths.h"
 
+// std Includes.
+#include <fstream>
+
 #define FullVertexShaderPath( file_path )	ENGINE_SHADER_PATH_ABSOLUTE( file_path ) ""_vert
 #define FullGeometryShaderPath( file_path ) ENGINE_SHADER_PATH_ABSOLUTE( file_path ) ""_geom
 #define FullFragmentShaderPath( file_path ) ENGINE_SHADER_PATH_ABSOLUTE( file_path ) ""_frag
 
+/* One line per compiled variant: "<permutation set name>;<feature definition>;<feature definition>...". */
+#define RECORDED_PERMUTATIONS_FILE_PATH ENGINE_SHADER_CACHE_ROOT_ABSOLUTE "/Permutations.txt"
+
 namespace Kakadu
 {
 	/* Static member variable definitions: */
-	std::unordered_map< std::string, RHI::Shader > BuiltinShaders::SHADER_MAP;
+	std::unordered_map< std::string, RHI::ShaderPermutationSet > BuiltinShaders::PERMUTATION_SET_MAP;
+	std::unordered_map< std::string, BuiltinShaders::NamedVariant > BuiltinShaders::NAMED_VARIANT_MAP;
+	Renderer* BuiltinShaders::RENDERER = nullptr;
 
 	RHI::Shader* BuiltinShaders::Get( const std::string& name )
 	{
 		// Just to get a better error message.
-		ASSERT_DEBUG_ONLY( SHADER_MAP.contains( name ) && ( "Built-in shader with the name \"" + name + "\" was not found!" ).c_str() );
+		ASSERT_DEBUG_ONLY( NAMED_VARIANT_MAP.contains( name ) && ( "Built-in shader with the name \"" + name + "\" was not found!" ).c_str() );
+
+		auto& named_variant = NAMED_VARIANT_MAP.find( name )->second;
+
+		if( not named_variant.shader )
+			named_variant.shader = Get( named_variant.permutation_set->Name(), named_variant.features );
+
+		return named_variant.shader;
+	}
+
+	RHI::Shader* BuiltinShaders::Get( const std::string& permutation_set_name, const RHI::Shader::Features& features )
+	{
+		// Just to get a better error message.
+		ASSERT_DEBUG_ONLY( PERMUTATION_SET_MAP.contains( permutation_set_name ) &&
+						   ( "Built-in shader permutation set with the name \"" + permutation_set_name + "\" was not found!" ).c_str() );
 
-		return &( SHADER_MAP.find( name )->second );
+		auto& permutation_set = PERMUTATION_SET_MAP.find( permutation_set_name )->second;
+
+		const auto [ shader, is_compiled_just_now ] = permutation_set.GetOrCompile( features );
+
+		if( is_compiled_just_now )
+		{
+			RENDERER->RegisterShader( *shader );
+			RecordPermutation( permutation_set, shader->features_requested );
+		}
+
+		return shader;
 	}
 
 	void BuiltinShaders::Initialize( Renderer& renderer )
 	{
 		using namespace RHI::Literals;
 
-		SHADER_MAP.try_emplace( "Skybox",
-								"Skybox",
-								FullVertexShaderPath( "Skybox.vert" ),
-								FullFragmentShaderPath( "Skybox.frag" ) );
-		SHADER_MAP.try_emplace( "Blinn-Phong",
-								"Blinn-Phong",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ) );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Shadowed)",
-								"Blinn-Phong (Shadowed)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SHADOWS_ENABLED",
-									"SOFT_SHADOWS"
-								} );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Instanced)",
-								"Blinn-Phong (Instanced)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Skybox Reflection)",
-								"Blinn-Phong (Skybox Reflection)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features{ "SKYBOX_ENVIRONMENT_MAPPING" } );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Shadowed | Instanced)",
-								"Blinn-Phong (Shadowed | Instanced)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SHADOWS_ENABLED",
-									"SOFT_SHADOWS",
-									"INSTANCING_ENABLED"
-								} );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Shadowed | Parallax)",
-								"Blinn-Phong (Shadowed | Parallax)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SHADOWS_ENABLED",
-									"SOFT_SHADOWS",
-									"PARALLAX_MAPPING_ENABLED"
-								} );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Shadowed | Parallax | Instanced)",
-								"Blinn-Phong (Shadowed | Parallax | Instanced)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SHADOWS_ENABLED",
-									"SOFT_SHADOWS",
-									"PARALLAX_MAPPING_ENABLED",
-									"INSTANCING_ENABLED"
-								} );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Skybox Reflection | Instanced)",
-								"Blinn-Phong (Skybox Reflection | Instanced)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SKYBOX_ENVIRONMENT_MAPPING",
-									"INSTANCING_ENABLED"
-								} );
-		SHADER_MAP.try_emplace( "Blinn-Phong (Skybox Reflection | Shadowed | Instanced)",
-								"Blinn-Phong (Skybox Reflection | Shadowed | Instanced)",
-								FullVertexShaderPath( "Blinn-Phong.vert" ),
-								FullFragmentShaderPath( "Blinn-Phong.frag" ),
-								RHI::Shader::Features
-								{
-									"SKYBOX_ENVIRONMENT_MAPPING",
-									"SHADOWS_ENABLED",
-									"SOFT_SHADOWS",
-									"INSTANCING_ENABLED"
-								} );
-		SHADER_MAP.try_emplace( "Color",
-								"Color",
-								FullVertexShaderPath( "Color.vert" ),
-								FullFragmentShaderPath( "Color.frag" ) );
-		SHADER_MAP.try_emplace( "Color (Instanced)",
-								"Color (Instanced)",
-								FullVertexShaderPath( "Color.vert" ),
-								FullFragmentShaderPath( "Color.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
+		RENDERER = &renderer;
+
+		/* Permutation sets only parse their sources' Feature declarations here; Variants are compiled on first use (or in PreWarm() below). */
+
+		PERMUTATION_SET_MAP.try_emplace( "Skybox",
+										 "Skybox",
+										 FullVertexShaderPath( "Skybox.vert" ),
+										 FullFragmentShaderPath( "Skybox.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Blinn-Phong",
+										 "Blinn-Phong",
+										 FullVertexShaderPath( "Blinn-Phong.vert" ),
+										 FullFragmentShaderPath( "Blinn-Phong.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Color",
+										 "Color",
+										 FullVertexShaderPath( "Color.vert" ),
+										 FullFragmentShaderPath( "Color.frag" ) );
+#ifdef _EDITOR
+		PERMUTATION_SET_MAP.try_emplace( "Debug TBN As Colors",
+										 "Debug TBN As Colors",
+										 FullVertexShaderPath( "DebugTBN_AsColors.vert" ),
+										 FullFragmentShaderPath( "DebugTBN_AsColors.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Debug TBN As Vectors",
+										 "Debug TBN As Vectors",
+										 FullVertexShaderPath( "DebugTBN_AsVectors.vert" ),
+										 FullGeometryShaderPath( "DebugTBN_AsVectors.geom" ),
+										 FullFragmentShaderPath( "DebugTBN_AsVectors.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Debug UVs As Colors",
+										 "Debug UVs As Colors",
+										 FullVertexShaderPath( "DebugUVs_AsColors.vert" ),
+										 FullFragmentShaderPath( "DebugUVs_AsColors.frag" ) );
+#endif // _EDITOR
+		PERMUTATION_SET_MAP.try_emplace( "Textured",
+										 "Textured",
+										 FullVertexShaderPath( "Textured.vert" ),
+										 FullFragmentShaderPath( "Textured.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Outline",
+										 "Outline",
+										 FullVertexShaderPath( "Outline.vert" ),
+										 FullFragmentShaderPath( "Color.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Texture Blit",
+										 "Texture Blit",
+										 FullVertexShaderPath( "PassThrough_UVs.vert" ),
+										 FullFragmentShaderPath( "Textured.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Fullscreen Blit",
+										 "Fullscreen Blit",
+										 FullVertexShaderPath( "PassThrough.vert" ),
+										 FullFragmentShaderPath( "FullScreenBlit.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "MSAA Resolve",
+										 "MSAA Resolve",
+										 FullVertexShaderPath( "PassThrough.vert" ),
+										 FullFragmentShaderPath( "MSAA_Resolve.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Post-Process Bloom Downsample",
+										 "Post-Process Bloom Downsample",
+										 FullVertexShaderPath( "PassThrough_UVs.vert" ),
+										 FullFragmentShaderPath( "BloomDownsample.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Post-Process Bloom Upsample",
+										 "Post-Process Bloom Upsample",
+										 FullVertexShaderPath( "PassThrough_UVs.vert" ),
+										 FullFragmentShaderPath( "BloomUpsample.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Tonemapping",
+										 "Tonemapping",
+										 FullVertexShaderPath( "PassThrough.vert" ),
+										 FullFragmentShaderPath( "Tonemapping.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Post-Process Grayscale",
+										 "Post-Process Grayscale",
+										 FullVertexShaderPath( "PassThrough.vert" ),
+										 FullFragmentShaderPath( "Grayscale.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Post-Process Generic",
+										 "Post-Process Generic",
+										 FullVertexShaderPath( "PassThrough.vert" ),
+										 FullFragmentShaderPath( "GenericPostprocess.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Shadow-map Write",
+										 "Shadow-map Write",
+										 FullVertexShaderPath( "PassThrough_Transform.vert" ),
+										 FullFragmentShaderPath( "Empty.frag" ) );
+		PERMUTATION_SET_MAP.try_emplace( "Wireframe",
+										 "Wireframe",
+										 FullVertexShaderPath( "Wireframe.vert" ),
+										 FullGeometryShaderPath( "Wireframe.geom" ),
+										 FullFragmentShaderPath( "Wireframe.frag" ) );
+
+		/* Named variants: */
+
+		auto AddNamedVariant = [ & ]( const char* name, const char* permutation_set_name, RHI::Shader::Features&& features = {} )
+		{
+			NAMED_VARIANT_MAP.try_emplace( name, NamedVariant{ &PERMUTATION_SET_MAP.find( permutation_set_name )->second, std::move( features ), nullptr } );
+		};
+
+		AddNamedVariant( "Skybox",														"Skybox" );
+		AddNamedVariant( "Blinn-Phong",													"Blinn-Phong" );
+		AddNamedVariant( "Blinn-Phong (Shadowed)",										"Blinn-Phong", { "SHADOWS_ENABLED", "SOFT_SHADOWS" } );
+		AddNamedVariant( "Blinn-Phong (Instanced)",										"Blinn-Phong", { "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Blinn-Phong (Skybox Reflection)",								"Blinn-Phong", { "SKYBOX_ENVIRONMENT_MAPPING" } );
+		AddNamedVariant( "Blinn-Phong (Shadowed | Instanced)",							"Blinn-Phong", { "SHADOWS_ENABLED", "SOFT_SHADOWS", "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Blinn-Phong (Shadowed | Parallax)",							"Blinn-Phong", { "SHADOWS_ENABLED", "SOFT_SHADOWS", "PARALLAX_MAPPING_ENABLED" } );
+		AddNamedVariant( "Blinn-Phong (Shadowed | Parallax | Instanced)",				"Blinn-Phong", { "SHADOWS_ENABLED", "SOFT_SHADOWS", "PARALLAX_MAPPING_ENABLED", "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Blinn-Phong (Skybox Reflection | Instanced)",					"Blinn-Phong", { "SKYBOX_ENVIRONMENT_MAPPING", "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Blinn-Phong (Skybox Reflection | Shadowed | Instanced)",		"Blinn-Phong", { "SKYBOX_ENVIRONMENT_MAPPING", "SHADOWS_ENABLED", "SOFT_SHADOWS", "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Color",														"Color" );
+		AddNamedVariant( "Color (Instanced)",											"Color", { "INSTANCING_ENABLED" } );
 #ifdef _EDITOR
-		SHADER_MAP.try_emplace( "Debug TBN As Colors",
-								"Debug TBN As Colors",
-								FullVertexShaderPath( "DebugTBN_AsColors.vert" ),
-								FullFragmentShaderPath( "DebugTBN_AsColors.frag" ) );
-		SHADER_MAP.try_emplace( "Debug TBN As Colors (Instanced)",
-								"Debug TBN As Colors (Instanced)",
-								FullVertexShaderPath( "DebugTBN_AsColors.vert" ),
-								FullFragmentShaderPath( "DebugTBN_AsColors.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
-		SHADER_MAP.try_emplace( "Debug TBN As Vectors",
-								"Debug TBN As Vectors",
-								FullVertexShaderPath( "DebugTBN_AsVectors.vert" ),
-								FullGeometryShaderPath( "DebugTBN_AsVectors.geom" ),
-								FullFragmentShaderPath( "DebugTBN_AsVectors.frag" ) );
-		SHADER_MAP.try_emplace( "Debug TBN As Vectors (Instanced)",
-								"Debug TBN As Vectors (Instanced)",
-								FullVertexShaderPath( "DebugTBN_AsVectors.vert" ),
-								FullGeometryShaderPath( "DebugTBN_AsVectors.geom" ),
-								FullFragmentShaderPath( "DebugTBN_AsVectors.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
-		SHADER_MAP.try_emplace( "Debug UVs As Colors",
-								"Debug UVs As Colors",
-								FullVertexShaderPath( "DebugUVs_AsColors.vert" ),
-								FullFragmentShaderPath( "DebugUVs_AsColors.frag" ) );
-		SHADER_MAP.try_emplace( "Debug UVs As Colors (Instanced)",
-								"Debug UVs As Colors (Instanced)",
-								FullVertexShaderPath( "DebugUVs_AsColors.vert" ),
-								FullFragmentShaderPath( "DebugUVs_AsColors.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Debug TBN As Colors",											"Debug TBN As Colors" );
+		AddNamedVariant( "Debug TBN As Colors (Instanced)",								"Debug TBN As Colors", { "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Debug TBN As Vectors",										"Debug TBN As Vectors" );
+		AddNamedVariant( "Debug TBN As Vectors (Instanced)",							"Debug TBN As Vectors", { "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Debug UVs As Colors",											"Debug UVs As Colors" );
+		AddNamedVariant( "Debug UVs As Colors (Instanced)",								"Debug UVs As Colors", { "INSTANCING_ENABLED" } );
 #endif // _EDITOR
-		SHADER_MAP.try_emplace( "Textured",
-								"Textured",
-								FullVertexShaderPath( "Textured.vert" ),
-								FullFragmentShaderPath( "Textured.frag" ) );
-		SHADER_MAP.try_emplace( "Textured (Discard Transparent)",
-								"Textured (Discard Transparent)",
-								FullVertexShaderPath( "Textured.vert" ),
-								FullFragmentShaderPath( "Textured.frag" ),
-								RHI::Shader::Features{ "DISCARD_TRANSPARENT_FRAGMENTS" } );
-		SHADER_MAP.try_emplace( "Outline",
-								"Outline",
-								FullVertexShaderPath( "Outline.vert" ),
-								FullFragmentShaderPath( "Color.frag" ) );
-		SHADER_MAP.try_emplace( "Texture Blit",
-								"Texture Blit",
-								FullVertexShaderPath( "PassThrough_UVs.vert" ),
-								FullFragmentShaderPath( "Textured.frag" ) );
-		SHADER_MAP.try_emplace( "Fullscreen Blit",
-								"Fullscreen Blit",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "FullScreenBlit.frag" ) );
-		SHADER_MAP.try_emplace( "MSAA Resolve 2x",
-								"MSAA Resolve 2x",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features{ "SAMPLE_COUNT 2" } );
-		SHADER_MAP.try_emplace( "MSAA Resolve 4x",
-								"MSAA Resolve 4x",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features{ "SAMPLE_COUNT 4" } );
-		SHADER_MAP.try_emplace( "MSAA Resolve 8x",
-								"MSAA Resolve 8x",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features{ "SAMPLE_COUNT 8" } );
-		SHADER_MAP.try_emplace( "MSAA Resolve 2x (HDR-Aware)",
-								"MSAA Resolve 2x (HDR-Aware)",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features
-								{
-									"SAMPLE_COUNT 2",
-									"HDR_AWARE"
-								} );
-		SHADER_MAP.try_emplace( "MSAA Resolve 4x (HDR-Aware)",
-								"MSAA Resolve 4x (HDR-Aware)",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features
-								{
-									"SAMPLE_COUNT 4",
-									"HDR_AWARE"
-								} );
-		SHADER_MAP.try_emplace( "MSAA Resolve 8x (HDR-Aware)",
-								"MSAA Resolve 8x (HDR-Aware)",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "MSAA_Resolve.frag" ),
-								RHI::Shader::Features
-								{
-									"SAMPLE_COUNT 8",
-									"HDR_AWARE"
-								} );
-		SHADER_MAP.try_emplace( "Post-Process Bloom Downsample",
-								"Post-Process Bloom Downsample",
-								FullVertexShaderPath( "PassThrough_UVs.vert" ),
-								FullFragmentShaderPath( "BloomDownsample.frag" ) );
-		SHADER_MAP.try_emplace( "Post-Process Bloom Downsample (Anti Flicker Coarse)",
-								"Post-Process Bloom Downsample (Anti Flicker Coarse)",
-								FullVertexShaderPath( "PassThrough_UVs.vert" ),
-								FullFragmentShaderPath( "BloomDownsample.frag" ),
-								RHI::Shader::Features{ "ANTI_FLICKER_COARSE" } );
-		SHADER_MAP.try_emplace( "Post-Process Bloom Downsample (Anti Flicker Fine)",
-								"Post-Process Bloom Downsample (Anti Flicker Fine)",
-								FullVertexShaderPath( "PassThrough_UVs.vert" ),
-								FullFragmentShaderPath( "BloomDownsample.frag" ),
-								RHI::Shader::Features{ "ANTI_FLICKER_FINE" } );
-		SHADER_MAP.try_emplace( "Post-Process Bloom Upsample",
-								"Post-Process Bloom Upsample",
-								FullVertexShaderPath( "PassThrough_UVs.vert" ),
-								FullFragmentShaderPath( "BloomUpsample.frag" ) );
-		SHADER_MAP.try_emplace( "Tonemapping",
-								"Tonemapping",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "Tonemapping.frag" ) );
-		SHADER_MAP.try_emplace( "Tonemapping (Bloom)",
-								"Tonemapping (Bloom)",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "Tonemapping.frag" ),
-								RHI::Shader::Features{ "BLOOM" } );
-		SHADER_MAP.try_emplace( "Post-Process Grayscale",
-								"Post-Process Grayscale",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "Grayscale.frag" ) );
-		SHADER_MAP.try_emplace( "Post-Process Generic",
-								"Post-Process Generic",
-								FullVertexShaderPath( "PassThrough.vert" ),
-								FullFragmentShaderPath( "GenericPostprocess.frag" ) );
-		SHADER_MAP.try_emplace( "Shadow-map Write",
-								"Shadow-map Write",
-								FullVertexShaderPath( "PassThrough_Transform.vert" ),
-								FullFragmentShaderPath( "Empty.frag" ) );
-		SHADER_MAP.try_emplace( "Shadow-map Write (Instanced)",
-								"Shadow-map Write (Instanced)",
-								FullVertexShaderPath( "PassThrough_Transform.vert" ),
-								FullFragmentShaderPath( "Empty.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
-		SHADER_MAP.try_emplace( "Wireframe",
-								"Wireframe",
-								FullVertexShaderPath( "Wireframe.vert" ),
-								FullGeometryShaderPath( "Wireframe.geom" ),
-								FullFragmentShaderPath( "Wireframe.frag" ) );
-		SHADER_MAP.try_emplace( "Wireframe (Instanced)",
-								"Wireframe (Instanced)",
-								FullVertexShaderPath( "Wireframe.vert" ),
-								FullGeometryShaderPath( "Wireframe.geom" ),
-								FullFragmentShaderPath( "Wireframe.frag" ),
-								RHI::Shader::Features{ "INSTANCING_ENABLED" } );
-		SHADER_MAP.try_emplace( "Wireframe Overlay",
-								"Wireframe Overlay",
-								FullVertexShaderPath( "Wireframe.vert" ),
-								FullGeometryShaderPath( "Wireframe.geom" ),
-								FullFragmentShaderPath( "Wireframe.frag" ),
-								RHI::Shader::Features{ "OFFSET_DEPTH" } );
-		SHADER_MAP.try_emplace( "Wireframe Overlay (Instanced)",
-								"Wireframe Overlay (Instanced)",
-								FullVertexShaderPath( "Wireframe.vert" ),
-								FullGeometryShaderPath( "Wireframe.geom" ),
-								FullFragmentShaderPath( "Wireframe.frag" ),
-								RHI::Shader::Features
-								{
-									"INSTANCING_ENABLED",
-									"OFFSET_DEPTH"
-								} );
-
-		/* Register all built-in shaders: */
-		for( auto& [ shader_name, shader ] : SHADER_MAP )
-			renderer.RegisterShader( shader );
+		AddNamedVariant( "Textured",													"Textured" );
+		AddNamedVariant( "Textured (Discard Transparent)",								"Textured", { "DISCARD_TRANSPARENT_FRAGMENTS" } );
+		AddNamedVariant( "Outline",														"Outline" );
+		AddNamedVariant( "Texture Blit",												"Texture Blit" );
+		AddNamedVariant( "Fullscreen Blit",												"Fullscreen Blit" );
+		AddNamedVariant( "MSAA Resolve 2x",												"MSAA Resolve", { "SAMPLE_COUNT 2" } );
+		AddNamedVariant( "MSAA Resolve 4x",												"MSAA Resolve", { "SAMPLE_COUNT 4" } );
+		AddNamedVariant( "MSAA Resolve 8x",												"MSAA Resolve", { "SAMPLE_COUNT 8" } );
+		AddNamedVariant( "MSAA Resolve 2x (HDR-Aware)",									"MSAA Resolve", { "SAMPLE_COUNT 2", "HDR_AWARE" } );
+		AddNamedVariant( "MSAA Resolve 4x (HDR-Aware)",									"MSAA Resolve", { "SAMPLE_COUNT 4", "HDR_AWARE" } );
+		AddNamedVariant( "MSAA Resolve 8x (HDR-Aware)",									"MSAA Resolve", { "SAMPLE_COUNT 8", "HDR_AWARE" } );
+		AddNamedVariant( "Post-Process Bloom Downsample",								"Post-Process Bloom Downsample" );
+		AddNamedVariant( "Post-Process Bloom Downsample (Anti Flicker Coarse)",			"Post-Process Bloom Downsample", { "ANTI_FLICKER_COARSE" } );
+		AddNamedVariant( "Post-Process Bloom Downsample (Anti Flicker Fine)",			"Post-Process Bloom Downsample", { "ANTI_FLICKER_FINE" } );
+		AddNamedVariant( "Post-Process Bloom Upsample",									"Post-Process Bloom Upsample" );
+		AddNamedVariant( "Tonemapping",													"Tonemapping" );
+		AddNamedVariant( "Tonemapping (Bloom)",											"Tonemapping", { "BLOOM" } );
+		AddNamedVariant( "Post-Process Grayscale",										"Post-Process Grayscale" );
+		AddNamedVariant( "Post-Process Generic",										"Post-Process Generic" );
+		AddNamedVariant( "Shadow-map Write",											"Shadow-map Write" );
+		AddNamedVariant( "Shadow-map Write (Instanced)",								"Shadow-map Write", { "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Wireframe",													"Wireframe" );
+		AddNamedVariant( "Wireframe (Instanced)",										"Wireframe", { "INSTANCING_ENABLED" } );
+		AddNamedVariant( "Wireframe Overlay",											"Wireframe", { "OFFSET_DEPTH" } );
+		AddNamedVariant( "Wireframe Overlay (Instanced)",								"Wireframe", { "INSTANCING_ENABLED", "OFFSET_DEPTH" } );
+
+		PreWarm();
+	}
+
+	void BuiltinShaders::PreWarm()
+	{
+		auto recorded_permutations_file = std::ifstream( RECORDED_PERMUTATIONS_FILE_PATH );
+		if( not recorded_permutations_file )
+			return;
+
+		/* Compile all recorded variants in one batch so that their compilations overlap: */
+		RHI::ShaderCompiler compiler;
+
+		std::vector< RHI::Shader* > shaders_submitted;
+
+		for( std::string line; std::getline( recorded_permutations_file, line ); )
+		{
+			const auto tokens = Utility::String::Split( line, ';' );
+			if( tokens.empty() )
+				continue;
+
+			/* Sets may not exist in this build (e.g., editor-only ones) or may have been removed since. */
+			auto iterator = PERMUTATION_SET_MAP.find( std::string( tokens.front() ) );
+			if( iterator == PERMUTATION_SET_MAP.end() )
+				continue;
+
+			RHI::Shader::Features features;
+			for( auto token_iterator = tokens.begin() + 1; token_iterator != tokens.end(); token_iterator++ )
+				features.emplace_back( *token_iterator );
+
+			if( auto shader = iterator->second.Submit( compiler, features ) )
+				shaders_submitted.push_back( shader );
+		}
+
+		compiler.Finish();
+
+		for( auto shader : shaders_submitted )
+			RENDERER->RegisterShader( *shader );
+	}
+
+	void BuiltinShaders::RecordPermutation( const RHI::ShaderPermutationSet& permutation_set, const RHI::Shader::Features& features )
+	{
+		std::string line( permutation_set.Name() );
+		for( const auto& feature_definition : features )
+		{
+			line += ';';
+			line += feature_definition;
+		}
+
+		std::error_code error_code;
+		std::filesystem::create_directories( ENGINE_SHADER_CACHE_ROOT_ABSOLUTE, error_code );
+
+		if( auto recorded_permutations_file = std::ofstream( RECORDED_PERMUTATIONS_FILE_PATH, std::ios::app ) )
+			recorded_permutations_file << line << '\n';
 	}
 }
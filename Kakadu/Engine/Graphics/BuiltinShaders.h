@@ -2,6 +2,7 @@
 
 // Engine Includes.
 #include "RHI/Shader.hpp"
+#include "RHI/ShaderPermutationSet.h"
 
 // std Includes.
 #include <unordered_map>
@@ -11,18 +12,37 @@ namespace Kakadu
 	/* Forward declarations: */
 	class Renderer;
 
-	/* Singleton. */
+	/* Singleton.
+	 * Variants are compiled on first use & registered to the Renderer. Every compiled variant is recorded to a file,
+	 * so that subsequent runs can compile the variants used before in one parallel batch during initialization (i.e., pre-warm). */
 	class BuiltinShaders
 	{
 		friend class Renderer;
 
 	public:
+		/* Named variants, e.g., "Blinn-Phong (Shadowed | Instanced)". */
 		static RHI::Shader* Get( const std::string& name );
+		/* Any variant of a permutation set, e.g., Get( "Blinn-Phong", { "SHADOWS_ENABLED", "SOFT_SHADOWS", "INSTANCING_ENABLED" } ). */
+		static RHI::Shader* Get( const std::string& permutation_set_name, const RHI::Shader::Features& features );
+
+	private:
+		struct NamedVariant
+		{
+			RHI::ShaderPermutationSet* permutation_set;
+			RHI::Shader::Features features;
+			RHI::Shader* shader; // Resolved on first use.
+		};
 
 	private:
 		static void Initialize( Renderer& renderer );
 
+		static void PreWarm();
+		static void RecordPermutation( const RHI::ShaderPermutationSet& permutation_set, const RHI::Shader::Features& features );
+
 	private:
-		static std::unordered_map< std::string, RHI::Shader > SHADER_MAP;
+		static std::unordered_map< std::string, RHI::ShaderPermutationSet > PERMUTATION_SET_MAP;
+		static std::unordered_map< std::string, NamedVariant > NAMED_VARIANT_MAP;
+
+		static Renderer* RENDERER;
 	};
 }
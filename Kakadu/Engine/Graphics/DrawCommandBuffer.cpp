@@ -0,0 +1,36 @@
+// Engine Includes.
+#include "DrawCommandBuffer.h"
+#include "RHI/GLLabelPrefixes.h"
+
+namespace Kakadu
+{
+	DrawCommandBuffer::DrawCommandBuffer( const u32 initial_capacity_per_region )
+		:
+		ring_buffer( initial_capacity_per_region * sizeof( DrawElementsIndirectCommand ), 1, GL_LABEL_PREFIX_INDIRECT_BUFFER "Draw Commands" )
+	{
+		Bind();
+	}
+
+	void DrawCommandBuffer::BeginFrame()
+	{
+		ring_buffer.BeginFrame();
+	}
+
+	std::span< DrawElementsIndirectCommand > DrawCommandBuffer::Allocate( const u32 command_count, std::size_t& indirect_offset )
+	{
+		const u32 size = command_count * sizeof( DrawElementsIndirectCommand );
+
+		if( ring_buffer.Reserve( size ) )
+			Bind();
+
+		indirect_offset = ring_buffer.Allocate( size );
+
+		return std::span< DrawElementsIndirectCommand >( reinterpret_cast< DrawElementsIndirectCommand* >( ring_buffer.MappedMemory() + indirect_offset ), command_count );
+	}
+
+	void DrawCommandBuffer::Bind() const
+	{
+		/* Not part of the VAO state; Stays bound until the buffer is re-created. */
+		glBindBuffer( GL_DRAW_INDIRECT_BUFFER, ring_buffer.Id() );
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "RHI/PersistentRingBuffer.h"
+
+// std Includes.
+#include <cstddef>
+#include <span>
+
+namespace Kakadu
+{
+	/* Layout dictated by GL for glMultiDrawElementsIndirect(). */
+	struct DrawElementsIndirectCommand
+	{
+		u32 index_count;
+		u32 instance_count;
+		u32 first_index;
+		i32 base_vertex;
+		u32 base_instance; // Index of the (first) world transform inside the DrawTransformBuffer.
+	};
+
+	/* Storage for the commands of indirect multi-draws, in an RHI::PersistentRingBuffer; Bound to GL_DRAW_INDIRECT_BUFFER for the whole lifetime. */
+	class DrawCommandBuffer
+	{
+	public:
+		DrawCommandBuffer( const u32 initial_capacity_per_region );
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( DrawCommandBuffer );
+
+	/* Usage: */
+
+		/* Fences the region used by the previous frame & moves on to the next region (waiting for the GPU to be done with it if necessary). */
+		void BeginFrame();
+
+		/* Reserves consecutive commands in the current region, to be filled by the caller.
+		 * indirect_offset is the byte offset of the first command inside the buffer, to be passed as the "indirect" parameter of the draw call. */
+		std::span< DrawElementsIndirectCommand > Allocate( const u32 command_count, std::size_t& indirect_offset );
+
+	/* Queries: */
+
+		u32 CapacityPerRegion() const { return ring_buffer.RegionSize() / sizeof( DrawElementsIndirectCommand ); }
+		u32 Count()				const { return ring_buffer.UsedSize()   / sizeof( DrawElementsIndirectCommand ); }
+
+	private:
+		void Bind() const;
+
+	private:
+		RHI::PersistentRingBuffer ring_buffer;
+	};
+}
@@ -0,0 +1,88 @@
+// Engine Includes.
+#include "DrawPacket.h"
+
+// std Includes.
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace Kakadu
+{
+	namespace SortKey
+	{
+		template< u32 BitCount >
+		constexpr u64 Field( const u32 value )
+		{
+			return u64( value ) & ( ( u64( 1 ) << BitCount ) - 1 );
+		}
+
+		u16 QuantizeDepth( const float distance_squared )
+		{
+			return u16( std::bit_cast< u32 >( distance_squared < 0.0f ? 0.0f : distance_squared ) >> ( 32 - BIT_COUNT_DEPTH ) );
+		}
+
+		u64 Compose( const u32 pass, const u32 state, const u32 shader, const u32 material, const u32 mesh, const u16 depth, const SortingMode sorting_mode )
+		{
+			u64 key = Field< BIT_COUNT_PASS >( pass );
+			key = ( key << BIT_COUNT_STATE ) | Field< BIT_COUNT_STATE >( state );
+
+			if( sorting_mode == SortingMode::BackToFront )
+			{
+				key = ( key << BIT_COUNT_DEPTH    ) | Field< BIT_COUNT_DEPTH    >( u16( ~depth ) ); // Inverted => furthest first.
+				key = ( key << BIT_COUNT_SHADER   ) | Field< BIT_COUNT_SHADER   >( shader );
+				key = ( key << BIT_COUNT_MATERIAL ) | Field< BIT_COUNT_MATERIAL >( material );
+				key = ( key << BIT_COUNT_MESH     ) | Field< BIT_COUNT_MESH     >( mesh );
+			}
+			else
+			{
+				key = ( key << BIT_COUNT_SHADER   ) | Field< BIT_COUNT_SHADER   >( shader );
+				key = ( key << BIT_COUNT_MATERIAL ) | Field< BIT_COUNT_MATERIAL >( material );
+				key = ( key << BIT_COUNT_MESH     ) | Field< BIT_COUNT_MESH     >( mesh );
+				key = ( key << BIT_COUNT_DEPTH    ) | Field< BIT_COUNT_DEPTH    >( sorting_mode == SortingMode::FrontToBack ? depth : 0 );
+			}
+
+			return key;
+		}
+	}
+
+	void RadixSort( std::vector< DrawPacket >& packets, std::vector< DrawPacket >& scratch )
+	{
+		const std::size_t count = packets.size();
+
+		if( count < 2 )
+			return;
+
+		scratch.resize( count );
+
+		DrawPacket* source      = packets.data();
+		DrawPacket* destination = scratch.data();
+
+		for( u32 shift = 0; shift < 64; shift += 8 )
+		{
+			std::array< std::size_t, 256 > histogram{};
+
+			for( std::size_t i = 0; i < count; i++ )
+				histogram[ ( source[ i ].sort_key >> shift ) & 0xFF ]++;
+
+			/* Every key has the same digit here; This pass would be a plain copy. */
+			if( histogram[ ( source[ 0 ].sort_key >> shift ) & 0xFF ] == count )
+				continue;
+
+			std::size_t offset = 0;
+			for( auto& bucket : histogram )
+			{
+				const std::size_t bucket_size = bucket;
+				bucket  = offset;
+				offset += bucket_size;
+			}
+
+			for( std::size_t i = 0; i < count; i++ )
+				destination[ histogram[ ( source[ i ].sort_key >> shift ) & 0xFF ]++ ] = source[ i ];
+
+			std::swap( source, destination );
+		}
+
+		if( source != packets.data() )
+			std::copy( source, source + count, packets.data() );
+	}
+}
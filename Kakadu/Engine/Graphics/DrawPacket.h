@@ -0,0 +1,52 @@
+#pragma once
+
+// Engine Includes.
+#include "SortingMode.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <vector>
+
+namespace Kakadu
+{
+	/* Forward declarations: */
+	class Renderable;
+
+	/* A single entry of a queue's flat draw list. Sorting these by key groups draws by state, shader, material & mesh (in that order),
+	 * so the submit loop only needs to change GL state when the relevant field of the key changes. */
+	struct DrawPacket
+	{
+		u64 sort_key;
+		Renderable* renderable;
+	};
+
+	/* Bit layout of DrawPacket::sort_key (most significant first):
+	 *
+	 *	Opaque (FrontToBack/None):	| pass: 6 | state: 2 | shader: 12 | material: 14 | mesh: 14 | depth: 16 |
+	 *	Transparent (BackToFront):	| pass: 6 | state: 2 | depth: 16  | shader: 12   | material: 14 | mesh: 14 |
+	 *
+	 * Transparent draws need to be sorted by depth first for correct blending; State changes only come second.
+	 * The material field is derived from Material::ParameterHash(), so that equivalent Materials end up adjacent & their draws can be instanced together.
+	 * Ids wider than their field are truncated. This can only break the grouping, not correctness: The submit loop compares actual objects. */
+	namespace SortKey
+	{
+		constexpr u32 BIT_COUNT_PASS     = 6;
+		constexpr u32 BIT_COUNT_STATE    = 2;
+		constexpr u32 BIT_COUNT_SHADER   = 12;
+		constexpr u32 BIT_COUNT_MATERIAL = 14;
+		constexpr u32 BIT_COUNT_MESH     = 14;
+		constexpr u32 BIT_COUNT_DEPTH    = 16;
+
+		static_assert( BIT_COUNT_PASS + BIT_COUNT_STATE + BIT_COUNT_SHADER + BIT_COUNT_MATERIAL + BIT_COUNT_MESH + BIT_COUNT_DEPTH == 64 );
+
+		/* Quantizes a non-negative (squared) distance into BIT_COUNT_DEPTH bits.
+		 * Bit patterns of non-negative IEEE-754 floats are monotonic, so keeping the upper bits (exponent + top mantissa bits) preserves ordering without needing a depth range. */
+		u16 QuantizeDepth( const float distance_squared );
+
+		u64 Compose( const u32 pass, const u32 state, const u32 shader, const u32 material, const u32 mesh, const u16 depth, const SortingMode sorting_mode );
+	}
+
+	/* LSD radix sort (8 bits per digit) on DrawPacket::sort_key. Stable; Digits that are identical across all packets are skipped.
+	 * "scratch" is used as the ping-pong buffer & is kept by the caller to avoid per-frame allocations. */
+	void RadixSort( std::vector< DrawPacket >& packets, std::vector< DrawPacket >& scratch );
+}
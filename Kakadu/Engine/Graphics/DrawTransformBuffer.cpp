@@ -0,0 +1,54 @@
+// Engine Includes.
+#include "DrawTransformBuffer.h"
+#include "RHI/GLLabelPrefixes.h"
+
+// std Includes.
+#include <cstring> // std::memcpy().
+
+namespace Kakadu
+{
+	DrawTransformBuffer::DrawTransformBuffer( const u32 initial_capacity_per_region )
+		:
+		/* Whole regions are bound as SSBO ranges, so their offsets need to satisfy GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT. */
+		ring_buffer( initial_capacity_per_region * sizeof( Matrix4x4 ), RHI::ShaderStorageBufferOffsetAlignment(), GL_LABEL_PREFIX_STORAGE_BUFFER "Draw Transforms" )
+	{
+		BindCurrentRegion();
+	}
+
+	void DrawTransformBuffer::BeginFrame()
+	{
+		ring_buffer.BeginFrame();
+
+		BindCurrentRegion();
+	}
+
+	u32 DrawTransformBuffer::Push( const Matrix4x4& transform_world )
+	{
+		u32 draw_transform_index;
+		auto transform = Allocate( 1, draw_transform_index );
+
+		/* Both the CPU-side Matrix4x4 & the GLSL side (row_major qualifier) are row-major; No transposition needed. */
+		std::memcpy( transform.data(), transform_world.Data(), sizeof( Matrix4x4 ) );
+
+		return draw_transform_index;
+	}
+
+	std::span< Matrix4x4 > DrawTransformBuffer::Allocate( const u32 transform_count, u32& first_draw_transform_index )
+	{
+		const u32 size = transform_count * sizeof( Matrix4x4 );
+
+		if( ring_buffer.Reserve( size ) )
+			BindCurrentRegion();
+
+		const u32 offset = ring_buffer.Allocate( size );
+
+		first_draw_transform_index = ( offset - ring_buffer.CurrentRegionOffset() ) / sizeof( Matrix4x4 );
+
+		return std::span< Matrix4x4 >( reinterpret_cast< Matrix4x4* >( ring_buffer.MappedMemory() + offset ), transform_count );
+	}
+
+	void DrawTransformBuffer::BindCurrentRegion() const
+	{
+		glBindBufferRange( GL_SHADER_STORAGE_BUFFER, BINDING_POINT, ring_buffer.Id(), ring_buffer.CurrentRegionOffset(), ring_buffer.RegionSize() );
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "Math/Matrix.hpp"
+#include "RHI/PersistentRingBuffer.h"
+
+// std Includes.
+#include <span>
+
+namespace Kakadu
+{
+	/* Storage for the world transforms of non-instanced draws; Replaces a glUniformMatrix4fv() call per draw with a plain memcpy().
+	 * Lives in an RHI::PersistentRingBuffer, whose current region is bound as a whole each frame.
+	 * Shaders access the transforms via _Intrinsic_DrawTransforms.glsl, using base instance + instance id of the draw call as the index.
+	 * This also allows drawing many renderables sharing a Mesh with a single instanced draw call, by writing their transforms into consecutive slots. */
+	class DrawTransformBuffer
+	{
+	public:
+		static constexpr u32 BINDING_POINT = 0; // Has to match the binding declared in _Intrinsic_DrawTransforms.glsl.
+
+	public:
+		DrawTransformBuffer( const u32 initial_capacity_per_region );
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( DrawTransformBuffer );
+
+	/* Usage: */
+
+		/* Fences the region used by the previous frame, moves on to the next region (waiting for the GPU to be done with it if necessary) & binds it. */
+		void BeginFrame();
+
+		/* Writes the transform into the current region & returns its index, which is to be passed as the base instance of the draw call. */
+		u32 Push( const Matrix4x4& transform_world );
+
+		/* Reserves consecutive slots in the current region, to be filled by the caller. The index of the first slot is to be passed as the base instance of the draw call. */
+		std::span< Matrix4x4 > Allocate( const u32 transform_count, u32& first_draw_transform_index );
+
+	/* Queries: */
+
+		u32 CapacityPerRegion() const { return ring_buffer.RegionSize() / sizeof( Matrix4x4 ); }
+		u32 Count()				const { return ring_buffer.UsedSize()   / sizeof( Matrix4x4 ); }
+
+	private:
+		void BindCurrentRegion() const;
+
+	private:
+		RHI::PersistentRingBuffer ring_buffer;
+	};
+}
@@ -0,0 +1,159 @@
+// Engine Includes.
+#include "FrameStatistics.h"
+
+// std Includes.
+#include <utility> // std::swap().
+
+namespace Kakadu
+{
+	/*
+	 * Internal functions:
+	 */
+
+	/* Quotes the field (doubling embedded quotes) if it contains any characters with a special meaning in CSV. */
+	internal_function void WriteCSVField( std::ostream& stream, std::string_view field )
+	{
+		if( field.find_first_of( ",\"\r\n" ) == std::string_view::npos )
+		{
+			stream << field;
+			return;
+		}
+
+		stream << '"';
+		for( const char character : field )
+		{
+			if( character == '"' )
+				stream << '"';
+			stream << character;
+		}
+		stream << '"';
+	}
+
+	internal_function void WriteCSVRow( std::ostream& stream, const u64 frame_index, std::string_view scope_name, const std::string& depth, const RHI::Counters& counters )
+	{
+		stream << frame_index << ',';
+		WriteCSVField( stream, scope_name );
+		stream << ',' << depth;
+
+		for( const auto& field : RHI::COUNTER_FIELDS )
+			stream << ',' << counters.*field.member;
+
+		stream << '\n';
+	}
+
+	/*
+	 * FrameStatistics:
+	 */
+
+	void FrameStatistics::WriteCSVHeader( std::ostream& stream )
+	{
+		stream << "frame,scope,depth";
+
+		for( const auto& field : RHI::COUNTER_FIELDS )
+			stream << ',' << field.name;
+
+		stream << '\n';
+	}
+
+	void FrameStatistics::WriteCSVRows( std::ostream& stream ) const
+	{
+		WriteCSVRow( stream, frame_index, "Total", "", total );
+
+		for( const auto& scope : scopes )
+			WriteCSVRow( stream, frame_index, scope.name, std::to_string( scope.depth ), scope.counters );
+	}
+
+	/*
+	 * FrameStatisticsRecorder:
+	 */
+
+	FrameStatisticsRecorder::Scope::Scope( FrameStatisticsRecorder& recorder, std::string_view name )
+		:
+		recorder( recorder ),
+		scope_index( recorder.BeginScope( name ) )
+	{
+	}
+
+	FrameStatisticsRecorder::Scope::~Scope()
+	{
+		recorder.EndScope( scope_index );
+	}
+
+	FrameStatisticsRecorder::FrameStatisticsRecorder()
+		:
+		frame_current(),
+		frame_last(),
+		counters_at_frame_begin( RHI::RunningCounters() ),
+		current_depth( 0 ),
+		csv_stream(),
+		captured_frame_count( 0 )
+	{
+	}
+
+	void FrameStatisticsRecorder::BeginFrame()
+	{
+		const RHI::Counters counters_now = RHI::RunningCounters();
+
+		if( frame_current.frame_index > 0 )
+		{
+			frame_current.total = counters_now - counters_at_frame_begin;
+
+			/* Swap instead of copying, to re-use the scopes' storage. */
+			std::swap( frame_last, frame_current );
+
+			if( csv_stream.is_open() )
+			{
+				frame_last.WriteCSVRows( csv_stream );
+				captured_frame_count++;
+			}
+		}
+
+		frame_current.frame_index = frame_last.frame_index + 1;
+		frame_current.scopes.clear();
+
+		counters_at_frame_begin = counters_now;
+		current_depth           = 0;
+	}
+
+	u32 FrameStatisticsRecorder::BeginScope( std::string_view name )
+	{
+		const u32 scope_index = ( u32 )frame_current.scopes.size();
+
+		frame_current.scopes.push_back( FrameStatistics::Scope
+										{
+											.name     = std::string( name ),
+											.depth    = current_depth++,
+											.counters = RHI::RunningCounters()
+										} );
+
+		return scope_index;
+	}
+
+	void FrameStatisticsRecorder::EndScope( const u32 scope_index )
+	{
+		auto& scope = frame_current.scopes[ scope_index ];
+		scope.counters = RHI::RunningCounters() - scope.counters;
+
+		current_depth--;
+	}
+
+	bool FrameStatisticsRecorder::StartCSVCapture( const std::filesystem::path& file_path )
+	{
+		StopCSVCapture();
+
+		csv_stream.open( file_path, std::ios::out | std::ios::trunc );
+		if( not csv_stream.is_open() )
+			return false;
+
+		FrameStatistics::WriteCSVHeader( csv_stream );
+		captured_frame_count = 0;
+
+		return true;
+	}
+
+	void FrameStatisticsRecorder::StopCSVCapture()
+	{
+		if( csv_stream.is_open() )
+			csv_stream.close();
+	}
+}
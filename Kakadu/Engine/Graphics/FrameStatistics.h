@@ -0,0 +1,96 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "RHI/Counters.h"
+
+// std Includes.
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define KAKADU_FRAME_STATISTICS_SCOPE( recorder, name ) Kakadu::FrameStatisticsRecorder::Scope kakadu_frame_statistics_scope_object( recorder, name );
+
+namespace Kakadu
+{
+	/* RHI::Counters of a single frame, broken down into the (nested) scopes recorded during it. */
+	struct FrameStatistics
+	{
+		struct Scope
+		{
+			std::string name;
+			u32 depth; // 0 for the outermost scopes. Scopes are in depth-first order, i.e., the children of a Scope directly follow it.
+			RHI::Counters counters; // Includes the children's.
+		};
+
+		u64 frame_index = 0;
+		RHI::Counters total; // Everything issued during the frame, including work outside of any scope (e.g., editor UI).
+		std::vector< Scope > scopes;
+
+	/* CSV Export; Long format, i.e., one row per scope per frame, so that captures of different builds can be compared directly: */
+
+		static void WriteCSVHeader( std::ostream& stream );
+		/* The frame total comes first, as scope "Total" with an empty depth. */
+		void WriteCSVRows( std::ostream& stream ) const;
+	};
+
+	/* Attributes RHI::RunningCounters() to nested scopes by taking snapshots at their beginnings & ends.
+	 * Same usage as RHI::GPUProfiler, but there is no latency: A frame's statistics are available as soon as the next one begins. */
+	class FrameStatisticsRecorder
+	{
+	public:
+		/* RAII wrapper for BeginScope()/EndScope(). */
+		class Scope
+		{
+		public:
+			Scope( FrameStatisticsRecorder& recorder, std::string_view name );
+			~Scope();
+
+			DELETE_COPY_AND_MOVE_CONSTRUCTORS( Scope );
+
+		private:
+			FrameStatisticsRecorder& recorder;
+			u32 scope_index;
+		};
+
+	public:
+		FrameStatisticsRecorder();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( FrameStatisticsRecorder );
+
+	/* Usage: */
+
+		/* Finalizes the frame recorded so far (appending it to the CSV capture, if one is running) & starts recording a new one. */
+		void BeginFrame();
+
+		/* Returns the index to pass to EndScope(). */
+		u32 BeginScope( std::string_view name );
+		void EndScope( const u32 scope_index );
+
+	/* CSV Capture: */
+
+		/* Every frame finalized until StopCSVCapture() is appended to the file (which is overwritten). Returns false if the file could not be opened. */
+		bool StartCSVCapture( const std::filesystem::path& file_path );
+		void StopCSVCapture();
+
+		bool IsCapturingCSV() const { return csv_stream.is_open(); }
+		u64 CapturedFrameCount() const { return captured_frame_count; }
+
+	/* Queries: */
+
+		const FrameStatistics& LastFrameStatistics() const { return frame_last; }
+
+	private:
+		FrameStatistics frame_current; // Scopes' counters hold their begin snapshots until they end.
+		FrameStatistics frame_last;
+		RHI::Counters counters_at_frame_begin;
+		u32 current_depth;
+
+		std::ofstream csv_stream;
+		u64 captured_frame_count;
+	};
+}
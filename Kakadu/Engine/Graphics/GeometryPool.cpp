@@ -0,0 +1,197 @@
+// Engine Includes.
+#include "GeometryPool.h"
+#include "Core/Assertion.h"
+#include "RHI/StateCache.h"
+
+// std Includes.
+#include <algorithm>
+#include <utility>
+
+namespace Kakadu
+{
+	/*
+	 * Allocation:
+	 */
+
+	GeometryPool::Allocation::Allocation()
+		:
+		pool( nullptr ),
+		page_index( 0 ),
+		base_vertex( 0 ),
+		first_index( 0 ),
+		vertex_count( 0 ),
+		index_count( 0 )
+	{
+	}
+
+	GeometryPool::Allocation::Allocation( Allocation&& donor )
+		:
+		pool( std::exchange( donor.pool, nullptr ) ),
+		page_index( std::exchange( donor.page_index, 0 ) ),
+		base_vertex( std::exchange( donor.base_vertex, 0 ) ),
+		first_index( std::exchange( donor.first_index, 0 ) ),
+		vertex_count( std::exchange( donor.vertex_count, 0 ) ),
+		index_count( std::exchange( donor.index_count, 0 ) )
+	{
+	}
+
+	GeometryPool::Allocation& GeometryPool::Allocation::operator=( Allocation&& donor )
+	{
+		Release();
+
+		pool         = std::exchange( donor.pool,			nullptr );
+		page_index   = std::exchange( donor.page_index,		0 );
+		base_vertex  = std::exchange( donor.base_vertex,	0 );
+		first_index  = std::exchange( donor.first_index,	0 );
+		vertex_count = std::exchange( donor.vertex_count,	0 );
+		index_count  = std::exchange( donor.index_count,	0 );
+
+		return *this;
+	}
+
+	GeometryPool::Allocation::~Allocation()
+	{
+		Release();
+	}
+
+	void GeometryPool::Allocation::UploadVertices_Partial( const std::span< const std::byte > data_span, const std::size_t offset_from_allocation_start ) const
+	{
+		ASSERT_DEBUG_ONLY( pool && "UploadVertices_Partial() called on an empty GeometryPool::Allocation!" );
+
+		const auto& page = pool->pages[ page_index ];
+
+		ASSERT_DEBUG_ONLY( offset_from_allocation_start + data_span.size_bytes() <= ( std::size_t )vertex_count * page.vertex_stride &&
+						   "UploadVertices_Partial() would write past the end of the allocation!" );
+
+		glNamedBufferSubData( page.vertex_buffer.id.id,
+							  ( GLintptr )( ( std::size_t )base_vertex * page.vertex_stride + offset_from_allocation_start ),
+							  ( GLsizeiptr )data_span.size_bytes(),
+							  data_span.data() );
+	}
+
+	const RHI::VertexArray& GeometryPool::Allocation::VertexArray() const
+	{
+		ASSERT_DEBUG_ONLY( pool && "VertexArray() called on an empty GeometryPool::Allocation!" );
+
+		return pool->pages[ page_index ].vertex_array;
+	}
+
+	void GeometryPool::Allocation::Release()
+	{
+		if( pool )
+		{
+			pool->Release( *this );
+			pool = nullptr;
+		}
+	}
+
+	/*
+	 * GeometryPool:
+	 */
+
+	GeometryPool::GeometryPool()
+	{
+	}
+
+	GeometryPool::~GeometryPool()
+	{
+		ASSERT_DEBUG_ONLY( std::all_of( pages.cbegin(), pages.cend(), []( const Page& page ) { return page.allocation_count == 0; } ) &&
+						   "GeometryPool destroyed while some of its allocations are still alive!" );
+	}
+
+	GeometryPool::Allocation GeometryPool::Allocate( const RHI::VertexLayout& vertex_layout,
+													 const u32 vertex_count,
+													 const std::span< const std::byte > interleaved_vertices,
+													 const std::span< const u32 > indices )
+	{
+		if( vertex_count == 0 || indices.empty() )
+			return {};
+
+		ASSERT_DEBUG_ONLY( interleaved_vertices.size_bytes() == ( std::size_t )vertex_count * vertex_layout.Stride_NonInstanced() &&
+						   "GeometryPool::Allocate(): Vertex data size does not match the vertex count & layout!" );
+
+		const u32 page_index = FindOrCreatePage( vertex_layout, vertex_count, ( u32 )indices.size() );
+		auto& page           = pages[ page_index ];
+
+		Allocation allocation;
+		allocation.pool         = this;
+		allocation.page_index   = page_index;
+		allocation.base_vertex  = ( i32 )page.vertex_count;
+		allocation.first_index  = page.index_count;
+		allocation.vertex_count = vertex_count;
+		allocation.index_count  = ( u32 )indices.size();
+
+		/* DSA, so that the element array binding of whatever VAO is currently bound is left untouched. */
+		glNamedBufferSubData( page.vertex_buffer.id.id,
+							  ( GLintptr )page.vertex_count * page.vertex_stride,
+							  ( GLsizeiptr )interleaved_vertices.size_bytes(),
+							  interleaved_vertices.data() );
+		glNamedBufferSubData( page.index_buffer->id.id,
+							  ( GLintptr )page.index_count * sizeof( u32 ),
+							  ( GLsizeiptr )indices.size_bytes(),
+							  indices.data() );
+
+		page.vertex_count += vertex_count;
+		page.index_count  += ( u32 )indices.size();
+		page.allocation_count++;
+
+		return allocation;
+	}
+
+	u32 GeometryPool::FindOrCreatePage( const RHI::VertexLayout& vertex_layout, const u32 vertex_count, const u32 index_count )
+	{
+		for( u32 page_index = 0; page_index < ( u32 )pages.size(); page_index++ )
+		{
+			const auto& page = pages[ page_index ];
+
+			if( page.vertex_layout == vertex_layout &&
+				page.vertex_count + vertex_count <= page.vertex_capacity &&
+				page.index_count  + index_count  <= page.index_capacity )
+				return page_index;
+		}
+
+		const u32 vertex_stride   = vertex_layout.Stride_NonInstanced();
+		const u32 vertex_capacity = std::max( DEFAULT_PAGE_SIZE_VERTEX_BUFFER / vertex_stride, vertex_count );
+		const u32 index_capacity  = std::max( DEFAULT_PAGE_SIZE_INDEX_BUFFER / ( u32 )sizeof( u32 ), index_count );
+
+		const std::string page_name( "Geometry Pool Page " + std::to_string( pages.size() ) );
+
+		/* Creating the buffers binds them to their targets; Make sure no VAO captures the element array binding. */
+		RHI::StateCache::BindVertexArray( 0 );
+
+		Page page
+		{
+			.vertex_layout    = vertex_layout,
+			.vertex_buffer    = RHI::Buffer( RHI::BufferType::Vertex, vertex_capacity * vertex_stride, page_name ),
+			.index_buffer     = std::optional< RHI::Buffer >( std::in_place, RHI::BufferType::Index, index_capacity * ( u32 )sizeof( u32 ), page_name ),
+			.vertex_stride    = vertex_stride,
+			.vertex_capacity  = vertex_capacity,
+			.vertex_count     = 0,
+			.index_capacity   = index_capacity,
+			.index_count      = 0,
+			.allocation_count = 0
+		};
+
+		page.vertex_buffer.count  = vertex_capacity;
+		page.index_buffer->count  = index_capacity;
+		page.vertex_array         = RHI::VertexArray( page.vertex_buffer, page.vertex_layout, page.index_buffer, page_name );
+
+		pages.push_back( std::move( page ) );
+
+		return ( u32 )pages.size() - 1;
+	}
+
+	void GeometryPool::Release( const Allocation& allocation )
+	{
+		auto& page = pages[ allocation.page_index ];
+
+		ASSERT_DEBUG_ONLY( page.allocation_count > 0 && "GeometryPool::Release(): Page has no live allocations!" );
+
+		/* Linear allocation can not reuse holes; The whole page becomes available again once its last allocation is gone. */
+		if( --page.allocation_count == 0 )
+		{
+			page.vertex_count = 0;
+			page.index_count  = 0;
+		}
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "RHI/VertexArray.h"
+
+// std Includes.
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Kakadu
+{
+	/* Opt-in shared storage for Mesh geometry: Meshes with the same VertexLayout are sub-allocated from a few large vertex & index buffers (a "page"), which share a single VertexArray.
+	 * Consecutive draws of Meshes living in the same page need no VAO switch & can be submitted together with a single glMultiDrawElementsIndirect() (see DrawCommandBuffer).
+	 * Allocation inside a page is linear; A page's space is only reclaimed once all of its allocations are released.
+	 * This fits static geometry that is loaded & unloaded as a whole (e.g., Models). Only indexed geometry is pooled, as indirect multi-draws require indices. */
+	class GeometryPool
+	{
+	public:
+		static constexpr u32 DEFAULT_PAGE_SIZE_VERTEX_BUFFER = 32 * 1024 * 1024; // In bytes.
+		static constexpr u32 DEFAULT_PAGE_SIZE_INDEX_BUFFER  = 16 * 1024 * 1024; // In bytes.
+
+		/* Move-only handle to a vertex & index range inside a page; Releases the range on destruction. */
+		class Allocation
+		{
+			friend class GeometryPool;
+
+		public:
+			Allocation();
+
+			DELETE_COPY_CONSTRUCTORS( Allocation );
+
+			Allocation( Allocation&& donor );
+			Allocation& operator =( Allocation&& donor );
+
+			~Allocation();
+
+		/* Usage: */
+
+			void UploadVertices_Partial( const std::span< const std::byte > data_span, const std::size_t offset_from_allocation_start ) const;
+
+		/* Queries: */
+
+			explicit operator bool() const { return pool != nullptr; }
+
+			const RHI::VertexArray& VertexArray() const;
+
+			i32 BaseVertex()  const { return base_vertex;	}
+			u32 FirstIndex()  const { return first_index;	}
+			u32 VertexCount() const { return vertex_count;	}
+			u32 IndexCount()  const { return index_count;	}
+
+		private:
+			void Release();
+
+		private:
+			GeometryPool* pool;
+			u32 page_index;
+			i32 base_vertex;
+			u32 first_index;
+			u32 vertex_count;
+			u32 index_count;
+		};
+
+	public:
+		/* Does not touch GL; Pages are created on demand. */
+		GeometryPool();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( GeometryPool );
+
+		~GeometryPool();
+
+	/* Usage: */
+
+		/* Copies the given (interleaved) vertices & indices into a page with a matching layout, creating a new page if none has enough room left.
+		 * Returns an empty Allocation for non-indexed geometry. */
+		Allocation Allocate( const RHI::VertexLayout& vertex_layout,
+							 const u32 vertex_count,
+							 const std::span< const std::byte > interleaved_vertices,
+							 const std::span< const u32 > indices );
+
+	/* Queries: */
+
+		u32 PageCount() const { return ( u32 )pages.size(); }
+
+	private:
+		u32 FindOrCreatePage( const RHI::VertexLayout& vertex_layout, const u32 vertex_count, const u32 index_count );
+
+		void Release( const Allocation& allocation );
+
+	private:
+		struct Page
+		{
+			RHI::VertexLayout vertex_layout;
+			RHI::Buffer vertex_buffer;
+			std::optional< RHI::Buffer > index_buffer;
+			RHI::VertexArray vertex_array;
+
+			u32 vertex_stride;
+			u32 vertex_capacity;
+			u32 vertex_count; // Vertices allocated so far, i.e., the linear allocation cursor.
+			u32 index_capacity;
+			u32 index_count; // Indices allocated so far, i.e., the linear allocation cursor.
+			u32 allocation_count; // Live allocations; The page is reset once this drops to zero.
+		};
+
+		std::vector< Page > pages;
+	};
+}
@@ -0,0 +1,70 @@
+// Engine Includes.
+#include "LightClusterBuffer.h"
+#include "RHI/GLLabelPrefixes.h"
+
+// std Includes.
+#include <algorithm>
+#include <cstddef> // offsetof().
+#include <cstring> // std::memcpy().
+
+namespace Kakadu
+{
+	/* std430 layouts of the light structs in _Intrinsic_Lighting.glsl; C++-only extras at the end of the structs are not uploaded. */
+	constexpr u32 POINT_LIGHT_STRIDE = 4 * sizeof( Vector4 );
+	constexpr u32 SPOT_LIGHT_STRIDE  = 5 * sizeof( Vector4 );
+
+	static_assert( sizeof( Lighting::PointLightData ) == POINT_LIGHT_STRIDE, "PointLightData does not match its GLSL counterpart." );
+	static_assert( offsetof( Lighting::SpotLightData, cutoff_angle_inner ) == SPOT_LIGHT_STRIDE, "SpotLightData does not match its GLSL counterpart." );
+	static_assert( sizeof( LightClusterGrid::Cluster ) == 2 * sizeof( u32 ), "LightClusterGrid::Cluster does not match the uvec2 elements of _INTRINSIC_LIGHT_CLUSTERS." );
+
+	LightClusterBuffer::LightClusterBuffer( const u32 initial_region_size )
+		:
+		ring_buffer( initial_region_size, RHI::ShaderStorageBufferOffsetAlignment(), GL_LABEL_PREFIX_STORAGE_BUFFER "Light Clusters" ),
+		offset_alignment( RHI::ShaderStorageBufferOffsetAlignment() )
+	{
+	}
+
+	void LightClusterBuffer::BeginFrame()
+	{
+		ring_buffer.BeginFrame();
+	}
+
+	void LightClusterBuffer::Upload( const std::span< const Lighting::PointLightData > point_lights,
+									 const std::span< const Lighting::SpotLightData	 > spot_lights,
+									 const LightClusterGrid& grid )
+	{
+		const auto& clusters      = grid.Clusters();
+		const auto& light_indices = grid.LightIndices();
+
+		/* Ranges can not be empty; Pad them to at least a single element. */
+		const u32 point_lights_size = ( u32 )std::max( point_lights.size(), std::size_t( 1 ) ) * POINT_LIGHT_STRIDE;
+		const u32 spot_lights_size  = ( u32 )std::max( spot_lights.size(),  std::size_t( 1 ) ) * SPOT_LIGHT_STRIDE;
+		const u32 clusters_size     = ( u32 )( clusters.size() * sizeof( LightClusterGrid::Cluster ) + std::max( light_indices.size(), std::size_t( 1 ) ) * sizeof( u32 ) );
+
+		const auto Aligned = [ this ]( const u32 size ) { return ( size + offset_alignment - 1 ) / offset_alignment * offset_alignment; };
+
+		/* Re-creation needs no re-binding; Ranges are bound below, after allocating them. */
+		ring_buffer.Reserve( Aligned( point_lights_size ) + Aligned( spot_lights_size ) + clusters_size, offset_alignment );
+
+		const u32 point_lights_offset = ring_buffer.Allocate( point_lights_size, offset_alignment );
+		const u32 spot_lights_offset  = ring_buffer.Allocate( spot_lights_size,  offset_alignment );
+		const u32 clusters_offset     = ring_buffer.Allocate( clusters_size,	 offset_alignment );
+
+		std::byte* const mapped_memory = ring_buffer.MappedMemory();
+
+		if( not point_lights.empty() )
+			std::memcpy( mapped_memory + point_lights_offset, point_lights.data(), point_lights.size_bytes() );
+
+		for( std::size_t index = 0; index < spot_lights.size(); index++ )
+			std::memcpy( mapped_memory + spot_lights_offset + index * SPOT_LIGHT_STRIDE, &spot_lights[ index ], SPOT_LIGHT_STRIDE );
+
+		const std::size_t clusters_byte_count = clusters.size() * sizeof( LightClusterGrid::Cluster );
+		std::memcpy( mapped_memory + clusters_offset, clusters.data(), clusters_byte_count );
+		if( not light_indices.empty() )
+			std::memcpy( mapped_memory + clusters_offset + clusters_byte_count, light_indices.data(), light_indices.size() * sizeof( u32 ) );
+
+		glBindBufferRange( GL_SHADER_STORAGE_BUFFER, BINDING_POINT_POINT_LIGHTS, ring_buffer.Id(), point_lights_offset, point_lights_size );
+		glBindBufferRange( GL_SHADER_STORAGE_BUFFER, BINDING_POINT_SPOT_LIGHTS,  ring_buffer.Id(), spot_lights_offset,  spot_lights_size  );
+		glBindBufferRange( GL_SHADER_STORAGE_BUFFER, BINDING_POINT_CLUSTERS,	 ring_buffer.Id(), clusters_offset,		clusters_size	  );
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "Lighting/Lighting.h"
+#include "Lighting/LightClusterGrid.h"
+#include "RHI/PersistentRingBuffer.h"
+
+// std Includes.
+#include <span>
+
+namespace Kakadu
+{
+	/* Storage for the point & spot lights and the light clusters (see LightClusterGrid) read by shaders via _Intrinsic_Lighting.glsl, in an RHI::PersistentRingBuffer.
+	 * Every Upload() appends to the current region instead of overwriting it, as draws of earlier passes of the same frame may still be reading the previous upload. */
+	class LightClusterBuffer
+	{
+	public:
+		/* These have to match the bindings declared in _Intrinsic_Lighting.glsl. */
+		static constexpr u32 BINDING_POINT_POINT_LIGHTS	= 1;
+		static constexpr u32 BINDING_POINT_SPOT_LIGHTS	= 2;
+		static constexpr u32 BINDING_POINT_CLUSTERS		= 3;
+
+	public:
+		LightClusterBuffer( const u32 initial_region_size );
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( LightClusterBuffer );
+
+	/* Usage: */
+
+		/* Fences the region used by the previous frame & moves on to the next region (waiting for the GPU to be done with it if necessary). */
+		void BeginFrame();
+
+		/* Writes the lights & the clusters of the grid (which has to be built from these same lights) into the current region & binds them. */
+		void Upload( const std::span< const Lighting::PointLightData > point_lights,
+					 const std::span< const Lighting::SpotLightData	 > spot_lights,
+					 const LightClusterGrid& grid );
+
+	/* Queries: */
+
+		u32 RegionSize() const { return ring_buffer.RegionSize(); }
+
+	private:
+		RHI::PersistentRingBuffer ring_buffer;
+		u32 offset_alignment; // GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT.
+	};
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Types.h"
+
+namespace Kakadu
+{
+	struct CascadedShadowMapSettings
+	{
+		static constexpr u32 CASCADE_MAX_COUNT = 4; // Has to match SHADOW_CASCADE_MAX_COUNT in _Intrinsic_Lighting.glsl.
+
+		u32 cascade_count        = 4;
+		i32 resolution_in_pixels = 2048; // Of each cascade (width & height); Independent of the viewport.
+
+		float max_distance = 100.0f; // From the camera; Clamped to its far plane. Nothing further away receives shadows.
+		float split_lambda = 0.75f;  // Blends the cascade splits between uniform (0) & logarithmic (1) distribution.
+
+		bool cache_static_casters = true; // Static casters (see Renderable::is_static) are rendered into a separate cache, which is only updated when they or the cascades move.
+
+		bool operator==( const CascadedShadowMapSettings& ) const = default;
+	};
+}
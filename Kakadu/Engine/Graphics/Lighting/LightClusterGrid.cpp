@@ -0,0 +1,369 @@
+// Engine Includes.
+#include "LightClusterGrid.h"
+#include "Core/Assertion.h"
+#include "Core/JobSystem.h"
+#include "Core/ServiceLocator.hpp"
+#include "Math/Math.hpp"
+#include "Math/Matrix.h"
+
+// std Includes.
+#include <bit>
+#include <cmath>
+
+namespace Kakadu
+{
+	/*
+	 * Internal functions:
+	 */
+
+	/* Returns the distance at which the light's attenuated intensity drops below LIGHT_INFLUENCE_THRESHOLD; 0 if it never reaches it, infinity if it is never attenuated enough. */
+	internal_function float InfluenceRadius( const Lighting::PointLightData& light )
+	{
+		const auto MaxComponent = []( const Color3& color ) { return Math::Max( color.R(), color.G(), color.B() ); };
+
+		const float intensity = Math::Max( MaxComponent( light.ambient_and_attenuation_constant.color ),
+										   MaxComponent( light.diffuse_and_attenuation_linear.color ),
+										   MaxComponent( light.specular_attenuation_quadratic.color ) );
+
+		const float constant  = light.ambient_and_attenuation_constant.scalar;
+		const float linear	  = light.diffuse_and_attenuation_linear.scalar;
+		const float quadratic = light.specular_attenuation_quadratic.scalar;
+
+		/* Solve intensity / ( constant + linear * d + quadratic * d^2 ) = LIGHT_INFLUENCE_THRESHOLD for d: */
+		const float c = constant - intensity / LightClusterGrid::LIGHT_INFLUENCE_THRESHOLD;
+
+		if( c >= 0.0f )
+			return 0.0f;
+
+		if( quadratic > TypeTraits< float >::Epsilon() )
+			return ( -linear + Math::Sqrt( linear * linear - 4.0f * quadratic * c ) ) / ( 2.0f * quadratic );
+
+		if( linear > TypeTraits< float >::Epsilon() )
+			return -c / linear;
+
+		return TypeTraits< float >::Infinity();
+	}
+
+	internal_function bool SphereIntersectsAABB( const Vector3& sphere_center, const float sphere_radius, const Math::AABB& aabb )
+	{
+		float distance_squared = 0.0f;
+		for( auto axis = 0; axis < 3; axis++ )
+		{
+			const float delta = Math::Clamp( sphere_center[ axis ], aabb.min[ axis ], aabb.max[ axis ] ) - sphere_center[ axis ];
+			distance_squared += delta * delta;
+		}
+
+		return distance_squared <= sphere_radius * sphere_radius;
+	}
+
+	/* Cones are unbounded in length, as spot lights are not attenuated.
+	 * Source: "Cull that cone! Improved cone/spotlight visibility tests for tiled and clustered lighting", Bart Wronski (2017). */
+	internal_function bool ConeIntersectsSphere( const Vector3& apex, const Vector3& direction, const float cos_half_angle, const float sin_half_angle,
+												 const Vector3& sphere_center, const float sphere_radius )
+	{
+		const Vector3 apex_to_center = sphere_center - apex;
+
+		const float distance_along_axis_squared_plus_perpendicular = apex_to_center.Dot();
+		const float distance_along_axis                            = Math::Dot( apex_to_center, direction );
+		const float distance_perpendicular                         = Math::Sqrt( Math::Max( distance_along_axis_squared_plus_perpendicular - distance_along_axis * distance_along_axis, 0.0f ) );
+
+		const float distance_to_cone = cos_half_angle * distance_perpendicular - sin_half_angle * distance_along_axis;
+
+		if( distance_to_cone > sphere_radius )
+			return false;
+
+		/* Only cones narrower than a half-space can be entirely in front of a sphere. */
+		if( cos_half_angle > 0.0f && distance_along_axis < -sphere_radius )
+			return false;
+
+		return true;
+	}
+
+	/*
+	 * LightClusterGrid:
+	 */
+
+	LightClusterGrid::LightClusterGrid()
+		:
+		view_volume{},
+		depth_slicing( ZERO_INITIALIZATION ),
+		clusters( CLUSTER_COUNT, Cluster{} )
+	{
+	}
+
+	LightClusterGrid::~LightClusterGrid()
+	{
+	}
+
+	void LightClusterGrid::Build( const Matrix4x4& projection_matrix,
+								  const std::span< const Lighting::PointLightData > point_lights,
+								  const std::span< const Lighting::SpotLightData  > spot_lights )
+	{
+		UpdateViewVolume( projection_matrix );
+
+		point_light_bounds.resize( point_lights.size() );
+		for( auto index = 0; index < point_lights.size(); index++ )
+		{
+			const auto& light = point_lights[ index ];
+			auto& bounds = point_light_bounds[ index ];
+
+			bounds.center = light.position_view_space.XYZ();
+			bounds.radius = InfluenceRadius( light );
+
+			if( bounds.radius <= 0.0f || bounds.center.Z() + bounds.radius < view_volume.near || bounds.center.Z() - bounds.radius > view_volume.far )
+			{
+				/* Empty range: Does not affect any cluster. */
+				bounds.slice_first = 1;
+				bounds.slice_last  = 0;
+			}
+			else
+			{
+				bounds.slice_first = SliceIndex( bounds.center.Z() - bounds.radius );
+				bounds.slice_last  = SliceIndex( bounds.center.Z() + bounds.radius );
+			}
+		}
+
+		ServiceLocator< JobSystem >::Get().ParallelFor( SLICE_COUNT, 1, [ & ]( const std::size_t slice_index, const std::size_t /* end: Always slice_index + 1. */ )
+		{
+			BinSlice( ( u32 )slice_index, spot_lights );
+		} );
+
+		/* Concatenate the slices' lists & turn the slice-relative offsets into absolute ones. */
+		light_indices.clear();
+		for( u32 slice_index = 0; slice_index < SLICE_COUNT; slice_index++ )
+		{
+			const u32 slice_offset = ( u32 )light_indices.size();
+
+			for( u32 tile_index = 0; tile_index < TILE_COUNT_PER_SLICE; tile_index++ )
+				clusters[ slice_index * TILE_COUNT_PER_SLICE + tile_index ].light_index_offset += slice_offset;
+
+			const auto& slice_light_indices = slice_scratch[ slice_index ].light_indices;
+			light_indices.insert( light_indices.end(), slice_light_indices.cbegin(), slice_light_indices.cend() );
+		}
+	}
+
+	void LightClusterGrid::UpdateViewVolume( const Matrix4x4& projection_matrix )
+	{
+		const auto& m = projection_matrix.data;
+
+		ViewVolume new_view_volume
+		{
+			.half_width     = 1.0f / m[ 0 ][ 0 ],
+			.half_height    = 1.0f / m[ 1 ][ 1 ],
+			.is_perspective = Matrix::IsPerspectiveProjection( projection_matrix )
+		};
+
+		/* Recover the plane offsets from the depth terms of the projection matrices (see Matrix::PerspectiveProjection() & Matrix::OrthographicProjection()). */
+		if( new_view_volume.is_perspective )
+		{
+			new_view_volume.near = m[ 3 ][ 2 ] / ( -1.0f - m[ 2 ][ 2 ] );
+			new_view_volume.far  = m[ 3 ][ 2 ] / ( +1.0f - m[ 2 ][ 2 ] );
+		}
+		else
+		{
+			new_view_volume.near = ( -1.0f - m[ 3 ][ 2 ] ) / m[ 2 ][ 2 ];
+			new_view_volume.far  = ( +1.0f - m[ 3 ][ 2 ] ) / m[ 2 ][ 2 ];
+		}
+
+		if( new_view_volume == view_volume && not cluster_bounds.empty() )
+			return;
+
+		view_volume = new_view_volume;
+
+		if( view_volume.is_perspective )
+		{
+			/* slice = SLICE_COUNT * log( z / near ) / log( far / near ). */
+			const float log2_far_over_near = Math::Log2( view_volume.far / view_volume.near );
+			depth_slicing = Vector4( SLICE_COUNT / log2_far_over_near, -( float )SLICE_COUNT * Math::Log2( view_volume.near ) / log2_far_over_near, 1.0f, 0.0f );
+		}
+		else
+		{
+			const float scale = SLICE_COUNT / ( view_volume.far - view_volume.near );
+			depth_slicing = Vector4( scale, -view_volume.near * scale, 0.0f, 0.0f );
+		}
+
+		cluster_bounds.resize( CLUSTER_COUNT );
+
+		for( u32 slice_index = 0; slice_index < SLICE_COUNT; slice_index++ )
+		{
+			const float depth_near = SliceDepth( slice_index );
+			const float depth_far  = SliceDepth( slice_index + 1 );
+
+			/* View-space extents at the given depth, for a given NDC coordinate. */
+			const float scale_near = view_volume.is_perspective ? depth_near : 1.0f;
+			const float scale_far  = view_volume.is_perspective ? depth_far  : 1.0f;
+
+			slice_bounds[ slice_index ] = Math::AABB();
+
+			for( u32 tile_y = 0; tile_y < TILE_COUNT_Y; tile_y++ )
+			{
+				const float ndc_y_bottom = -1.0f + 2.0f * ( tile_y	   ) / TILE_COUNT_Y;
+				const float ndc_y_top	 = -1.0f + 2.0f * ( tile_y + 1 ) / TILE_COUNT_Y;
+
+				for( u32 tile_x = 0; tile_x < TILE_COUNT_X; tile_x++ )
+				{
+					const float ndc_x_left  = -1.0f + 2.0f * ( tile_x	  ) / TILE_COUNT_X;
+					const float ndc_x_right = -1.0f + 2.0f * ( tile_x + 1 ) / TILE_COUNT_X;
+
+					auto& bounds = cluster_bounds[ slice_index * TILE_COUNT_PER_SLICE + tile_y * TILE_COUNT_X + tile_x ];
+
+					bounds.min = Vector3( Math::Min( ndc_x_left   * scale_near, ndc_x_left   * scale_far ) * view_volume.half_width,
+										  Math::Min( ndc_y_bottom * scale_near, ndc_y_bottom * scale_far ) * view_volume.half_height,
+										  depth_near );
+					bounds.max = Vector3( Math::Max( ndc_x_right * scale_near, ndc_x_right * scale_far ) * view_volume.half_width,
+										  Math::Max( ndc_y_top	 * scale_near, ndc_y_top   * scale_far ) * view_volume.half_height,
+										  depth_far );
+
+					slice_bounds[ slice_index ].Merge( bounds );
+				}
+			}
+		}
+	}
+
+	float LightClusterGrid::SliceDepth( const u32 slice_index ) const
+	{
+		const float ratio = ( float )slice_index / SLICE_COUNT;
+
+		return view_volume.is_perspective
+				? view_volume.near * Math::Pow( view_volume.far / view_volume.near, ratio )
+				: view_volume.near + ( view_volume.far - view_volume.near ) * ratio;
+	}
+
+	u32 LightClusterGrid::SliceIndex( const float depth ) const
+	{
+		/* Has to match LightClusterIndex() in _Intrinsic_Lighting.glsl. */
+		const float depth_term = view_volume.is_perspective ? Math::Log2( Math::Max( depth, 1e-4f ) ) : depth;
+		const float slice	   = std::floor( depth_term * depth_slicing.X() + depth_slicing.Y() );
+
+		return ( u32 )Math::Clamp( slice, 0.0f, float( SLICE_COUNT - 1 ) );
+	}
+
+	void LightClusterGrid::TileRange( const Vector3& box_min, const Vector3& box_max, u32& tile_x_first, u32& tile_x_last, u32& tile_y_first, u32& tile_y_last ) const
+	{
+		/* NDC extremes of a box are at its corners, as x / z (& y / z) is monotonic in both x & z for z > 0. */
+		const float scale_near = view_volume.is_perspective ? box_min.Z() : 1.0f;
+		const float scale_far  = view_volume.is_perspective ? box_max.Z() : 1.0f;
+
+		const float ndc_x_min = Math::Min( box_min.X() / scale_near, box_min.X() / scale_far ) / view_volume.half_width;
+		const float ndc_x_max = Math::Max( box_max.X() / scale_near, box_max.X() / scale_far ) / view_volume.half_width;
+		const float ndc_y_min = Math::Min( box_min.Y() / scale_near, box_min.Y() / scale_far ) / view_volume.half_height;
+		const float ndc_y_max = Math::Max( box_max.Y() / scale_near, box_max.Y() / scale_far ) / view_volume.half_height;
+
+		const auto ToTile = []( const float ndc, const u32 tile_count )
+		{
+			return ( u32 )Math::Clamp( std::floor( ( ndc * 0.5f + 0.5f ) * tile_count ), 0.0f, float( tile_count - 1 ) );
+		};
+
+		tile_x_first = ToTile( ndc_x_min, TILE_COUNT_X );
+		tile_x_last  = ToTile( ndc_x_max, TILE_COUNT_X );
+		tile_y_first = ToTile( ndc_y_min, TILE_COUNT_Y );
+		tile_y_last  = ToTile( ndc_y_max, TILE_COUNT_Y );
+	}
+
+	void LightClusterGrid::BinSlice( const u32 slice_index, const std::span< const Lighting::SpotLightData > spot_lights )
+	{
+		auto& scratch = slice_scratch[ slice_index ];
+
+		const u32 point_light_word_count = ( u32 )( point_light_bounds.size() + 63 ) / 64;
+		const u32 spot_light_word_count  = ( u32 )( spot_lights.size()		  + 63 ) / 64;
+
+		scratch.point_light_masks.assign( TILE_COUNT_PER_SLICE * point_light_word_count, 0 );
+		scratch.spot_light_masks.assign(  TILE_COUNT_PER_SLICE * spot_light_word_count,  0 );
+
+		const Math::AABB* slice_cluster_bounds = cluster_bounds.data() + slice_index * TILE_COUNT_PER_SLICE;
+		const Math::AABB& slice_bound		   = slice_bounds[ slice_index ];
+
+		/* Point lights: */
+		for( u32 light_index = 0; light_index < point_light_bounds.size(); light_index++ )
+		{
+			const auto& bounds = point_light_bounds[ light_index ];
+
+			if( slice_index < bounds.slice_first || slice_index > bounds.slice_last )
+				continue;
+
+			const u32 word_index = light_index / 64;
+			const u64 light_bit  = u64( 1 ) << ( light_index % 64 );
+
+			const bool is_unbounded = std::isinf( bounds.radius );
+
+			u32 tile_x_first = 0, tile_x_last = TILE_COUNT_X - 1, tile_y_first = 0, tile_y_last = TILE_COUNT_Y - 1;
+			if( not is_unbounded )
+			{
+				const Vector3 box_min( bounds.center.X() - bounds.radius, bounds.center.Y() - bounds.radius, Math::Max( bounds.center.Z() - bounds.radius, slice_bound.min.Z() ) );
+				const Vector3 box_max( bounds.center.X() + bounds.radius, bounds.center.Y() + bounds.radius, Math::Min( bounds.center.Z() + bounds.radius, slice_bound.max.Z() ) );
+
+				TileRange( box_min, box_max, tile_x_first, tile_x_last, tile_y_first, tile_y_last );
+			}
+
+			for( u32 tile_y = tile_y_first; tile_y <= tile_y_last; tile_y++ )
+			{
+				for( u32 tile_x = tile_x_first; tile_x <= tile_x_last; tile_x++ )
+				{
+					const u32 tile_index = tile_y * TILE_COUNT_X + tile_x;
+
+					if( is_unbounded || SphereIntersectsAABB( bounds.center, bounds.radius, slice_cluster_bounds[ tile_index ] ) )
+						scratch.point_light_masks[ tile_index * point_light_word_count + word_index ] |= light_bit;
+				}
+			}
+		}
+
+		/* Spot lights: */
+		const Vector3 slice_center = slice_bound.Center();
+		const float   slice_radius = slice_bound.BoundingSphereRadius();
+
+		for( u32 light_index = 0; light_index < spot_lights.size(); light_index++ )
+		{
+			const auto& light = spot_lights[ light_index ];
+
+			const Vector3& apex			  = light.position_view_space_and_cos_cutoff_angle_inner.vector;
+			const Vector3& direction	  = light.direction_view_space_and_cos_cutoff_angle_outer.vector;
+			const float	   cos_half_angle = light.direction_view_space_and_cos_cutoff_angle_outer.scalar;
+			const float	   sin_half_angle = Math::Sqrt( Math::Max( 1.0f - cos_half_angle * cos_half_angle, 0.0f ) );
+
+			if( not ConeIntersectsSphere( apex, direction, cos_half_angle, sin_half_angle, slice_center, slice_radius ) )
+				continue;
+
+			const u32 word_index = light_index / 64;
+			const u64 light_bit  = u64( 1 ) << ( light_index % 64 );
+
+			for( u32 tile_index = 0; tile_index < TILE_COUNT_PER_SLICE; tile_index++ )
+			{
+				const auto& bounds = slice_cluster_bounds[ tile_index ];
+
+				if( ConeIntersectsSphere( apex, direction, cos_half_angle, sin_half_angle, bounds.Center(), bounds.BoundingSphereRadius() ) )
+					scratch.spot_light_masks[ tile_index * spot_light_word_count + word_index ] |= light_bit;
+			}
+		}
+
+		/* Emit the compact lists, point lights first: */
+		const auto AppendSetBits = [ &scratch ]( const u64* masks, const u32 word_count )
+		{
+			for( u32 word_index = 0; word_index < word_count; word_index++ )
+			{
+				for( u64 bits = masks[ word_index ]; bits != 0; bits &= bits - 1 )
+					scratch.light_indices.push_back( word_index * 64 + ( u32 )std::countr_zero( bits ) );
+			}
+		};
+
+		scratch.light_indices.clear();
+
+		for( u32 tile_index = 0; tile_index < TILE_COUNT_PER_SLICE; tile_index++ )
+		{
+			const u32 offset = ( u32 )scratch.light_indices.size();
+
+			AppendSetBits( scratch.point_light_masks.data() + tile_index * point_light_word_count, point_light_word_count );
+			const u32 point_light_count = ( u32 )scratch.light_indices.size() - offset;
+
+			AppendSetBits( scratch.spot_light_masks.data() + tile_index * spot_light_word_count, spot_light_word_count );
+			const u32 spot_light_count = ( u32 )scratch.light_indices.size() - offset - point_light_count;
+
+			ASSERT_DEBUG_ONLY( point_light_count <= 0xFFFF && spot_light_count <= 0xFFFF && "LightClusterGrid: Too many lights in a single cluster!" );
+
+			clusters[ slice_index * TILE_COUNT_PER_SLICE + tile_index ] = Cluster
+			{
+				.light_index_offset = offset, // Slice-relative for now; Build() makes it absolute.
+				.light_counts		= point_light_count | ( spot_light_count << 16 )
+			};
+		}
+	}
+}
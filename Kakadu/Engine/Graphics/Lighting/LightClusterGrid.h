@@ -0,0 +1,122 @@
+#pragma once
+
+// Engine Includes.
+#include "Lighting.h"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "Math/AABB.h"
+#include "Math/Matrix.hpp"
+
+// std Includes.
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Kakadu
+{
+	/* Bins point & spot lights into the clusters of a view volume, for clustered forward shading:
+	 * The view volume is split into TILE_COUNT_X x TILE_COUNT_Y screen-space tiles & SLICE_COUNT depth slices (exponentially distributed for perspective projections).
+	 * Each cluster ends up with a compact list of the lights that can affect it, so that shaders only evaluate those instead of every active light.
+	 *
+	 * Point lights are bounded by the distance beyond which their attenuated intensity drops below LIGHT_INFLUENCE_THRESHOLD.
+	 * Spot lights are not attenuated, so they are bounded by their (outer) cones only. Their ambient terms are not limited to the cones; Shaders apply those everywhere.
+	 *
+	 * Lights are expected in view space. Depth slices are binned in parallel via the JobSystem. */
+	class LightClusterGrid
+	{
+	public:
+		/* These have to match the defines in _Intrinsic_Lighting.glsl. */
+		static constexpr u32 TILE_COUNT_X = 16;
+		static constexpr u32 TILE_COUNT_Y = 9;
+		static constexpr u32 SLICE_COUNT  = 24;
+
+		static constexpr u32 TILE_COUNT_PER_SLICE = TILE_COUNT_X * TILE_COUNT_Y;
+		static constexpr u32 CLUSTER_COUNT		  = TILE_COUNT_PER_SLICE * SLICE_COUNT;
+
+		/* Point lights contributing less than this (relative to an intensity of 1) are considered to not affect a cluster. */
+		static constexpr float LIGHT_INFLUENCE_THRESHOLD = 1.0f / 256.0f;
+
+		/* Layout matches the uvec2 elements of _INTRINSIC_LIGHT_CLUSTERS. */
+		struct Cluster
+		{
+			u32 light_index_offset;
+			u32 light_counts; // Point light count in the lower 16 bits, spot light count in the upper 16 bits.
+		};
+
+	public:
+		LightClusterGrid();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( LightClusterGrid );
+
+		~LightClusterGrid();
+
+	/* Usage: */
+
+		/* Expects a symmetric perspective or orthographic projection, as created by Matrix::PerspectiveProjection()/OrthographicProjection().
+		 * Light indices refer to the given spans. */
+		void Build( const Matrix4x4& projection_matrix,
+					const std::span< const Lighting::PointLightData > point_lights,
+					const std::span< const Lighting::SpotLightData	> spot_lights );
+
+	/* Queries: */
+
+		const std::vector< Cluster >& Clusters()		const { return clusters; }
+		const std::vector< u32 >&	  LightIndices()	const { return light_indices; }
+
+		/* x = scale, y = bias, z = 1 if logarithmic (perspective projections), 0 if linear; slice index = floor( depth_term * scale + bias ), where depth_term is log2( view-space z ) or view-space z. */
+		const Vector4& DepthSlicing() const { return depth_slicing; }
+
+	private:
+		struct ViewVolume
+		{
+			float half_width;  // At unit depth for perspective projections.
+			float half_height; // At unit depth for perspective projections.
+			float near;
+			float far;
+			bool is_perspective;
+
+			bool operator==( const ViewVolume& ) const = default;
+		};
+
+		struct LightBounds
+		{
+			Vector3 center;
+			float radius;
+			u32 slice_first;
+			u32 slice_last;
+		};
+
+		/* Per-slice scratch, so that slices can be binned in parallel without synchronization. */
+		struct SliceScratch
+		{
+			std::vector< u64 > point_light_masks; // One bit per point light, per tile.
+			std::vector< u64 > spot_light_masks;  // One bit per spot light, per tile.
+			std::vector< u32 > light_indices;
+		};
+
+	private:
+		void UpdateViewVolume( const Matrix4x4& projection_matrix );
+
+		float SliceDepth( const u32 slice_index ) const;
+		u32 SliceIndex( const float depth ) const;
+
+		/* Returns the tile range covered by the given view-space box, inside the given slice. */
+		void TileRange( const Vector3& box_min, const Vector3& box_max, u32& tile_x_first, u32& tile_x_last, u32& tile_y_first, u32& tile_y_last ) const;
+
+		void BinSlice( const u32 slice_index,
+					   const std::span< const Lighting::SpotLightData > spot_lights );
+
+	private:
+		ViewVolume view_volume;
+		Vector4 depth_slicing;
+
+		std::vector< Math::AABB > cluster_bounds; // View space.
+		std::array< Math::AABB, SLICE_COUNT > slice_bounds;
+
+		std::vector< LightBounds > point_light_bounds;
+		std::array< SliceScratch, SLICE_COUNT > slice_scratch;
+
+		std::vector< Cluster > clusters;
+		std::vector< u32 > light_indices;
+	};
+}
@@ -3,6 +3,7 @@
 // Engine Includes.
 #include "Graphics/RHI/Std140StructTag.h"
 #include "Math/Color.hpp"
+#include "Math/Matrix.hpp"
 #include "Math/PaddedAndCombinedTypes.h"
 #include "Math/Vector.hpp"
 
@@ -29,4 +30,10 @@ namespace Kakadu::Lighting
 
 		Degrees cutoff_angle_inner, cutoff_angle_outer; // Easier to work with angles on the cpu/editor side.
 	};
+
+	struct ShadowCascadeData : public RHI::Std140StructTag
+	{
+		Matrix4x4 view_projection_transform; // World space to the cascade's clip space.
+		Vector4 far_depth_view_space_texel_depth_2_reserved; // x = camera's view-space depth where the cascade ends, y = size of a shadow-map texel in the cascade's [0, 1] depth range.
+	};
 }
@@ -2,30 +2,50 @@
 #include "BuiltinTextures.h"
 #include "Material.hpp"
 
+// std Includes.
+#include <cstring> // std::memcmp().
+#include <functional> // std::hash.
+#include <string_view>
+
 namespace Kakadu
 {
+	internal_function MaterialID GenerateMaterialID()
+	{
+		static u32 next_id = 1; // 0 is reserved for "invalid".
+		return MaterialID{ next_id++ };
+	}
+
 	Material::Material()
 		:
 		name( "<unnamed>" ),
+		id( GenerateMaterialID() ),
 		shader( nullptr ),
-		uniform_info_map( nullptr )
+		uniform_info_map( nullptr ),
+		parameter_hash( 0 ),
+		parameter_hash_is_dirty( true )
 	{
 	}
 
 	Material::Material( const std::string& name )
 		:
 		name( name ),
+		id( GenerateMaterialID() ),
 		shader( nullptr ),
-		uniform_info_map( nullptr )
+		uniform_info_map( nullptr ),
+		parameter_hash( 0 ),
+		parameter_hash_is_dirty( true )
 	{
 	}
 
 	Material::Material( const std::string& name, RHI::Shader* const shader )
 		:
 		name( name ),
+		id( GenerateMaterialID() ),
 		shader( shader ),
 		uniform_blob_default_block( shader->GetTotalUniformSize_DefaultBlockOnly() ),
-		uniform_info_map( &shader->GetUniformInfoMap() )
+		uniform_info_map( &shader->GetUniformInfoMap() ),
+		parameter_hash( 0 ),
+		parameter_hash_is_dirty( true )
 	{
 		ASSERT_DEBUG_ONLY( HasShaderAssigned() && "Parameter 'shader' passed to Material::Material( const std::string& name, Shader* const shader ) is nullptr!" );
 		
@@ -47,6 +67,39 @@ namespace Kakadu
 		return shader;
 	}
 
+	bool Material::IsEquivalentTo( const Material& other ) const
+	{
+		return shader == other.shader &&
+			   texture_map == other.texture_map &&
+			   uniform_blob_default_block == other.uniform_blob_default_block &&
+			   uniform_buffer_management_regular.HasEqualBlobs( other.uniform_buffer_management_regular );
+	}
+
+	std::size_t Material::ParameterHash() const
+	{
+		if( not parameter_hash_is_dirty )
+			return parameter_hash;
+
+		auto HashBytes = []( const Blob& blob )
+		{
+			const auto bytes = blob.Bytes();
+			return std::hash< std::string_view >()( std::string_view( reinterpret_cast< const char* >( bytes.data() ), bytes.size() ) );
+		};
+
+		std::size_t hash = std::hash< const void* >()( shader ) ^ HashBytes( uniform_blob_default_block );
+
+		/* Summation keeps the result independent of the iteration order of the unordered maps. */
+		for( const auto& [ uniform_buffer_id, uniform_buffer_record ] : uniform_buffer_management_regular.GetBufferRecordMap() )
+			hash += HashBytes( uniform_buffer_record.blob );
+		for( const auto& [ sampler_name, texture ] : texture_map )
+			hash += std::hash< const void* >()( texture );
+
+		parameter_hash          = hash;
+		parameter_hash_is_dirty = false;
+
+		return hash;
+	}
+
 	RHI::Shader* Material::GetShader()
 	{
 		return shader;
@@ -60,6 +113,8 @@ namespace Kakadu
 		/* Setting new data: */
 		this->shader = shader;
 
+		MarkParameterHashDirty();
+
 		uniform_blob_default_block = Blob( shader->GetTotalUniformSize_DefaultBlockOnly() );
 
 		uniform_info_map = ( &shader->GetUniformInfoMap() );
@@ -82,6 +137,7 @@ namespace Kakadu
 			uniform_blob_default_block.Allocate( needed_bytes - current_blob_capacity );
 
 		uniform_info_map = ( &shader->GetUniformInfoMap() );
+		/* Uniform Handles need no fix-up here; The Shader re-resolves them on first use after recompilation. */
 
 		const auto& uniform_buffer_info_map = shader->GetUniformBufferInfoMap_Regular();
 
@@ -89,6 +145,8 @@ namespace Kakadu
 			uniform_buffer_management_regular.RegisterBuffer_ForceUpdateBufferInfoIfBufferExists( uniform_buffer_name,
 																								  uniform_buffer_info );
 		RepopulateTextureMap();
+
+		MarkParameterHashDirty();
 	}
 #endif // _EDITOR
 
@@ -107,17 +165,21 @@ namespace Kakadu
 						   "Material::Get( const Uniform::Information& ) called to obtain value of a UBO member.\n"
 						   "Call Material::Get( const Uniform::BufferInformation& ) version instead." );
 
+		MarkParameterHashDirty(); // Caller may modify the value through the returned pointer.
+
 		return uniform_blob_default_block.Get( uniform_info.offset );
 	}
 
-	const void* Material::Get( const std::string& uniform_buffer_name ) const
+	const void* Material::Get( const StringID uniform_buffer_id ) const
 	{
-		return uniform_buffer_management_regular.Get( uniform_buffer_name );
+		return uniform_buffer_management_regular.Get( uniform_buffer_id );
 	}
 
-	void* Material::Get( const std::string& uniform_buffer_name )
+	void* Material::Get( const StringID uniform_buffer_id )
 	{
-		return uniform_buffer_management_regular.Get( uniform_buffer_name );
+		MarkParameterHashDirty(); // Caller may modify the value through the returned pointer.
+
+		return uniform_buffer_management_regular.Get( uniform_buffer_id );
 	}
 
 /*
@@ -128,6 +190,8 @@ namespace Kakadu
 
 	void Material::SetTexture( const char* sampler_name_of_new_texture, const RHI::Texture* texture_to_be_set )
 	{
+		MarkParameterHashDirty();
+
 #ifdef _EDITOR
 		if( const auto found = texture_map.find( sampler_name_of_new_texture ); 
 			found != texture_map.cend() )
@@ -191,7 +255,12 @@ namespace Kakadu
 			const auto& sampler_uniform_info = uniform_info_map->at( sampler_name );
 			const u32 texture_unit_slot      = texture_unit_slots_in_use++;
 
-			uniform_blob_default_block.Set( ( const std::byte* )&texture_unit_slot, sampler_uniform_info.offset, sampler_uniform_info.size );
+			/* Slots are the same every frame; Only the first upload (or one after a texture map change) actually changes the blob & needs to invalidate the hash. */
+			if( std::memcmp( uniform_blob_default_block.Get( sampler_uniform_info.offset ), &texture_unit_slot, sampler_uniform_info.size ) != 0 )
+			{
+				uniform_blob_default_block.Set( ( const std::byte* )&texture_unit_slot, sampler_uniform_info.offset, sampler_uniform_info.size );
+				MarkParameterHashDirty();
+			}
 
 			texture.Activate( texture_unit_slot );
 		};
@@ -230,6 +299,7 @@ namespace Kakadu
 		for( const auto& [ uniform_name, uniform_info ] : *uniform_info_map )
 			if( uniform_info.type == RHI::DataType::Sampler2D ||
 				uniform_info.type == RHI::DataType::Sampler2DMS ||
+				uniform_info.type == RHI::DataType::Sampler2DArray ||
 				uniform_info.type == RHI::DataType::SamplerCube )
 				texture_map.emplace( uniform_name, nullptr );
 	}
@@ -241,6 +311,7 @@ namespace Kakadu
 		for( const auto& [ uniform_name, uniform_info ] : *uniform_info_map )
 			if( ( uniform_info.type == RHI::DataType::Sampler2D ||
 				  uniform_info.type == RHI::DataType::Sampler2DMS ||
+				  uniform_info.type == RHI::DataType::Sampler2DArray ||
 				  uniform_info.type == RHI::DataType::SamplerCube ) &&
 				not texture_map.contains( uniform_name ) )
 				texture_map.emplace( uniform_name, nullptr );
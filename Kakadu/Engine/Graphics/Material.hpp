@@ -1,6 +1,7 @@
 #pragma once
 
 // Engine Includes.
+#include "MaterialID.h"
 #include "UniformBufferManagement.hpp"
 #include "Core/Blob.hpp"
 #include "Core/Log.h"
@@ -33,6 +34,14 @@ namespace Kakadu
 
 	/* Queries: */
 		const std::string& Name() const { return name; }
+		MaterialID Id() const { return id; }
+
+		/* Materials with the same shader, textures & uniform values are interchangeable for rendering (e.g., per-ModelInstance copies of a Model's materials).
+		 * The Renderer uses this to merge draws of different, but equivalent, Materials into a single instanced draw call. */
+		bool IsEquivalentTo( const Material& other ) const;
+		/* Hash of the state compared by IsEquivalentTo(); Equivalent Materials have equal hashes.
+		 * Cached; Only re-calculated after the shader, a uniform or a texture is changed. */
+		std::size_t ParameterHash() const;
 
 	/* Main: */
 		const RHI::Shader* Bind() const;
@@ -54,19 +63,19 @@ namespace Kakadu
 
 	/* Uniforms: */
 		const std::unordered_map< std::string, RHI::Uniform::Information			 >& GetUniformInfoMap()			const { return *uniform_info_map; }
-		const std::unordered_map< std::string, const RHI::Uniform::BufferInformation >& GetUniformBufferInfoMap()	const { return uniform_buffer_management_regular
-																																	.GetBufferInformationMap();	}
+		const auto&																		 GetUniformBufferRecordMap()	const { return uniform_buffer_management_regular
+																																	.GetBufferRecordMap();		}
 		const std::unordered_map< std::string, const RHI::Texture*					 >& GetTextureMap()				const { return texture_map; }
 
 		bool HasUniform( const std::string& uniform_name ) const { return uniform_info_map->contains( uniform_name ); }
-		bool HasUniformBuffer( const std::string& uniform_buffer_name ) const { return uniform_buffer_management_regular.GetBufferInformationMap().contains( uniform_buffer_name ); }
+		bool HasUniformBuffer( const StringID uniform_buffer_id ) const { return uniform_buffer_management_regular.HasBuffer( uniform_buffer_id ); }
 
 		const void* Get( const RHI::Uniform::Information& uniform_info ) const;
 			  void* Get( const RHI::Uniform::Information& uniform_info );
-		const void* Get( const std::string& uniform_buffer_name ) const;
-			  void* Get( const std::string& uniform_buffer_name );
+		const void* Get( const StringID uniform_buffer_id ) const;
+			  void* Get( const StringID uniform_buffer_id );
 		
-		template< typename UniformType >
+		template< typename UniformType > requires( not std::is_base_of_v< RHI::Std140StructTag, UniformType > ) // Uniform Buffer structs have their own overload below.
 		void Set( const std::string& uniform_name, const UniformType& value )
 		{
 #ifdef _EDITOR
@@ -87,9 +96,29 @@ namespace Kakadu
 			}
 #endif // _EDITOR
 
+			MarkParameterHashDirty();
 			uniform_blob_default_block.Set( value, uniform_info.offset );
 		}
 
+		/* Hot-path version of Set() above; No string hashing involved. Silently ignores uniforms that the Shader does not define. */
+		template< typename UniformType >
+		void Set( const RHI::Uniform::Handle uniform_handle, const UniformType& value )
+		{
+			if( const auto uniform_info = shader->GetUniformInformation( uniform_handle ) )
+			{
+#ifdef _EDITOR
+				if( uniform_info->size != sizeof( value ) )
+				{
+					Log::Error( R"(Material ")" + name + R"(": uniform ")" + RHI::Shader::UniformHandleName( uniform_handle ) + R"(" is being set with a type of unmatching size!)" );
+					return;
+				}
+#endif // _EDITOR
+
+				MarkParameterHashDirty();
+				uniform_blob_default_block.Set( value, uniform_info->offset );
+			}
+		}
+
 		template< typename UniformType >
 		void SetArray( const std::string& uniform_name, const UniformType* address )
 		{
@@ -111,52 +140,60 @@ namespace Kakadu
 			}
 #endif // _EDITOR
 
+			MarkParameterHashDirty();
 			uniform_blob_default_block.Set( ( std::byte* )address, uniform_info.offset, sizeof( UniformType )* uniform_info.count_array );
 		}
 
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void Set( const std::string& uniform_buffer_name, const StructType& value )
+		void Set( const StringID uniform_buffer_id, const StructType& value )
 		{
-			uniform_buffer_management_regular.Set( uniform_buffer_name, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.Set( uniform_buffer_id, value );
 		}
 
 		/* For PARTIAL setting ARRAY uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void SetPartial_Array( const std::string& uniform_buffer_name, const char* uniform_member_array_instance_name, const u32 array_index, const StructType& value )
+		void SetPartial_Array( const StringID uniform_buffer_id, const StringID uniform_member_array_instance_id, const u32 array_index, const StructType& value )
 		{
-			uniform_buffer_management_regular.SetPartial_Array( uniform_buffer_name, uniform_member_array_instance_name, array_index, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial_Array( uniform_buffer_id, uniform_member_array_instance_id, array_index, value );
 		}
 
 		/* For PARTIAL setting ARRAY uniforms INSIDE a Uniform Buffer. */
-		void SetPartial_Array( const std::string& uniform_buffer_name, const char* uniform_member_array_instance_name, const u32 array_index, const std::byte* value )
+		void SetPartial_Array( const StringID uniform_buffer_id, const StringID uniform_member_array_instance_id, const u32 array_index, const std::byte* value )
 		{
-			uniform_buffer_management_regular.SetPartial_Array( uniform_buffer_name, uniform_member_array_instance_name, array_index, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial_Array( uniform_buffer_id, uniform_member_array_instance_id, array_index, value );
 		}
 
 		/* For PARTIAL setting STRUCT uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void SetPartial_Struct( const std::string& uniform_buffer_name, const char* uniform_member_struct_instance_name, const StructType& value )
+		void SetPartial_Struct( const StringID uniform_buffer_id, const StringID uniform_member_struct_instance_id, const StructType& value )
 		{
-			uniform_buffer_management_regular.SetPartial_Struct( uniform_buffer_name, uniform_member_struct_instance_name, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial_Struct( uniform_buffer_id, uniform_member_struct_instance_id, value );
 		}
 
 		/* For PARTIAL setting STRUCT uniforms INSIDE a Uniform Buffer. */
-		void SetPartial_Struct( const std::string& uniform_buffer_name, const char* uniform_member_struct_instance_name, const std::byte* value )
+		void SetPartial_Struct( const StringID uniform_buffer_id, const StringID uniform_member_struct_instance_id, const std::byte* value )
 		{
-			uniform_buffer_management_regular.SetPartial_Struct( uniform_buffer_name, uniform_member_struct_instance_name, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial_Struct( uniform_buffer_id, uniform_member_struct_instance_id, value );
 		}
 
 		/* For PARTIAL setting NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
 		template< typename UniformType > requires( not std::is_pointer_v< UniformType > ) // Don't want to "override" the overload below for actual pointer types.
-		void SetPartial( const std::string& uniform_buffer_name, const char* uniform_member_name, const UniformType& value )
+		void SetPartial( const StringID uniform_buffer_id, const StringID uniform_member_id, const UniformType& value )
 		{
-			uniform_buffer_management_regular.SetPartial( uniform_buffer_name, uniform_member_name, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial( uniform_buffer_id, uniform_member_id, value );
 		}
 
 		/* For PARTIAL setting NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
-		void SetPartial( const std::string& uniform_buffer_name, const char* uniform_member_name, const std::byte* value )
+		void SetPartial( const StringID uniform_buffer_id, const StringID uniform_member_id, const std::byte* value )
 		{
-			uniform_buffer_management_regular.SetPartial( uniform_buffer_name, uniform_member_name, value );
+			MarkParameterHashDirty();
+			uniform_buffer_management_regular.SetPartial( uniform_buffer_id, uniform_member_id, value );
 		}
 
 	/* Textures: */
@@ -195,11 +232,33 @@ namespace Kakadu
 			}
 #endif // _EDITOR
 
+			MarkParameterHashDirty();
 			uniform_blob_default_block.Set( value, uniform_info.offset );
 
 			UploadUniform( uniform_info );
 		}
 
+		/* Hot-path version of SetAndUploadUniform() above; No string hashing involved. Silently ignores uniforms that the Shader does not define. */
+		template< typename UniformType >
+		void SetAndUploadUniform( const RHI::Uniform::Handle uniform_handle, const UniformType& value ) // Renderer calls this, it has private access through friend declaration.
+		{
+			if( const auto uniform_info = shader->GetUniformInformation( uniform_handle ) )
+			{
+#ifdef _EDITOR
+				if( uniform_info->size != sizeof( value ) )
+				{
+					Log::Error( R"(Material ")" + name + R"(": uniform ")" + RHI::Shader::UniformHandleName( uniform_handle ) + R"(" is being set & uploaded with a type of unmatching size!)" );
+					return;
+				}
+#endif // _EDITOR
+
+				MarkParameterHashDirty();
+				uniform_blob_default_block.Set( value, uniform_info->offset );
+
+				UploadUniform( *uniform_info );
+			}
+		}
+
 		template< typename UniformType >
 		void SetAndUploadUniformArray( const std::string& uniform_name, const UniformType& value ) // Renderer calls this, it has private access through friend declaration.
 		{
@@ -222,11 +281,15 @@ namespace Kakadu
 			}
 #endif // _EDITOR
 
+			MarkParameterHashDirty();
 			uniform_blob_default_block.Set( value, uniform_info.offset, uniform_info.count_array );
 
 			UploadUniform( uniform_info );
 		}
 
+	/* Parameter Hash: */
+		void MarkParameterHashDirty() { parameter_hash_is_dirty = true; }
+
 	/* Texture: */
 		void PopulateTextureMap();
 		void RepopulateTextureMap();
@@ -234,6 +297,9 @@ namespace Kakadu
 	private:
 		std::string name;
 
+		MaterialID id; // Unique per Material instance; Used for sorting draws.
+		/* 4 bytes of padding. */
+
 		RHI::Shader* shader;
 
 		/* Allocated/Resized only when a shader is assigned. 
@@ -246,5 +312,8 @@ namespace Kakadu
 		UniformBufferManagement< Blob > uniform_buffer_management_regular; // Read above for why this does not use a DirtyBlob instead of a regular Blob.
 
 		std::unordered_map< std::string, const RHI::Texture* > texture_map;
+
+		mutable std::size_t parameter_hash;
+		mutable bool parameter_hash_is_dirty;
 	};
 }
@@ -0,0 +1,11 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/ID.codegen.h"
+
+namespace Kakadu
+{
+	DEFINE_ID( Material );
+}
+
+#undef DEFINE_ID
@@ -9,8 +9,11 @@ namespace Kakadu
 {
 	Mesh::Mesh()
 		:
+		has_cpu_side_data( true ),
 		primitive_type( RHI::Primitive::Triangles ),
-		instance_count( 0 )
+		instance_count( 0 ),
+		instance_transform_offset( -1 ),
+		instance_stride( 0 )
 	{}
 
 	Mesh::Mesh( const std::span< const Vector3	> positions, 
@@ -20,7 +23,8 @@ namespace Kakadu
 				const std::span< const u32		> indices, 
 				const std::span< const Vector4	> tangents, 
 				const RHI::Primitive			  primitive_type,
-				const RHI::Usage				  usage )
+				const RHI::Usage				  usage,
+				GeometryPool*					  geometry_pool )
 		:
 		name( name ),
 		indices( indices.begin(), indices.end() ),
@@ -28,8 +32,12 @@ namespace Kakadu
 		normals( normals.begin(), normals.end() ),
 		tangents( tangents.begin(), tangents.end() ),
 		uvs( uvs.begin(), uvs.end() ),
+		has_cpu_side_data( true ),
 		primitive_type( primitive_type ),
-		instance_count( 1 )
+		instance_count( 1 ),
+		instance_transform_offset( -1 ),
+		instance_stride( 0 ),
+		bounds( Math::AABB::FromPoints( positions ) )
 	{
 #ifdef _EDITOR
 		if( normals.size() != tangents.size() )
@@ -39,15 +47,9 @@ namespace Kakadu
 		u32 vertex_count_interleaved;
 		const auto interleaved_vertices = MeshUtility::Interleave( vertex_count_interleaved, positions, normals, uvs, tangents );
 
-		vertex_buffer = RHI::Buffer( RHI::BufferType::Vertex, vertex_count_interleaved, std::as_bytes( std::span( interleaved_vertices ) ), name, usage );
 		vertex_layout = RHI::VertexLayout( GatherAttributes( positions, normals, uvs, tangents ) );
-		index_buffer  = indices.empty() ? std::nullopt : std::optional< RHI::Buffer >( std::in_place,
-																					   RHI::BufferType::Index,
-																					   ( u32 )indices.size(),
-																					   std::as_bytes( std::span( indices ) ),
-																					   name,
-																					   usage );
-		vertex_array  = RHI::VertexArray( vertex_buffer, vertex_layout, index_buffer, name );
+
+		CreateGeometry( std::as_bytes( std::span( interleaved_vertices ) ), vertex_count_interleaved, this->indices, usage, geometry_pool );
 	}
 
 	Mesh::Mesh( std::vector< Vector3 >&&	positions,
@@ -57,7 +59,8 @@ namespace Kakadu
 				std::vector< u32	 >&&	indices,
 				std::vector< Vector4 >&&	tangents,
 				const RHI::Primitive		primitive_type,
-				const RHI::Usage			usage )
+				const RHI::Usage			usage,
+				GeometryPool*				geometry_pool )
 		:
 		name( name ),
 		indices( indices ),
@@ -65,21 +68,45 @@ namespace Kakadu
 		normals( normals ),
 		tangents( tangents ),
 		uvs( uvs ),
+		has_cpu_side_data( true ),
 		primitive_type( primitive_type ),
-		instance_count( 1 )
+		instance_count( 1 ),
+		instance_transform_offset( -1 ),
+		instance_stride( 0 ),
+		bounds( Math::AABB::FromPoints( this->positions ) )
 	{
 		u32 vertex_count_interleaved;
 		const auto interleaved_vertices = MeshUtility::Interleave( vertex_count_interleaved, positions, normals, uvs, tangents );
 
-		vertex_buffer = RHI::Buffer( RHI::BufferType::Vertex, vertex_count_interleaved, std::as_bytes( std::span( interleaved_vertices ) ), name, usage );
 		vertex_layout = RHI::VertexLayout( GatherAttributes( positions, normals, uvs, tangents ) );
-		index_buffer  = indices.empty() ? std::nullopt : std::optional< RHI::Buffer >( std::in_place,
-																					   RHI::BufferType::Index,
-																					   ( u32 )indices.size(),
-																					   std::as_bytes( std::span( indices ) ),
-																					   name,
-																					   usage );
-		vertex_array  = RHI::VertexArray( vertex_buffer, vertex_layout, index_buffer, name );
+
+		CreateGeometry( std::as_bytes( std::span( interleaved_vertices ) ), vertex_count_interleaved, this->indices, usage, geometry_pool );
+	}
+
+	Mesh::Mesh( const std::span< const float >	interleaved_vertices,
+				const u32						vertex_count,
+				const std::array< i32, 4 >&		attribute_component_counts,
+				const std::span< const u32 >	indices,
+				const Math::AABB&				bounds,
+				const std::string&				name,
+				const RHI::Primitive			primitive_type,
+				const RHI::Usage				usage,
+				GeometryPool*					geometry_pool )
+		:
+		name( name ),
+		has_cpu_side_data( false ),
+		primitive_type( primitive_type ),
+		instance_count( 1 ),
+		instance_transform_offset( -1 ),
+		instance_stride( 0 ),
+		bounds( bounds )
+	{
+		vertex_layout = RHI::VertexLayout( GatherAttributes( attribute_component_counts ) );
+
+		ASSERT_DEBUG_ONLY( interleaved_vertices.size_bytes() == ( std::size_t )vertex_count * vertex_layout.Stride_NonInstanced() &&
+						   "Mesh: Interleaved vertex data size does not match the vertex count & attributes!" );
+
+		CreateGeometry( std::as_bytes( interleaved_vertices ), vertex_count, indices, usage, geometry_pool );
 	}
 
 	Mesh::Mesh( const Mesh& other,
@@ -94,15 +121,30 @@ namespace Kakadu
 		normals( other.normals ),
 		tangents( other.tangents ),
 		uvs( other.uvs ),
+		has_cpu_side_data( other.has_cpu_side_data ),
 		primitive_type( other.primitive_type ),
 		instance_count( instance_count ),
+		instance_transform_offset( -1 ),
+		instance_stride( 0 ),
+		bounds( other.bounds ),
 		vertex_buffer( other.vertex_buffer ),
 		vertex_layout( other.vertex_layout ),
 		index_buffer( other.index_buffer )
 	{
+		ASSERT_DEBUG_ONLY( not other.IsPooled() && "Instanced Meshes can not be created from pooled Meshes, as they need a VertexArray of their own!" );
+
 		for( auto instanced_attribute_iterator = instanced_attributes.begin(); instanced_attribute_iterator != instanced_attributes.end(); instanced_attribute_iterator++ )
+		{
 			vertex_layout.Push( *instanced_attribute_iterator );
 
+			if( instanced_attribute_iterator->location == INSTANCE_WORLD_TRANSFORM_LOCATION && instanced_attribute_iterator->type == RHI::DataType::Float4x4 )
+				instance_transform_offset = ( i32 )instance_stride;
+
+			instance_stride += instanced_attribute_iterator->Size();
+		}
+
+		bounds_instanced = CalculateInstanceBounds( reinterpret_cast< const std::byte* >( instance_data.data() ), instance_data.size() * sizeof( float ) );
+
 		instance_buffer = std::optional< RHI::Buffer >( std::in_place,
 														RHI::BufferType::Instance,
 														instance_count,
@@ -118,12 +160,18 @@ namespace Kakadu
 
 	void Mesh::Upload( const void* data ) const
 	{
-		vertex_buffer.Upload( data );
+		if( pool_allocation )
+			pool_allocation.UploadVertices_Partial( std::span( static_cast< const std::byte* >( data ), pool_allocation.VertexCount() * vertex_layout.Stride_NonInstanced() ), 0 );
+		else
+			vertex_buffer.Upload( data );
 	}
 
 	void Mesh::Upload_Partial( const std::span< std::byte > data_span, const std::size_t offset_from_buffer_start ) const
 	{
-		vertex_buffer.Upload_Partial( data_span, offset_from_buffer_start );
+		if( pool_allocation )
+			pool_allocation.UploadVertices_Partial( data_span, offset_from_buffer_start );
+		else
+			vertex_buffer.Upload_Partial( data_span, offset_from_buffer_start );
 	}
 
 	void Mesh::UpdateInstanceData( const void* data ) const
@@ -131,6 +179,8 @@ namespace Kakadu
 		ASSERT_DEBUG_ONLY( instance_buffer && "UpdateInstanceData() called on non-instanced Mesh!" );
 
 		instance_buffer->Upload( data );
+
+		bounds_instanced = CalculateInstanceBounds( static_cast< const std::byte* >( data ), instance_count * instance_stride );
 	}
 
 	void Mesh::UpdateInstanceData_Partial( const std::span< std::byte > data_span, const std::size_t offset_from_buffer_start ) const
@@ -138,6 +188,31 @@ namespace Kakadu
 		ASSERT_DEBUG_ONLY( instance_buffer && "UpdateInstanceData_Partial() called on non-instanced Mesh!" );
 
 		instance_buffer->Upload_Partial( data_span, offset_from_buffer_start );
+
+		/* Only the updated instances are known here; Grow the bounds instead of recalculating them. Stays conservative (never shrinks) until the next full update. */
+		if( offset_from_buffer_start % instance_stride == 0 && data_span.size_bytes() % instance_stride == 0 )
+			bounds_instanced.Merge( CalculateInstanceBounds( data_span.data(), data_span.size_bytes() ) );
+		else
+			bounds_instanced = Math::AABB::Infinite();
+	}
+
+	void Mesh::CreateGeometry( const std::span< const std::byte > interleaved_vertices, const u32 vertex_count, const std::span< const u32 > indices,
+							   const RHI::Usage usage, GeometryPool* geometry_pool )
+	{
+		if( geometry_pool && not indices.empty() )
+		{
+			pool_allocation = geometry_pool->Allocate( vertex_layout, vertex_count, interleaved_vertices, indices );
+			return;
+		}
+
+		vertex_buffer = RHI::Buffer( RHI::BufferType::Vertex, vertex_count, interleaved_vertices, name, usage );
+		index_buffer  = indices.empty() ? std::nullopt : std::optional< RHI::Buffer >( std::in_place,
+																					   RHI::BufferType::Index,
+																					   ( u32 )indices.size(),
+																					   std::as_bytes( indices ),
+																					   name,
+																					   usage );
+		vertex_array  = RHI::VertexArray( vertex_buffer, vertex_layout, index_buffer, name );
 	}
 
 	std::array< RHI::VertexAttribute, 4 > Mesh::GatherAttributes( const std::span< const Vector3 >& positions,
@@ -157,4 +232,40 @@ namespace Kakadu
 			  RHI::VertexAttribute{ CountOf( tangents ),	RHI::DataType::Float,	is_instanced, TANGENT_LOCATION		},
 		} );
 	}
+
+	std::array< RHI::VertexAttribute, 4 > Mesh::GatherAttributes( const std::array< i32, 4 >& attribute_component_counts )
+	{
+		constexpr bool is_instanced = false;
+
+		return std::array< RHI::VertexAttribute, 4 >
+		( {
+			  RHI::VertexAttribute{ attribute_component_counts[ 0 ],	RHI::DataType::Float,	is_instanced, POSITION_LOCATION		},
+			  RHI::VertexAttribute{ attribute_component_counts[ 1 ],	RHI::DataType::Float,	is_instanced, NORMAL_LOCATION		},
+			  RHI::VertexAttribute{ attribute_component_counts[ 2 ],	RHI::DataType::Float,	is_instanced, TEXCOORDS_LOCATION	},
+			  RHI::VertexAttribute{ attribute_component_counts[ 3 ],	RHI::DataType::Float,	is_instanced, TANGENT_LOCATION		},
+		} );
+	}
+
+	Math::AABB Mesh::CalculateInstanceBounds( const std::byte* instance_data, const std::size_t instance_data_size ) const
+	{
+		if( instance_transform_offset < 0 || instance_stride == 0 || instance_data == nullptr )
+			return Math::AABB::Infinite();
+
+		Math::AABB instance_bounds;
+
+		for( std::size_t offset = 0; offset + instance_stride <= instance_data_size; offset += instance_stride )
+		{
+			/* Instance transforms are uploaded transposed (vertex attribute matrices' major can not be flipped in GLSL), so transpose back while reading. */
+			const float* transform_floats = reinterpret_cast< const float* >( instance_data + offset + instance_transform_offset );
+
+			Matrix4x4 world_transform;
+			for( auto row = 0; row < 4; row++ )
+				for( auto column = 0; column < 4; column++ )
+					world_transform.data[ row ][ column ] = transform_floats[ column * 4 + row ];
+
+			instance_bounds.Merge( bounds.Transformed( world_transform ) );
+		}
+
+		return instance_bounds;
+	}
 }
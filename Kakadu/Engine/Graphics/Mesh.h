@@ -1,6 +1,8 @@
 #pragma once
 
 // Engine Includes.
+#include "GeometryPool.h"
+#include "Math/AABB.h"
 #include "Math/Vector.hpp"
 #include "RHI/Primitive.h"
 #include "RHI/Usage.h"
@@ -26,7 +28,8 @@ namespace Kakadu
 			  const std::span< const u32		> indices		 = {},
 			  const std::span< const Vector4	> tangents		 = {},
 			  const RHI::Primitive				  primitive_type = RHI::Primitive::Triangles,
-			  const RHI::Usage					  usage          = RHI::Usage::StaticDraw );
+			  const RHI::Usage					  usage          = RHI::Usage::StaticDraw,
+			  GeometryPool*						  geometry_pool  = nullptr );
 
 		Mesh( std::vector< Vector3	>&& positions,
 			  const std::string&		name		   = {},
@@ -35,7 +38,21 @@ namespace Kakadu
 			  std::vector< u32		>&& indices		   = {},
 			  std::vector< Vector4	>&& tangents	   = {},
 			  const RHI::Primitive		primitive_type = RHI::Primitive::Triangles,
-			  const RHI::Usage			usage          = RHI::Usage::StaticDraw );
+			  const RHI::Usage			usage          = RHI::Usage::StaticDraw,
+			  GeometryPool*				geometry_pool  = nullptr );
+
+		/* Constructs from already interleaved vertex data (e.g., a memory-mapped cooked Model), which is uploaded as is.
+		 * attribute_component_counts are in (position, normal, uv, tangent) order; 0 means the attribute is absent.
+		 * Unlike the other constructors, no CPU-side copies of the vertex attributes & indices are kept (see HasCpuSideData()). */
+		Mesh( const std::span< const float >	interleaved_vertices,
+			  const u32							vertex_count,
+			  const std::array< i32, 4 >&		attribute_component_counts,
+			  const std::span< const u32 >		indices,
+			  const Math::AABB&					bounds,
+			  const std::string&				name		   = {},
+			  const RHI::Primitive				primitive_type = RHI::Primitive::Triangles,
+			  const RHI::Usage					usage          = RHI::Usage::StaticDraw,
+			  GeometryPool*						geometry_pool  = nullptr );
 
 		Mesh( const Mesh& other,
 			  const std::initializer_list< RHI::VertexInstanceAttribute > instanced_attributes,
@@ -49,7 +66,7 @@ namespace Kakadu
 	 * Usage:
 	 */
 
-		void Bind() const { vertex_array.Bind(); }
+		void Bind() const { pool_allocation ? pool_allocation.VertexArray().Bind() : vertex_array.Bind(); }
 		void Upload( const void* data ) const;
 		void Upload_Partial( const std::span< std::byte > data_span, const std::size_t offset_from_buffer_start ) const;
 		void UpdateInstanceData( const void* data ) const;
@@ -71,42 +88,75 @@ namespace Kakadu
 
 		RHI::Primitive Primitive() const { return primitive_type; }
 
-		i32 VertexCount() const { return vertex_buffer.count; }
-		i32 IndexCount()  const { return index_buffer.has_value() ? index_buffer->count : 0; }
+		i32 VertexCount() const { return pool_allocation ? pool_allocation.VertexCount() : vertex_buffer.count; }
+		i32 IndexCount()  const { return pool_allocation ? pool_allocation.IndexCount()  : index_buffer.has_value() ? index_buffer->count : 0; }
 
 		bool HasIndices() const { return IndexCount(); }
 
+		/* Pooled Meshes share the VertexArray of their GeometryPool page. */
+		RHI::VertexArrayID VertexArrayId() const { return pool_allocation ? pool_allocation.VertexArray().Id() : vertex_array.Id(); }
+
+		/* Whether the geometry lives in a GeometryPool page instead of the Mesh's own buffers. Only indexed, non-instanced Meshes can be pooled. */
+		bool IsPooled()   const { return ( bool )pool_allocation; }
+		/* Offsets into the shared buffers of the GeometryPool page; Both are zero for non-pooled Meshes. */
+		i32 BaseVertex()  const { return pool_allocation.BaseVertex(); }
+		u32 FirstIndex()  const { return pool_allocation.FirstIndex(); }
+
 		bool HasInstancing() const { return ( bool )instance_buffer; }
 		i32 InstanceCount()  const { return instance_count; }
 
 		bool IsCompatibleWith( const RHI::VertexLayout& other_vertex_layout ) const { return vertex_layout.IsCompatibleWith( other_vertex_layout ); }
 
+		/* Object-space bounds of the vertex positions. */
+		const Math::AABB& Bounds() const { return bounds; }
+		/* World-space bounds enclosing all instances; Only meaningful for instanced Meshes.
+		 * Derived from the per-instance world transform attribute (INSTANCE_WORLD_TRANSFORM_LOCATION) when present, infinite otherwise (=> never culled).
+		 * Partial instance data updates can only grow these bounds, so they stay conservative. */
+		const Math::AABB& Bounds_Instanced() const { return bounds_instanced; }
+
 	/*
 	 * Index Data:
 	 */
 
-		const std::vector< u32 >&	Indices()		const { return indices; };
-		const u32*					Indices_Raw()	const { return indices.data(); };
+		/* Whether the CPU-side copies of the vertex attributes & indices below are available.
+		 * Meshes constructed from already interleaved vertex data (e.g., cooked Models) do not keep them; Their accessors assert in that case. */
+		bool HasCpuSideData() const { return has_cpu_side_data; }
+
+		const std::vector< u32 >&	Indices()		const { AssertCpuSideData(); return indices; };
+		const u32*					Indices_Raw()	const { AssertCpuSideData(); return indices.data(); };
 
 	/*
 	 * Vertex Data:
 	 */
 
-		const std::vector< Vector3 >& Positions()	const { return positions;	};
-		const std::vector< Vector3 >& Normals()		const { return normals;		};
-		const std::vector< Vector4 >& Tangents()	const { return tangents;	};
-		const std::vector< Vector2 >& Uvs()			const { return uvs;		};
+		const std::vector< Vector3 >& Positions()	const { AssertCpuSideData(); return positions;	};
+		const std::vector< Vector3 >& Normals()		const { AssertCpuSideData(); return normals;		};
+		const std::vector< Vector4 >& Tangents()	const { AssertCpuSideData(); return tangents;	};
+		const std::vector< Vector2 >& Uvs()			const { AssertCpuSideData(); return uvs;		};
 
-		const float* Positions_Raw()	const { return reinterpret_cast< const float* >( positions.data()	); };
-		const float* Normals_Raw()		const { return reinterpret_cast< const float* >( normals.data()		); };
-		const float* Tangents_Raw()		const { return reinterpret_cast< const float* >( tangents.data()	); };
-		const float* Uvs_Raw()			const { return reinterpret_cast< const float* >( uvs.data()			); };
+		const float* Positions_Raw()	const { AssertCpuSideData(); return reinterpret_cast< const float* >( positions.data()	); };
+		const float* Normals_Raw()		const { AssertCpuSideData(); return reinterpret_cast< const float* >( normals.data()		); };
+		const float* Tangents_Raw()		const { AssertCpuSideData(); return reinterpret_cast< const float* >( tangents.data()	); };
+		const float* Uvs_Raw()			const { AssertCpuSideData(); return reinterpret_cast< const float* >( uvs.data()			); };
 
 	private:
+		/* Puts the vertex & index data either into the given GeometryPool (if any & the Mesh is indexed) or into buffers owned by this Mesh. */
+		void CreateGeometry( const std::span< const std::byte > interleaved_vertices, const u32 vertex_count, const std::span< const u32 > indices,
+							 const RHI::Usage usage, GeometryPool* geometry_pool );
+
 		static std::array< RHI::VertexAttribute, 4 > GatherAttributes( const std::span< const Vector3 >& positions,
 																	   const std::span< const Vector3 >& normals,
 																	   const std::span< const Vector2 >& uvs,
 																	   const std::span< const Vector4 >& tangents );
+		static std::array< RHI::VertexAttribute, 4 > GatherAttributes( const std::array< i32, 4 >& attribute_component_counts );
+
+		void AssertCpuSideData() const
+		{
+			ASSERT_DEBUG_ONLY( has_cpu_side_data && "Mesh: CPU-side vertex/index data is not kept for Meshes constructed from interleaved vertex data!" );
+		}
+
+		/* Returns the bounds of the given (whole) instances. Only valid if the instance data contains a world transform. */
+		Math::AABB CalculateInstanceBounds( const std::byte* instance_data, const std::size_t instance_data_size ) const;
 
  	private:
 		std::string name;
@@ -118,14 +168,24 @@ namespace Kakadu
 		std::vector< Vector4 > tangents;
 		std::vector< Vector2 > uvs;
 
+		bool has_cpu_side_data;
+
 		RHI::Primitive primitive_type;
 
 		i32 instance_count;
 
+		/* Byte offset of the world transform inside a single instance's data; -1 if instance data has no world transform. */
+		i32 instance_transform_offset;
+		u32 instance_stride;
+
+		Math::AABB bounds;
+		mutable Math::AABB bounds_instanced;
+
 		RHI::Buffer vertex_buffer;
 		RHI::VertexLayout vertex_layout;
 		std::optional< RHI::Buffer > index_buffer;
 		std::optional< RHI::Buffer > instance_buffer;
 		RHI::VertexArray vertex_array;
+		GeometryPool::Allocation pool_allocation;
 	};
 }
\ No newline at end of file
@@ -23,6 +23,12 @@ namespace Kakadu
 		struct ImportSettings
 		{
 			RHI::Usage usage = RHI::Usage::StaticDraw;
+			/* Sub-allocates the (indexed) Meshes from the shared GeometryPool, so that they can be drawn with fewer VAO switches & indirect multi-draws. */
+			bool use_geometry_pool = false;
+			/* Returns placeholder textures right away & decodes/uploads the actual images in the background (see RHI::Texture::IsLoading()). */
+			bool load_textures_asynchronously = false;
+			/* Loads from/stores to a cooked binary file next to the source (see ModelCache), skipping the glTF import altogether when it is up to date. */
+			bool use_cooked_cache = true;
 		};
 
 		static constexpr ImportSettings DEFAULT_IMPORT_SETTINGS = {};
@@ -53,6 +59,7 @@ namespace Kakadu
 		{
 			std::string name;
 			std::vector< MeshInfo > mesh_infos;
+			Math::AABB bounds; // Union of all Meshes' bounds, in the owning Node's local space.
 		};
 
 		/* Same as a glTF "node". */
@@ -78,6 +85,7 @@ namespace Kakadu
 
 		friend class AssetDatabase< Model >;
 		friend class Loader;
+		friend class ModelCache;
 
 	public:
 		Model();
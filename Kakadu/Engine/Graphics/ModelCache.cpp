@@ -0,0 +1,373 @@
+// Engine Includes.
+#include "ModelCache.h"
+#include "Core/AssetDatabase.hpp"
+#include "Core/CookedFile.hpp"
+#include "Core/Log.h"
+#include "Core/MemoryMappedFile.h"
+#include "Core/ServiceLocator.hpp"
+
+// std Includes.
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace Kakadu
+{
+	constexpr u32 COOKED_MODEL_MAGIC          = 'K' | ( 'K' << 8 ) | ( 'M' << 16 ) | ( 'C' << 24 );
+	/* Bump whenever the layout below or the import (coordinate conversion, tangent generation etc.) changes. */
+	constexpr u32 COOKED_MODEL_FORMAT_VERSION = 1;
+
+	/*
+	 * Cooked file layout (native endianness, arrays are aligned to their element type):
+	 *
+	 * Header:		magic, version, settings key, source size, source hash, dependencies (path, size, last write time).
+	 * Textures:	name, import settings, file path OR encoded bytes.
+	 * Materials:	name, albedo texture index, normal texture index, optional albedo color.
+	 * Meshes:		name, vertex count, attribute component counts, bounds, interleaved vertices, indices.
+	 * MeshGroups:	name, bounds, mesh infos (name, mesh index, material info index).
+	 * Nodes:		name, local transform, mesh group index, children.
+	 * Top-level node indices & the mesh instance count.
+	 */
+
+	/* None of the current Model::ImportSettings change the cooked data (they only affect how GL resources are created from it);
+	 * Any setting that does in the future has to be folded in here. */
+	internal_function u64 CookedSettingsKey( const Model::ImportSettings& import_settings )
+	{
+		return 0;
+	}
+
+	internal_function i64 LastWriteTime( const std::filesystem::path& file_path )
+	{
+		std::error_code error_code;
+		const auto last_write_time = std::filesystem::last_write_time( file_path, error_code );
+		return error_code ? -1 : ( i64 )last_write_time.time_since_epoch().count();
+	}
+
+	internal_function u64 FileSize( const std::filesystem::path& file_path )
+	{
+		std::error_code error_code;
+		const auto file_size = std::filesystem::file_size( file_path, error_code );
+		return error_code ? ~0ull : ( u64 )file_size;
+	}
+
+	std::filesystem::path ModelCache::CookedFilePath( const std::filesystem::path& source_file_path )
+	{
+		std::filesystem::path cooked_file_path( source_file_path );
+		cooked_file_path += ".cooked";
+		return cooked_file_path;
+	}
+
+	std::optional< Model > ModelCache::Load( const std::string& source_file_path, const Model::ImportSettings& import_settings )
+	{
+		const MemoryMappedFile cooked_file( CookedFilePath( source_file_path ) );
+		if( not cooked_file.IsValid() )
+			return std::nullopt;
+
+		CookedFileReader reader( cooked_file.Bytes() );
+
+		/*
+		 * Header & validation:
+		 */
+
+		if( reader.Read< u32 >() != COOKED_MODEL_MAGIC ||
+			reader.Read< u32 >() != COOKED_MODEL_FORMAT_VERSION ||
+			reader.Read< u64 >() != CookedSettingsKey( import_settings ) )
+			return std::nullopt;
+
+		{
+			const MemoryMappedFile source_file( source_file_path );
+			if( not source_file.IsValid() ||
+				reader.Read< u64 >() != ( u64 )source_file.Size() ||
+				reader.Read< u64 >() != HashBytes( source_file.Bytes() ) )
+				return std::nullopt;
+		}
+
+		const u32 dependency_count = reader.Read< u32 >();
+		for( u32 i = 0; i < dependency_count && not reader.Failed(); i++ )
+		{
+			const std::filesystem::path dependency_path( reader.ReadString() );
+			if( reader.Read< u64 >() != FileSize( dependency_path ) ||
+				reader.Read< i64 >() != LastWriteTime( dependency_path ) )
+				return std::nullopt;
+		}
+
+		/*
+		 * Body:
+		 * Parse everything first (strings & arrays are views into the mapping), so that nothing is created for truncated/corrupt files.
+		 */
+
+		struct TextureEntry { std::string_view name; RHI::Texture::ImportSettings import_settings; std::string_view file_path; std::span< const std::byte > encoded_bytes; };
+		struct MaterialEntry { std::string_view name; i32 albedo_texture_index; i32 normal_texture_index; bool has_color_albedo; Color3 color_albedo; };
+		struct MeshEntry { std::string_view name; u32 vertex_count; std::array< i32, 4 > attribute_component_counts; Math::AABB bounds;
+						   std::span< const float > interleaved_vertices; std::span< const u32 > indices; };
+		struct MeshInfoEntry { std::string_view name; u32 mesh_index; i32 material_info_index; };
+		struct MeshGroupEntry { std::string_view name; Math::AABB bounds; std::vector< MeshInfoEntry > mesh_infos; };
+		struct NodeEntry { std::string_view name; Matrix4x4 transform_local; i32 mesh_group_index; std::span< const i32 > children; };
+
+		std::vector< TextureEntry > texture_entries( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+		for( auto& entry : texture_entries )
+		{
+			entry.name            = reader.ReadString();
+			entry.import_settings = reader.Read< RHI::Texture::ImportSettings >();
+			entry.file_path       = reader.ReadString();
+			entry.encoded_bytes   = reader.ReadArray< std::byte >();
+		}
+
+		std::vector< MaterialEntry > material_entries( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+		for( auto& entry : material_entries )
+		{
+			entry.name                 = reader.ReadString();
+			entry.albedo_texture_index = reader.Read< i32 >();
+			entry.normal_texture_index = reader.Read< i32 >();
+			entry.has_color_albedo     = reader.Read< bool >();
+			entry.color_albedo         = reader.Read< Color3 >();
+		}
+
+		std::vector< MeshEntry > mesh_entries( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+		for( auto& entry : mesh_entries )
+		{
+			entry.name                       = reader.ReadString();
+			entry.vertex_count               = reader.Read< u32 >();
+			entry.attribute_component_counts = reader.Read< std::array< i32, 4 > >();
+			entry.bounds                     = reader.Read< Math::AABB >();
+			entry.interleaved_vertices       = reader.ReadArray< float >();
+			entry.indices                    = reader.ReadArray< u32 >();
+		}
+
+		std::vector< MeshGroupEntry > mesh_group_entries( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+		for( auto& entry : mesh_group_entries )
+		{
+			entry.name   = reader.ReadString();
+			entry.bounds = reader.Read< Math::AABB >();
+			entry.mesh_infos.resize( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+			for( auto& mesh_info_entry : entry.mesh_infos )
+			{
+				mesh_info_entry.name                = reader.ReadString();
+				mesh_info_entry.mesh_index          = reader.Read< u32 >();
+				mesh_info_entry.material_info_index = reader.Read< i32 >();
+
+				if( mesh_info_entry.mesh_index >= mesh_entries.size() )
+					return std::nullopt;
+			}
+		}
+
+		std::vector< NodeEntry > node_entries( std::min( reader.Read< u32 >(), ( u32 )cooked_file.Size() ) );
+		for( auto& entry : node_entries )
+		{
+			entry.name             = reader.ReadString();
+			entry.transform_local  = reader.Read< Matrix4x4 >();
+			entry.mesh_group_index = reader.Read< i32 >();
+			entry.children         = reader.ReadArray< i32 >();
+
+			if( entry.mesh_group_index >= ( i32 )mesh_group_entries.size() )
+				return std::nullopt;
+		}
+
+		const auto top_level_node_indices = reader.ReadArray< u64 >();
+		const i32 mesh_instance_count     = reader.Read< i32 >();
+
+		if( reader.Failed() )
+		{
+			Log::Warning( "Cooked model file for \"" + source_file_path + "\" is corrupt; Re-importing the source." );
+			return std::nullopt;
+		}
+
+		/*
+		 * Creation:
+		 */
+
+		auto& texture_database = ServiceLocator< AssetDatabase< RHI::Texture > >::Get();
+
+		Model model( std::filesystem::path( source_file_path ).stem().string() );
+
+		model.textures.reserve( texture_entries.size() );
+		for( const auto& entry : texture_entries )
+		{
+			const std::string name( entry.name );
+
+			RHI::Texture* texture = nullptr;
+			if( not entry.file_path.empty() )
+				texture = import_settings.load_textures_asynchronously
+					? texture_database.CreateAssetFromFile_Async( name, std::string( entry.file_path ), entry.import_settings )
+					: texture_database.CreateAssetFromFile( name, std::string( entry.file_path ), entry.import_settings );
+			else
+				texture = import_settings.load_textures_asynchronously
+					? texture_database.CreateAssetFromFileBytes_Async( name, entry.encoded_bytes.data(), ( i32 )entry.encoded_bytes.size(), entry.import_settings )
+					: texture_database.CreateAssetFromFileBytes( name, entry.encoded_bytes.data(), ( i32 )entry.encoded_bytes.size(), entry.import_settings );
+
+			if( not texture )
+				return std::nullopt;
+
+			model.textures.push_back( texture );
+		}
+
+		auto TextureAt = [ & ]( const i32 index ) { return index >= 0 && index < ( i32 )model.textures.size() ? model.textures[ index ] : nullptr; };
+
+		model.material_infos.reserve( material_entries.size() );
+		for( const auto& entry : material_entries )
+		{
+			auto& material_info = model.material_infos.emplace_back();
+			material_info.name           = entry.name;
+			material_info.texture_albedo = TextureAt( entry.albedo_texture_index );
+			material_info.texture_normal = TextureAt( entry.normal_texture_index );
+			if( entry.has_color_albedo )
+				material_info.color_albedo = entry.color_albedo;
+		}
+
+		GeometryPool* geometry_pool = import_settings.use_geometry_pool ? &ServiceLocator< GeometryPool >::Get() : nullptr;
+
+		/* Mesh vertex & index data are uploaded straight from the mapped file. */
+		model.meshes.reserve( mesh_entries.size() );
+		for( const auto& entry : mesh_entries )
+			model.meshes.emplace_back( entry.interleaved_vertices,
+									   entry.vertex_count,
+									   entry.attribute_component_counts,
+									   entry.indices,
+									   entry.bounds,
+									   std::string( entry.name ),
+									   RHI::Primitive::Triangles,
+									   RHI::Usage::StaticDraw,
+									   geometry_pool );
+
+		model.mesh_groups.resize( mesh_group_entries.size() );
+		for( std::size_t i = 0; i < mesh_group_entries.size(); i++ )
+		{
+			const auto& entry = mesh_group_entries[ i ];
+			auto& mesh_group  = model.mesh_groups[ i ];
+
+			mesh_group.name   = entry.name;
+			mesh_group.bounds = entry.bounds;
+			mesh_group.mesh_infos.reserve( entry.mesh_infos.size() );
+			for( const auto& mesh_info_entry : entry.mesh_infos )
+				mesh_group.mesh_infos.emplace_back( std::string( mesh_info_entry.name ), model.meshes[ mesh_info_entry.mesh_index ], mesh_info_entry.material_info_index );
+		}
+
+		model.nodes.reserve( node_entries.size() );
+		for( const auto& entry : node_entries )
+		{
+			auto& node = model.nodes.emplace_back( std::string( entry.name ),
+												   entry.transform_local,
+												   entry.mesh_group_index >= 0 ? &model.mesh_groups[ entry.mesh_group_index ] : nullptr );
+			node.children.assign( entry.children.begin(), entry.children.end() );
+		}
+
+		model.node_indices_top_level.assign( top_level_node_indices.begin(), top_level_node_indices.end() );
+		model.mesh_instance_count = mesh_instance_count;
+
+		return model;
+	}
+
+	bool ModelCache::Store( const Model& model,
+							const std::string& source_file_path,
+							const std::vector< std::filesystem::path >& external_dependencies,
+							const Model::ImportSettings& import_settings,
+							const std::span< const TextureSource > texture_sources,
+							const std::span< const MeshData > mesh_data )
+	{
+		ASSERT_DEBUG_ONLY( texture_sources.size() == model.textures.size() && mesh_data.size() == model.meshes.size() );
+
+		CookedFileWriter writer;
+
+		/*
+		 * Header:
+		 */
+
+		writer.Write( COOKED_MODEL_MAGIC );
+		writer.Write( COOKED_MODEL_FORMAT_VERSION );
+		writer.Write( CookedSettingsKey( import_settings ) );
+
+		{
+			const MemoryMappedFile source_file( source_file_path );
+			if( not source_file.IsValid() )
+				return false;
+
+			writer.Write( ( u64 )source_file.Size() );
+			writer.Write( HashBytes( source_file.Bytes() ) );
+		}
+
+		writer.Write( ( u32 )external_dependencies.size() );
+		for( const auto& dependency_path : external_dependencies )
+		{
+			writer.WriteString( dependency_path.string() );
+			writer.Write( FileSize( dependency_path ) );
+			writer.Write( LastWriteTime( dependency_path ) );
+		}
+
+		/*
+		 * Body:
+		 */
+
+		auto IndexOf = [ & ]( const RHI::Texture* texture ) -> i32
+		{
+			const auto it = std::find( model.textures.cbegin(), model.textures.cend(), texture );
+			return texture && it != model.textures.cend() ? ( i32 )std::distance( model.textures.cbegin(), it ) : -1;
+		};
+
+		writer.Write( ( u32 )model.textures.size() );
+		for( std::size_t i = 0; i < model.textures.size(); i++ )
+		{
+			/* Textures that were never renamed after a material get a fresh unique name upon loading, just like when importing. */
+			const std::string& name = model.textures[ i ]->Name();
+			writer.WriteString( name.starts_with( '<' ) ? std::string_view() : std::string_view( name ) );
+			writer.Write( texture_sources[ i ].import_settings );
+			writer.WriteString( texture_sources[ i ].file_path );
+			writer.WriteArray( texture_sources[ i ].file_path.empty() ? texture_sources[ i ].encoded_bytes : std::span< const std::byte >() );
+		}
+
+		writer.Write( ( u32 )model.material_infos.size() );
+		for( const auto& material_info : model.material_infos )
+		{
+			writer.WriteString( material_info.name );
+			writer.Write( IndexOf( material_info.texture_albedo ) );
+			writer.Write( IndexOf( material_info.texture_normal ) );
+			writer.Write( material_info.color_albedo.has_value() );
+			writer.Write( material_info.color_albedo.value_or( Color3{} ) );
+		}
+
+		writer.Write( ( u32 )model.meshes.size() );
+		for( std::size_t i = 0; i < model.meshes.size(); i++ )
+		{
+			writer.WriteString( model.meshes[ i ].Name() );
+			writer.Write( mesh_data[ i ].vertex_count );
+			writer.Write( mesh_data[ i ].attribute_component_counts );
+			writer.Write( model.meshes[ i ].Bounds() );
+			writer.WriteArray( mesh_data[ i ].interleaved_vertices );
+			writer.WriteArray( mesh_data[ i ].indices );
+		}
+
+		writer.Write( ( u32 )model.mesh_groups.size() );
+		for( const auto& mesh_group : model.mesh_groups )
+		{
+			writer.WriteString( mesh_group.name );
+			writer.Write( mesh_group.bounds );
+			writer.Write( ( u32 )mesh_group.mesh_infos.size() );
+			for( const auto& mesh_info : mesh_group.mesh_infos )
+			{
+				writer.WriteString( mesh_info.name );
+				writer.Write( ( u32 )( &mesh_info.mesh - model.meshes.data() ) );
+				writer.Write( mesh_info.material_info_index );
+			}
+		}
+
+		writer.Write( ( u32 )model.nodes.size() );
+		for( const auto& node : model.nodes )
+		{
+			writer.WriteString( node.name );
+			writer.Write( node.transform_local );
+			writer.Write( node.mesh_group ? ( i32 )( node.mesh_group - model.mesh_groups.data() ) : -1 );
+			writer.WriteArray( std::span< const i32 >( node.children ) );
+		}
+
+		std::vector< u64 > top_level_node_indices( model.node_indices_top_level.cbegin(), model.node_indices_top_level.cend() );
+		writer.WriteArray( std::span< const u64 >( top_level_node_indices ) );
+		writer.Write( model.mesh_instance_count );
+
+		if( not writer.SaveToFile( CookedFilePath( source_file_path ) ) )
+		{
+			Log::Warning( "Could not write the cooked model file for \"" + source_file_path + "\"." );
+			return false;
+		}
+
+		return true;
+	}
+}
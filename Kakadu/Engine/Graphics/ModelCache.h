@@ -0,0 +1,60 @@
+#pragma once
+
+// Engine Includes.
+#include "Model.h"
+
+// std Includes.
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Kakadu
+{
+	/* On-disk "cooked" form of a Model imported from glTF: Interleaved vertices & indices ready for upload, nodes, mesh groups, material infos & texture sources.
+	 * Stored next to the source file (see CookedFilePath()) & read through a memory mapping; Vertex & index data are uploaded straight from the mapped file.
+	 * A cooked file is only used if the format version, the import settings affecting the cooked data, the content hash of the source file
+	 * & the sizes/modification times of the source's external buffers all match. */
+	class ModelCache
+	{
+	public:
+		/* How a texture of the Model was created; Needed to re-create it when loading from the cache. */
+		struct TextureSource
+		{
+			std::string file_path; // Empty for textures embedded in the glTF.
+			std::span< const std::byte > encoded_bytes; // Still-encoded image file contents; Only used for embedded textures.
+			RHI::Texture::ImportSettings import_settings;
+		};
+
+		/* Vertex & index data of a Mesh of the Model, in the same order as Model::Meshes(). */
+		struct MeshData
+		{
+			u32 vertex_count;
+			std::array< i32, 4 > attribute_component_counts; // Position, normal, uv & tangent; 0 means the attribute is absent.
+			std::span< const float > interleaved_vertices;
+			std::span< const u32 > indices;
+		};
+
+	public:
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( ModelCache );
+
+		static std::filesystem::path CookedFilePath( const std::filesystem::path& source_file_path );
+
+		/* Returns nullopt if there is no valid cooked file for the source; The caller is expected to import the source & Store() the result in that case. */
+		static std::optional< Model > Load( const std::string& source_file_path, const Model::ImportSettings& import_settings );
+
+		/* external_dependencies are the files the source refers to, other than images (e.g., .bin buffers of a .gltf), whose changes invalidate the cooked file. */
+		static bool Store( const Model& model,
+						   const std::string& source_file_path,
+						   const std::vector< std::filesystem::path >& external_dependencies,
+						   const Model::ImportSettings& import_settings,
+						   const std::span< const TextureSource > texture_sources,
+						   const std::span< const MeshData > mesh_data );
+
+	private:
+		ModelCache() = delete;
+	};
+}
@@ -9,7 +9,8 @@ namespace Kakadu
 		:
 		model( nullptr ),
 		shader( nullptr ),
-		shader_shadow_receiving( nullptr )
+		shader_shadow_receiving( nullptr ),
+		transform_hierarchy( std::make_unique< TransformHierarchy >() )
 	{}
 
 	// TODO: Pass name here and use that name as the Renderable name. Currently, Material name becomes the Renderable name.
@@ -25,6 +26,7 @@ namespace Kakadu
 		model( model ),
 		shader( shader ),
 		shader_shadow_receiving( shader_shadow_receiving ),
+		transform_hierarchy( std::make_unique< TransformHierarchy >() ),
 		texture_scale_and_offset( texture_scale_and_offset )
 	{
 		ASSERT_DEBUG_ONLY( model != nullptr );
@@ -36,47 +38,49 @@ namespace Kakadu
 		/* Initialize Transforms, Materials & Renderables of Nodes: */
 
 		const auto  mesh_instance_count = model->MeshInstanceCount();
-		const auto& meshes              = model->Meshes();
 		const auto& nodes               = model->Nodes();
 
-		node_world_matrix_array.resize( mesh_instance_count );
-		node_renderable_array.resize( mesh_instance_count );
+		node_renderable_array.reserve( mesh_instance_count );
 
-		/* Apply scene-graph transformations: */
+		transform_hierarchy->Reserve( nodes.size() + 1 );
+		hierarchy_node_index_per_model_node.resize( nodes.size() );
 
-		i32 mesh_index = 0;
-		std::function< void( const std::size_t, const Matrix4x4& ) > ProcessNode = [ & ]( const std::size_t node_index, const Matrix4x4& parent_transform )
+		/* The root node carries the instance's own transformation; Model nodes are added in pre-order, so that parents precede their children. */
+		transform_hierarchy->Add( TransformHierarchy::NO_PARENT, scale, rotation, translation );
+
+		std::vector< std::pair< std::size_t, TransformHierarchy::NodeIndex > > node_stack;
+		for( auto iterator = model->TopLevelNodeIndices().rbegin(); iterator != model->TopLevelNodeIndices().rend(); iterator++ )
+			node_stack.emplace_back( *iterator, ROOT_NODE_INDEX );
+
+		while( not node_stack.empty() )
 		{
+			const auto [ node_index, parent_hierarchy_node_index ] = node_stack.back();
+			node_stack.pop_back();
+
 			const auto& node = nodes[ node_index ];
 
-			auto transform_so_far = node.transform_local * parent_transform;
+			const auto hierarchy_node_index = transform_hierarchy->Add( parent_hierarchy_node_index, node.transform_local );
+			hierarchy_node_index_per_model_node[ node_index ] = hierarchy_node_index;
 
-			for( auto& child_index : node.children )
-				ProcessNode( child_index, transform_so_far );
+			for( auto iterator = node.children.rbegin(); iterator != node.children.rend(); iterator++ )
+				node_stack.emplace_back( *iterator, hierarchy_node_index );
 
 			if( node.mesh_group )
 			{
 				for( auto& mesh_info : node.mesh_group->mesh_infos )
 				{
-					node_world_matrix_array[ mesh_index ] = transform_so_far;
-
 					Material* const mat = material ? material
 					                    : ( mesh_info.material_info_index >= 0
 											? &node_material_array[ mesh_info.material_info_index ]
 											: receives_shadows ? BuiltinMaterials::Get( "Default (Shadowed)" ) : BuiltinMaterials::Get( "Default" ) );
 
-					node_renderable_array[ mesh_index ] = Renderable( &mesh_info.mesh, mat, nullptr, receives_shadows, casts_shadows,
-					                                                  mat && mat->HasUniform( "uniform_transform_world" )
-					                                                    ? &node_world_matrix_array[ mesh_index ]
-					                                                    : nullptr );
-
-					mesh_index++;
+					if( mat && ( mat->HasUniform( "uniform_transform_world" ) || mat->GetShader()->UsesDrawTransformBuffer() ) )
+						node_renderable_array.emplace_back( &mesh_info.mesh, mat, *transform_hierarchy, hierarchy_node_index, receives_shadows, casts_shadows );
+					else
+						node_renderable_array.emplace_back( &mesh_info.mesh, mat, nullptr, receives_shadows, casts_shadows );
 				}
 			}
-		};
-
-		for( auto top_level_node_index : model->TopLevelNodeIndices() )
-			ProcessNode( top_level_node_index, Matrix::Scaling( scale ) * Math::QuaternionToMatrix( rotation ) * Matrix::Translation( translation ) );
+		}
 	}
 
 	ModelInstance::~ModelInstance()
@@ -84,29 +88,12 @@ namespace Kakadu
 
 	void ModelInstance::SetTransformation( const Matrix4x4& transformation )
 	{
-		i32 mesh_index = 0;
-		std::function< void( const std::size_t, const Matrix4x4& ) > ProcessNode = [ & ]( const std::size_t node_index, const Matrix4x4& parent_transform )
-		{
-			const auto& node = model->Nodes()[ node_index ];
-
-			auto transform_so_far = node.transform_local * parent_transform;
-
-			for( auto& child_index : node.children )
-				ProcessNode( child_index, transform_so_far );
-
-			if( node.mesh_group )
-			{
-				for( auto& mesh_info : node.mesh_group->mesh_infos )
-				{
-					node_world_matrix_array[ mesh_index ] = transform_so_far;
-
-					mesh_index++;
-				}
-			}
-		};
+		transform_hierarchy->SetLocal( ROOT_NODE_INDEX, transformation );
+	}
 
-		for( auto top_level_node_index : model->TopLevelNodeIndices() )
-			ProcessNode( top_level_node_index, transformation );
+	void ModelInstance::SetTransformation( const Vector3& scale, const Quaternion& rotation, const Vector3& translation )
+	{
+		transform_hierarchy->SetLocal( ROOT_NODE_INDEX, scale, rotation, translation );
 	}
 
 	internal_function void PopulateMaterial( Material& material, const Model::MaterialInfo& material_info,
@@ -189,4 +176,10 @@ namespace Kakadu
 		for( auto& renderable : node_renderable_array )
 			renderable.is_receiving_shadows = cast_shadows;
 	}
+
+	void ModelInstance::ToggleStaticStatus( const bool is_static )
+	{
+		for( auto& renderable : node_renderable_array )
+			renderable.is_static = is_static;
+	}
 }
\ No newline at end of file
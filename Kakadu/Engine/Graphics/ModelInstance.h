@@ -4,14 +4,20 @@
 #include "MaterialData/MaterialData.h"
 #include "Model.h"
 #include "Renderer.h"
+#include "Scene/TransformHierarchy.h"
 
 // std Includes.
+#include <memory>
 #include <vector>
 
 namespace Kakadu
 {
 	class ModelInstance
 	{
+	public:
+		/* Carries the instance's own transformation; Top-level Model nodes are its children. */
+		static constexpr TransformHierarchy::NodeIndex ROOT_NODE_INDEX = 0;
+
 	public:
 		ModelInstance();
 		ModelInstance( const Model* model,
@@ -32,7 +38,13 @@ namespace Kakadu
 		 * Usage: 
 		 */
 
+		/* SRT = Scale * Rotate * Translate. The matrix is decomposed & must not contain shear. */
 		void SetTransformation( const Matrix4x4& transformation );
+		void SetTransformation( const Vector3& scale, const Quaternion& rotation, const Vector3& translation );
+
+		/* Individual nodes can be moved through the hierarchy; Only the affected subtree is recalculated. */
+		TransformHierarchy& Hierarchy() { return *transform_hierarchy; }
+		TransformHierarchy::NodeIndex HierarchyNodeIndex( const std::size_t model_node_index ) const { return hierarchy_node_index_per_model_node[ model_node_index ]; }
 
 		/*
 		 * Queries:
@@ -40,11 +52,14 @@ namespace Kakadu
 
 		bool IsReceivingShadows()	const { return node_renderable_array.front().is_receiving_shadows; }
 		bool IsCastingShadows()		const { return node_renderable_array.front().is_casting_shadows; }
+		bool IsStatic()				const { return node_renderable_array.front().is_static; }
 
 		void SetMaterialData( RHI::Shader* const shader, const Vector4 texture_scale_and_offset = Vector4( 1.0f, 1.0f, 0.0f, 0.0f ) );
 
 		void ToggleShadowReceivingStatus( const bool receive_shadows );
 		void ToggleShadowCastingStatus( const bool cast_shadows );
+		/* See Renderable::is_static. */
+		void ToggleStaticStatus( const bool is_static );
 
 			  std::vector< Renderable >& Renderables()		 { return node_renderable_array; }
 		const std::vector< Material	  >& Materials()   const { return node_material_array; }
@@ -57,7 +72,9 @@ namespace Kakadu
 
 		std::vector< Renderable > node_renderable_array;
 		std::vector< Material	> node_material_array;
-		std::vector< Matrix4x4	> node_world_matrix_array;
+		/* On the heap, so that Renderables can keep pointing at it when the ModelInstance is moved. */
+		std::unique_ptr< TransformHierarchy > transform_hierarchy;
+		std::vector< TransformHierarchy::NodeIndex > hierarchy_node_index_per_model_node;
 		std::vector< MaterialData::BlinnPhongMaterialData > blinn_phong_material_data_array;
 		
 		Vector4 texture_scale_and_offset;
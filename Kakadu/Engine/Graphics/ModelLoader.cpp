@@ -1,7 +1,10 @@
 // Engine Includes.
 #include "Model.h"
+#include "ModelCache.h"
+#include "MeshUtility.hpp"
 #include "Core/AssetDatabase.hpp"
 #include "Core/BitFlags.hpp"
+#include "Core/JobSystem.h"
 #include "Core/Log.h"
 #include "Core/ServiceLocator.hpp"
 #include "Core/Types.h"
@@ -151,244 +154,305 @@ namespace Kakadu
 		return true;
 	}
 
-	internal_function bool LoadMesh( const fastgltf::Asset& gltf_asset,
-                                     const fastgltf::Mesh& gltf_mesh,
-									 Model::MeshGroup& mesh_group_to_load,
-                                     std::vector< Mesh >& meshes,
-                                     BitFlags< MeshLoadIssues >& issues )
-	{
-		/* Naming variables mesh-info instead of gltf's "primitive" for better readability. */
+    /* Output of the CPU stage of mesh loading for a single glTF primitive; Consumed by the GL stage (CreateMeshGroup()). */
+    struct PrimitiveLoadResult
+    {
+        enum class Status : u8
+        {
+            Skipped, // Unsupported or incomplete primitive; Does not fail the Model.
+            Loaded,
+            Failed
+        };
 
-        mesh_group_to_load.mesh_infos.reserve( gltf_mesh.primitives.size() );
-        mesh_group_to_load.name = gltf_mesh.name;
+        Status status = Status::Skipped;
+        BitFlags< MeshLoadIssues > issues;
+        i32 material_info_index = -1;
+
+        /* Ready for upload (& for the ModelCache). */
+        u32                    vertex_count = 0;
+        std::array< i32, 4 >   attribute_component_counts = {}; // Position, normal, uv & tangent; 0 means the attribute is absent.
+        std::vector< float >   interleaved_vertices;
+        std::vector< u32 >     indices;
+        Math::AABB             bounds;
+    };
 
-		for( auto mesh_info_iterator = gltf_mesh.primitives.begin(); mesh_info_iterator != gltf_mesh.primitives.end(); ++mesh_info_iterator )
+    /* CPU stage: Attribute conversion, index processing, tangent generation & interleaving. Does not touch GL, so it is safe to call for multiple primitives in parallel. */
+	internal_function void ProcessPrimitive( const fastgltf::Asset& gltf_asset, const fastgltf::Primitive& gltf_primitive, PrimitiveLoadResult& result )
+	{
+        if( gltf_primitive.type != fastgltf::PrimitiveType::Triangles )
         {
-            if( mesh_info_iterator->type != fastgltf::PrimitiveType::Triangles )
-            {
-                issues.Set( MeshLoadIssues::PrimitiveType_NonTriangleDetected );
-                continue;
-            }
+            result.issues.Set( MeshLoadIssues::PrimitiveType_NonTriangleDetected );
+            return;
+        }
 
-			auto* position_iterator = mesh_info_iterator->findAttribute( "POSITION" );
-			ASSERT_DEBUG_ONLY( position_iterator != mesh_info_iterator->attributes.end() ); // A gltf mesh primitive is required to hold the POSITION attribute.
+		auto* position_iterator = gltf_primitive.findAttribute( "POSITION" );
+		ASSERT_DEBUG_ONLY( position_iterator != gltf_primitive.attributes.end() ); // A gltf mesh primitive is required to hold the POSITION attribute.
 
-            bool vertices_with_all_degenerate_triangles_detected = false;
+        result.material_info_index = gltf_primitive.materialIndex.has_value()
+                                     ? ( i32 )gltf_primitive.materialIndex.value()
+                                     : -1;
 
-            const i32 material_info_index = mesh_info_iterator->materialIndex.has_value()
-                                            ? ( i32 )mesh_info_iterator->materialIndex.value()
-                                            : -1;
+        /*
+         * Positions:
+         */
 
-            /*
-             * Positions:
-             */
+        /* glTF uses a right-handed coordinate system where x points to right, y points to up & z points from the screen to the user.
+         * Compared to the coordinate system used in this engine, only the Z component is the inverse, x & y are the same. */
+        constexpr Matrix3x3 coordinate_system_transform( Vector3::Right(),
+														 Vector3::Up(),
+														 Vector3::Backward() );
 
-            /* glTF uses a right-handed coordinate system where x points to right, y points to up & z points from the screen to the user.
-	         * Compared to the coordinate system used in this engine, only the Z component is the inverse, x & y are the same. */
-	        constexpr Matrix3x3 coordinate_system_transform( Vector3::Right(),
-															 Vector3::Up(),
-															 Vector3::Backward() );
+		const auto& position_accessor = gltf_asset.accessors[ position_iterator->accessorIndex ];
+		if( !position_accessor.bufferViewIndex.has_value() )
+			return;
 
-			const auto& position_accessor = gltf_asset.accessors[ position_iterator->accessorIndex ];
-			if( !position_accessor.bufferViewIndex.has_value() )
-				continue;
+        std::vector< Vector3 > positions( position_accessor.count, ZERO_INITIALIZATION );
 
-            std::vector< Vector3 > positions( position_accessor.count, ZERO_INITIALIZATION );
+		fastgltf::iterateAccessorWithIndex< Vector3 >( gltf_asset, position_accessor,
+													   [ & ]( Vector3 position, std::size_t index )
+		                                               {
+			                                               positions[ index ] = position * coordinate_system_transform;
+		                                               } );
 
-			fastgltf::iterateAccessorWithIndex< Vector3 >( gltf_asset, position_accessor,
-														   [ & ]( Vector3 position, std::size_t index )
-			                                               {
-				                                               positions[ index ] = position * coordinate_system_transform;
-			                                               } );
+        /*
+         * Normals:
+         */
 
-            /*
-             * Normals:
-             */
+        std::vector< Vector3 > normals;
+
+        if( auto* normal_iterator = gltf_primitive.findAttribute( "NORMAL" );
+            normal_iterator != gltf_primitive.attributes.end() )
+        {
+            const auto& normal_accessor = gltf_asset.accessors[ normal_iterator->accessorIndex ];
+            if( !normal_accessor.bufferViewIndex.has_value() )
+                return;
 
-            std::vector< Vector3 > normals;
+            normals.resize( normal_accessor.count, ZERO_INITIALIZATION );
 
-            if( auto* normal_iterator = mesh_info_iterator->findAttribute( "NORMAL" );
-                normal_iterator != mesh_info_iterator->attributes.end() )
+            fastgltf::iterateAccessorWithIndex< Vector3 >( gltf_asset, normal_accessor,
+                                                           [ & ]( Vector3 normal, std::size_t index )
             {
-                const auto& normal_accessor = gltf_asset.accessors[ normal_iterator->accessorIndex ];
-                if( !normal_accessor.bufferViewIndex.has_value() )
-                    continue;
+                normals[ index ] = normal * coordinate_system_transform;
+            } );
+        }
 
-                normals.resize( normal_accessor.count, ZERO_INITIALIZATION );
+        /*
+         * UVs (0):
+         */
 
-                fastgltf::iterateAccessorWithIndex< Vector3 >( gltf_asset, normal_accessor,
-                                                               [ & ]( Vector3 normal, std::size_t index )
-                {
-                    normals[ index ] = normal * coordinate_system_transform;
-                } );
-            }
+        std::vector< Vector2 > uvs_0;
 
-            /*
-             * UVs (0):
-             */
+        if( auto* uvs_0_iterator = gltf_primitive.findAttribute( "TEXCOORD_0" );
+            uvs_0_iterator != gltf_primitive.attributes.end() )
+        {
+            const auto& uvs_0_accessor = gltf_asset.accessors[ uvs_0_iterator->accessorIndex ];
+            if( !uvs_0_accessor.bufferViewIndex.has_value() )
+                return;
 
-            std::vector< Vector2 > uvs_0;
+            uvs_0.resize( uvs_0_accessor.count, ZERO_INITIALIZATION );
 
-            if( auto* uvs_0_iterator = mesh_info_iterator->findAttribute( "TEXCOORD_0" );
-                uvs_0_iterator != mesh_info_iterator->attributes.end() )
-            {
-                const auto& uvs_0_accessor = gltf_asset.accessors[ uvs_0_iterator->accessorIndex ];
-                if( !uvs_0_accessor.bufferViewIndex.has_value() )
-                    continue;
+            fastgltf::copyFromAccessor< Vector2 >( gltf_asset, uvs_0_accessor, uvs_0.data() );
+        }
 
-                uvs_0.resize( uvs_0_accessor.count, ZERO_INITIALIZATION );
+        /*
+         * Tangents:
+         */
 
-                fastgltf::copyFromAccessor< Vector2 >( gltf_asset, uvs_0_accessor, uvs_0.data() );
-            }
+        std::vector< Vector4 > tangents;
 
-            /*
-             * Tangents:
-             */
+        if( auto* tangent_iterator = gltf_primitive.findAttribute( "TANGENT" );
+            tangent_iterator != gltf_primitive.attributes.cend() )
+        {
+            const auto& tangent_accessor = gltf_asset.accessors[ tangent_iterator->accessorIndex ];
+            if( !tangent_accessor.bufferViewIndex.has_value() )
+                return;
 
-            std::vector< Vector4 > tangents;
+            tangents.resize( tangent_accessor.count, ZERO_INITIALIZATION );
 
-            if( auto* tangent_iterator = mesh_info_iterator->findAttribute( "TANGENT" );
-                tangent_iterator != mesh_info_iterator->attributes.cend() )
+            fastgltf::iterateAccessorWithIndex< Vector4 >( gltf_asset, tangent_accessor,
+                                                           [ & ]( Vector4 tangent, std::size_t index )
             {
-                const auto& tangent_accessor = gltf_asset.accessors[ tangent_iterator->accessorIndex ];
-                if( !tangent_accessor.bufferViewIndex.has_value() )
-                    continue;
-
-                tangents.resize( tangent_accessor.count, ZERO_INITIALIZATION );
-
-                fastgltf::iterateAccessorWithIndex< Vector4 >( gltf_asset, tangent_accessor,
-                                                               [ & ]( Vector4 tangent, std::size_t index )
-                {
-                    tangents[ index ] = Vector4( tangent.XYZ() * coordinate_system_transform, tangent.W() );
-                } );
-            }
-
-            /*
-             * Indices:
-             */
+                tangents[ index ] = Vector4( tangent.XYZ() * coordinate_system_transform, tangent.W() );
+            } );
+        }
 
-            ASSERT_DEBUG_ONLY( mesh_info_iterator->indicesAccessor.has_value() ); // We specify GenerateMeshIndices, so we should always have indices.
+        /*
+         * Indices:
+         */
 
-            const auto& index_accessor = gltf_asset.accessors[ mesh_info_iterator->indicesAccessor.value() ];
-            if( !index_accessor.bufferViewIndex.has_value() )
-                return false;
-            const u32 index_count = static_cast< u32 >( index_accessor.count );
+        ASSERT_DEBUG_ONLY( gltf_primitive.indicesAccessor.has_value() ); // We specify GenerateMeshIndices, so we should always have indices.
 
-            std::vector< u32 > indices_u32;
+        const auto& index_accessor = gltf_asset.accessors[ gltf_primitive.indicesAccessor.value() ];
+        if( !index_accessor.bufferViewIndex.has_value() )
+        {
+            result.status = PrimitiveLoadResult::Status::Failed;
+            return;
+        }
+        const u32 index_count = static_cast< u32 >( index_accessor.count );
 
-            // Ignore 16 bit indices (or any other format other than 32 bit for that matter).
-            indices_u32.resize( index_count );
+        auto& indices_u32 = result.indices;
 
-            auto EffectiveIndex = []( const std::size_t index )
-            {
-                /* To swap the winding order:
-                 * Swap the 2nd & 3rd vertex of every triangle to convert from ccw front-faces to cw front-faces. */
-                const std::size_t index_mod_3 = index % 3;
-                const std::size_t needs_swap( ( bool )index_mod_3 ); // true/1 for 1 & 2, false/0 for 0.
-                const std::size_t swapped_index = ( index - index_mod_3 ) + 3 - index_mod_3;
-                return needs_swap * swapped_index + ( 1 - needs_swap ) * index;
-            };
+        // Ignore 16 bit indices (or any other format other than 32 bit for that matter).
+        indices_u32.resize( index_count );
 
-            fastgltf::iterateAccessorWithIndex< u32 >( gltf_asset, index_accessor,
-													   [ & ]( u32 actual_index, std::size_t array_index )
-            {
-                indices_u32[ EffectiveIndex( array_index ) ] = actual_index;
-            } );
+        auto EffectiveIndex = []( const std::size_t index )
+        {
+            /* To swap the winding order:
+             * Swap the 2nd & 3rd vertex of every triangle to convert from ccw front-faces to cw front-faces. */
+            const std::size_t index_mod_3 = index % 3;
+            const std::size_t needs_swap( ( bool )index_mod_3 ); // true/1 for 1 & 2, false/0 for 0.
+            const std::size_t swapped_index = ( index - index_mod_3 ) + 3 - index_mod_3;
+            return needs_swap * swapped_index + ( 1 - needs_swap ) * index;
+        };
+
+        fastgltf::iterateAccessorWithIndex< u32 >( gltf_asset, index_accessor,
+												   [ & ]( u32 actual_index, std::size_t array_index )
+        {
+            indices_u32[ EffectiveIndex( array_index ) ] = actual_index;
+        } );
 
-            /* Calculate tangents if the model did not have them. */
-            if( not uvs_0.empty() && tangents.empty() )
+        /* Calculate tangents if the model did not have them. */
+        if( not uvs_0.empty() && tangents.empty() )
+        {
+            const auto index_count = indices_u32.size();
+            const auto size = positions.size();
+            tangents.resize( size );
+            std::vector< Vector3 > bitangents( size ); // This is solely for determining the sign of the W component.
+            for( auto base_index = 0; base_index < index_count; base_index += 3 )
             {
-                const auto index_count = indices_u32.size();
-                const auto size = positions.size();
-                tangents.resize( size );
-                std::vector< Vector3 > bitangents( size ); // This is solely for determining the sign of the W component.
-                for( auto base_index = 0; base_index < index_count; base_index += 3 )
-                {
-                    const u32 index_0 = indices_u32[ base_index     ];
-                    const u32 index_1 = indices_u32[ base_index + 1 ];
-                    const u32 index_2 = indices_u32[ base_index + 2 ];
+                const u32 index_0 = indices_u32[ base_index     ];
+                const u32 index_1 = indices_u32[ base_index + 1 ];
+                const u32 index_2 = indices_u32[ base_index + 2 ];
 
-                    const Vector3 position_0 = positions[ index_0 ];
-                    const Vector3 position_1 = positions[ index_1 ];
-                    const Vector3 position_2 = positions[ index_2 ];
+                const Vector3 position_0 = positions[ index_0 ];
+                const Vector3 position_1 = positions[ index_1 ];
+                const Vector3 position_2 = positions[ index_2 ];
 
-                    const Vector2 uv_0 = uvs_0[ index_0 ];
-                    const Vector2 uv_1 = uvs_0[ index_1 ];
-                    const Vector2 uv_2 = uvs_0[ index_2 ];
+                const Vector2 uv_0 = uvs_0[ index_0 ];
+                const Vector2 uv_1 = uvs_0[ index_1 ];
+                const Vector2 uv_2 = uvs_0[ index_2 ];
 
-                    const Vector3 edge_1 = position_1 - position_0;
-                    const Vector3 edge_2 = position_2 - position_0;
+                const Vector3 edge_1 = position_1 - position_0;
+                const Vector3 edge_2 = position_2 - position_0;
 
-                    const Vector2 delta_uv_1 = uv_1 - uv_0;
-                    const Vector2 delta_uv_2 = uv_2 - uv_0;
+                const Vector2 delta_uv_1 = uv_1 - uv_0;
+                const Vector2 delta_uv_2 = uv_2 - uv_0;
 
-                    const float delta_u_1 = delta_uv_1.X();
-                    const float delta_u_2 = delta_uv_2.X();
-                    const float delta_v_1 = delta_uv_1.Y();
-                    const float delta_v_2 = delta_uv_2.Y();
+                const float delta_u_1 = delta_uv_1.X();
+                const float delta_u_2 = delta_uv_2.X();
+                const float delta_v_1 = delta_uv_1.Y();
+                const float delta_v_2 = delta_uv_2.Y();
 
-                    const float determinant = delta_u_1 * delta_v_2 - delta_u_2 * delta_v_1;
+                const float determinant = delta_u_1 * delta_v_2 - delta_u_2 * delta_v_1;
 
-                    const float f = 1.0f / determinant;
+                const float f = 1.0f / determinant;
 
-                    if( Math::IsInfinite( f ) )
-                        continue;
+                if( Math::IsInfinite( f ) )
+                    continue;
 
-                    const Vector3 face_tangent( f * ( delta_v_2 * edge_1.X() - delta_v_1 * edge_2.X() ),
-                                                f * ( delta_v_2 * edge_1.Y() - delta_v_1 * edge_2.Y() ),
-                                                f * ( delta_v_2 * edge_1.Z() - delta_v_1 * edge_2.Z() ) );
-                    const Vector3 face_bitangent( f * ( delta_u_1 * edge_2.X() - delta_u_2 * edge_1.X() ),
-                                                  f * ( delta_u_1 * edge_2.Y() - delta_u_2 * edge_1.Y() ),
-                                                  f * ( delta_u_1 * edge_2.Z() - delta_u_2 * edge_1.Z() ) );
+                const Vector3 face_tangent( f * ( delta_v_2 * edge_1.X() - delta_v_1 * edge_2.X() ),
+                                            f * ( delta_v_2 * edge_1.Y() - delta_v_1 * edge_2.Y() ),
+                                            f * ( delta_v_2 * edge_1.Z() - delta_v_1 * edge_2.Z() ) );
+                const Vector3 face_bitangent( f * ( delta_u_1 * edge_2.X() - delta_u_2 * edge_1.X() ),
+                                              f * ( delta_u_1 * edge_2.Y() - delta_u_2 * edge_1.Y() ),
+                                              f * ( delta_u_1 * edge_2.Z() - delta_u_2 * edge_1.Z() ) );
+
+                tangents[ index_0 ].XYZ() += face_tangent;
+                tangents[ index_1 ].XYZ() += face_tangent;
+                tangents[ index_2 ].XYZ() += face_tangent;
+                bitangents[ index_0 ]     += face_bitangent;
+                bitangents[ index_1 ]     += face_bitangent;
+                bitangents[ index_2 ]     += face_bitangent;
+            }
 
-                    tangents[ index_0 ].XYZ() += face_tangent;
-                    tangents[ index_1 ].XYZ() += face_tangent;
-                    tangents[ index_2 ].XYZ() += face_tangent;
-                    bitangents[ index_0 ]     += face_bitangent;
-                    bitangents[ index_1 ]     += face_bitangent;
-                    bitangents[ index_2 ]     += face_bitangent;
+            // Normalize:
+            for( std::size_t i = 0; i < tangents.size(); i++ )
+            {
+                auto& tangent = tangents[ i ];
+                if( Math::IsZero( tangent.MagnitudeSquared() ) )
+                {
+                    result.issues.Set( MeshLoadIssues::TangentGen_VertsWithAllDegenerateUVTrianglesFound );
+                    tangent = Vector4( Vector3::Right(), +1.0f );
                 }
-
-                // Normalize:
-                for( std::size_t i = 0; i < tangents.size(); i++ )
+                else
                 {
-                    auto& tangent = tangents[ i ];
-                    if( Math::IsZero( tangent.MagnitudeSquared() ) )
-                    {
-                        issues.Set( MeshLoadIssues::TangentGen_VertsWithAllDegenerateUVTrianglesFound );
-                        tangent = Vector4( Vector3::Right(), +1.0f );
-                    }
-                    else
-                    {
-                        const Vector3 t = tangent.XYZ().Normalized();
-                        // This accounts for TBN handedness flips caused by mirrored UVs at mesh seams:
-                        const float   w = Math::Dot( Math::Cross( normals[ i ], t ), bitangents[ i ] ) < 0.0f ? -1.0f : +1.0f;
-                        tangent = Vector4( t, w );
-                    }
+                    const Vector3 t = tangent.XYZ().Normalized();
+                    // This accounts for TBN handedness flips caused by mirrored UVs at mesh seams:
+                    const float   w = Math::Dot( Math::Cross( normals[ i ], t ), bitangents[ i ] ) < 0.0f ? -1.0f : +1.0f;
+                    tangent = Vector4( t, w );
                 }
             }
+        }
+
+        result.interleaved_vertices       = MeshUtility::Interleave( result.vertex_count, positions, normals, uvs_0, tangents );
+        result.attribute_component_counts = { 3, normals.empty() ? 0 : 3, uvs_0.empty() ? 0 : 2, tangents.empty() ? 0 : 4 };
+        result.bounds                     = Math::AABB::FromPoints( positions );
+
+        result.status = PrimitiveLoadResult::Status::Loaded;
+    }
+
+    /* GL stage: Creates the Meshes of an already processed glTF mesh (i.e., a MeshGroup), in primitive order. */
+	internal_function bool CreateMeshGroup( const fastgltf::Mesh& gltf_mesh,
+                                            std::vector< PrimitiveLoadResult >& primitive_results,
+									        Model::MeshGroup& mesh_group_to_load,
+                                            std::vector< Mesh >& meshes,
+                                            std::vector< ModelCache::MeshData >& mesh_data,
+                                            GeometryPool* geometry_pool,
+                                            BitFlags< MeshLoadIssues >& issues )
+	{
+		/* Naming variables mesh-info instead of gltf's "primitive" for better readability. */
+
+        mesh_group_to_load.mesh_infos.reserve( gltf_mesh.primitives.size() );
+        mesh_group_to_load.name = gltf_mesh.name;
+
+        for( std::size_t primitive_index = 0; primitive_index < primitive_results.size(); primitive_index++ )
+        {
+            auto& result = primitive_results[ primitive_index ];
+
+            for( const auto issue : { MeshLoadIssues::PrimitiveType_NonTriangleDetected, MeshLoadIssues::TangentGen_VertsWithAllDegenerateUVTrianglesFound } )
+                if( result.issues.IsSet( issue ) )
+                    issues.Set( issue );
 
-            std::string mesh_info_name( mesh_group_to_load.name + "_" + std::to_string( std::distance( gltf_mesh.primitives.begin(), mesh_info_iterator ) ) );
+            if( result.status == PrimitiveLoadResult::Status::Failed )
+                return false;
+
+            if( result.status == PrimitiveLoadResult::Status::Skipped )
+                continue;
+
+            std::string mesh_info_name( mesh_group_to_load.name + "_" + std::to_string( primitive_index ) );
 
             mesh_group_to_load.mesh_infos.emplace_back( mesh_info_name,
                                                      /* Actual Mesh will be stored inside the meshes vector. MeshInfo will have a reference to this Mesh. */
-                                                     meshes.emplace_back( Mesh( std::move( positions ),
+                                                     meshes.emplace_back( Mesh( std::span< const float >( result.interleaved_vertices ),
+                                                                                result.vertex_count,
+                                                                                result.attribute_component_counts,
+                                                                                result.indices,
+                                                                                result.bounds,
                                                                                 mesh_info_name,
-                                                                                std::move( normals ),
-                                                                                std::move( uvs_0 ),
-                                                                                std::move( indices_u32 ),
-                                                                                std::move( tangents ) ) ),
-                                                     material_info_index );
+                                                                                RHI::Primitive::Triangles,
+                                                                                RHI::Usage::StaticDraw,
+                                                                                geometry_pool ) ),
+                                                     result.material_info_index );
+
+            mesh_group_to_load.bounds.Merge( mesh_group_to_load.mesh_infos.back().mesh.Bounds() );
+
+            mesh_data.push_back( ModelCache::MeshData{ .vertex_count               = result.vertex_count,
+                                                       .attribute_component_counts = result.attribute_component_counts,
+                                                       .interleaved_vertices       = result.interleaved_vertices,
+                                                       .indices                    = result.indices } );
         }
 
         return true;
     }
 
     internal_function bool LoadTexture( const fastgltf::Asset& gltf_asset, const fastgltf::Image& gltf_image,
-										RHI::Texture*& texture_to_load, const RHI::Texture::ImportSettings& import_settings )
+										RHI::Texture*& texture_to_load, const RHI::Texture::ImportSettings& import_settings,
+										const bool load_asynchronously, ModelCache::TextureSource& texture_source )
     {
         auto& texture_database = ServiceLocator< AssetDatabase< RHI::Texture > >::Get();
 
+        texture_source.import_settings = import_settings;
+
         std::visit( fastgltf::visitor
                     {
                         []( const auto& arg ) {},
@@ -399,16 +463,25 @@ namespace Kakadu
 
                             const std::string path( file_path.uri.path().begin(), file_path.uri.path().end() );
 
-							texture_to_load = texture_database.CreateAssetFromFile( std::string( gltf_image.name ),
-																													 path,
-																													 import_settings );
+                            texture_source.file_path = path;
+
+							texture_to_load = load_asynchronously
+								? texture_database.CreateAssetFromFile_Async( std::string( gltf_image.name ), path, import_settings )
+								: texture_database.CreateAssetFromFile( std::string( gltf_image.name ), path, import_settings );
 		                },
                         [ & ]( const fastgltf::sources::Array& vector )
                         {
-							texture_to_load = texture_database.CreateAssetFromFileBytes( std::string( gltf_image.name ),
-                                                                                         vector.bytes.data(),
-                                                                                         static_cast< i32 >( vector.bytes.size() ),
-                                                                                         import_settings );
+                            texture_source.encoded_bytes = std::span< const std::byte >( vector.bytes.data(), vector.bytes.size() );
+
+							texture_to_load = load_asynchronously
+								? texture_database.CreateAssetFromFileBytes_Async( std::string( gltf_image.name ),
+																				   vector.bytes.data(),
+																				   static_cast< i32 >( vector.bytes.size() ),
+																				   import_settings )
+								: texture_database.CreateAssetFromFileBytes( std::string( gltf_image.name ),
+																			 vector.bytes.data(),
+																			 static_cast< i32 >( vector.bytes.size() ),
+																			 import_settings );
                         },
                         [ & ]( const fastgltf::sources::BufferView& view )
                         {
@@ -424,11 +497,17 @@ namespace Kakadu
                                             []( const auto& arg ) {},
                                             [ & ]( const fastgltf::sources::Array& vector )
                                             {
-                                                texture_to_load =
-                                                    texture_database.CreateAssetFromFileBytes( std::string( gltf_image.name ),
-                                                                                               vector.bytes.data() + buffer_view.byteOffset,
-                                                                                               static_cast< i32 >( buffer_view.byteLength ),
-                                                                                               import_settings );
+                                                texture_source.encoded_bytes = std::span< const std::byte >( vector.bytes.data() + buffer_view.byteOffset, buffer_view.byteLength );
+
+                                                texture_to_load = load_asynchronously
+                                                    ? texture_database.CreateAssetFromFileBytes_Async( std::string( gltf_image.name ),
+                                                                                                       vector.bytes.data() + buffer_view.byteOffset,
+                                                                                                       static_cast< i32 >( buffer_view.byteLength ),
+                                                                                                       import_settings )
+                                                    : texture_database.CreateAssetFromFileBytes( std::string( gltf_image.name ),
+                                                                                                 vector.bytes.data() + buffer_view.byteOffset,
+                                                                                                 static_cast< i32 >( buffer_view.byteLength ),
+                                                                                                 import_settings );
                                             }
                                         }, buffer.data );
                         }
@@ -473,13 +552,45 @@ namespace Kakadu
         return true;
     }
 
+    /* Files other than images that a .gltf refers to (i.e., its external .bin buffers); The buffer of a .glb is covered by the hash of the .glb itself.
+     * Only the buffer entries are parsed, without loading them. */
+    internal_function std::vector< std::filesystem::path > ExternalBufferPaths( const std::filesystem::path& path, const fastgltf::Extensions extensions )
+    {
+        std::vector< std::filesystem::path > buffer_paths;
+
+        auto gltf_file = fastgltf::GltfDataBuffer::FromPath( path );
+        if( !bool( gltf_file ) || fastgltf::determineGltfFileType( gltf_file.get() ) != fastgltf::GltfType::glTF )
+            return buffer_paths;
+
+        fastgltf::Parser parser( extensions );
+        auto maybe_gltf_asset = parser.loadGltf( gltf_file.get(), path.parent_path(), fastgltf::Options::DontRequireValidAssetMember, fastgltf::Category::Buffers );
+        if( maybe_gltf_asset.error() != fastgltf::Error::None )
+            return buffer_paths;
+
+        for( const auto& buffer : maybe_gltf_asset.get().buffers )
+            if( const auto* uri = std::get_if< fastgltf::sources::URI >( &buffer.data );
+                uri && uri->uri.isLocalPath() )
+                buffer_paths.push_back( path.parent_path() / uri->uri.fspath() );
+
+        return buffer_paths;
+    }
+
     // TODO: Remove name parameter from this function AND from all Loaders as the file name is THE name here, no need for a custom name.
     std::optional< Model > Model::Loader::FromFile( const std::string_view name, const std::string& file_path, const ImportSettings& import_settings )
 	{
+        if( import_settings.use_cooked_cache )
+        {
+            if( auto maybe_cooked_model = ModelCache::Load( file_path, import_settings );
+                maybe_cooked_model )
+                return maybe_cooked_model;
+        }
+
         fastgltf::Asset gltf_asset;
 
         std::filesystem::path path( file_path ); // TODO: Why not take std::filesystem::path in all loaders?
 
+        std::vector< std::filesystem::path > external_dependencies;
+
         // Parse the glTF file and get the constructed asset:
         {
             constexpr auto supported_extensions =
@@ -503,6 +614,9 @@ namespace Kakadu
 
             fastgltf::Parser parser( supported_extensions );
 
+            if( import_settings.use_cooked_cache )
+                external_dependencies = ExternalBufferPaths( path, supported_extensions );
+
             constexpr auto gltf_options =
                 fastgltf::Options::DontRequireValidAssetMember |
                 fastgltf::Options::LoadExternalBuffers |
@@ -549,6 +663,10 @@ namespace Kakadu
         for( std::size_t texture_index = 0; texture_index < gltf_asset.textures.size(); texture_index++ )
             gltf_texture_index_from_image_index[ *gltf_asset.textures[ texture_index ].imageIndex ] = texture_index;
 
+        const bool load_textures_asynchronously = import_settings.load_textures_asynchronously;
+
+        std::vector< ModelCache::TextureSource > texture_sources( gltf_asset.images.size() );
+
         /* Now we can loop over the images safely, referring to the texture index from the map as needed. */
         for( std::size_t image_index = 0; image_index < gltf_asset.images.size(); image_index++ )
         {
@@ -597,7 +715,7 @@ namespace Kakadu
             }
 
             if( not LoadTexture( gltf_asset, gltf_image,
-                                 model.textures.emplace_back(), import_settings ) )
+                                 model.textures.emplace_back(), import_settings, load_textures_asynchronously, texture_sources[ image_index ] ) )
                 return std::nullopt;
         }
 
@@ -633,6 +751,12 @@ namespace Kakadu
 
         BitFlags< MeshLoadIssues > issues;
 
+        GeometryPool* geometry_pool = import_settings.use_geometry_pool ? &ServiceLocator< GeometryPool >::Get() : nullptr;
+
+        /* Mesh groups in the order they are first referenced by the nodes. Multiple nodes can point to the same mesh group. The group should only be loaded once. */
+        std::vector< std::size_t > mesh_group_indices_to_load;
+        std::vector< bool > mesh_group_is_queued( gltf_asset.meshes.size(), false );
+
         for( auto index = 0; index < gltf_asset.nodes.size(); index++ )
         {
             const auto& gltf_node = gltf_asset.nodes[ index ];
@@ -646,20 +770,50 @@ namespace Kakadu
             for( auto& child_index : gltf_node.children )
                 node.children.push_back( ( i32 )child_index );
 
-            if( node.mesh_group )
+            if( gltf_node.meshIndex && not mesh_group_is_queued[ *gltf_node.meshIndex ] )
             {
-                // Multiple nodes can point to the same mesh group. The group should only be loaded once.
-                if( node.mesh_group->mesh_infos.empty() )
-                {
-                    if( not LoadMesh( gltf_asset, gltf_asset.meshes[ *gltf_node.meshIndex ],
-								      *node.mesh_group, model.meshes, issues ) )
-                        return std::nullopt;
-                }
-
-                model.mesh_instance_count += ( i32 )node.mesh_group->mesh_infos.size();
+                mesh_group_is_queued[ *gltf_node.meshIndex ] = true;
+                mesh_group_indices_to_load.push_back( *gltf_node.meshIndex );
             }
         }
 
+        /* CPU stage: Primitives are independent of each other, so they are processed in parallel. */
+        std::vector< std::vector< PrimitiveLoadResult > > primitive_results( gltf_asset.meshes.size() );
+        std::vector< std::pair< std::size_t /* mesh group index */, std::size_t /* primitive index */ > > primitive_jobs;
+        primitive_jobs.reserve( sub_mesh_count );
+
+        for( const auto mesh_group_index : mesh_group_indices_to_load )
+        {
+            const auto primitive_count = gltf_asset.meshes[ mesh_group_index ].primitives.size();
+
+            primitive_results[ mesh_group_index ].resize( primitive_count );
+            for( std::size_t primitive_index = 0; primitive_index < primitive_count; primitive_index++ )
+                primitive_jobs.emplace_back( mesh_group_index, primitive_index );
+        }
+
+        ServiceLocator< JobSystem >::Get().ParallelFor( primitive_jobs.size(), 1, [ & ]( const std::size_t job_index, const std::size_t /* end: Always job_index + 1. */ )
+        {
+            const auto [ mesh_group_index, primitive_index ] = primitive_jobs[ job_index ];
+            ProcessPrimitive( gltf_asset,
+                              gltf_asset.meshes[ mesh_group_index ].primitives[ primitive_index ],
+                              primitive_results[ mesh_group_index ][ primitive_index ] );
+        } );
+
+        /* GL stage: Serial, in the same order as before, so that the Model's meshes are laid out deterministically. */
+        std::vector< ModelCache::MeshData > mesh_data;
+        mesh_data.reserve( sub_mesh_count );
+
+        for( const auto mesh_group_index : mesh_group_indices_to_load )
+        {
+            if( not CreateMeshGroup( gltf_asset.meshes[ mesh_group_index ], primitive_results[ mesh_group_index ],
+                                     model.mesh_groups[ mesh_group_index ], model.meshes, mesh_data, geometry_pool, issues ) )
+                return std::nullopt;
+        }
+
+        for( const auto& node : model.nodes )
+            if( node.mesh_group )
+                model.mesh_instance_count += ( i32 )node.mesh_group->mesh_infos.size();
+
         if( issues.IsSet( MeshLoadIssues::PrimitiveType_NonTriangleDetected ) )
             Log::Warning( "Model loading warning for \"" + file_name + "\": Detected & skipped non-triangle list pritimives." );
 
@@ -667,6 +821,9 @@ namespace Kakadu
             Log::Warning( "Model loading warning for \"" + file_name + "\": Tangent generation found vertices where every connected UV triangle is degenerate. "
                           "Defaulted tangents to Vector3::Right()." );
 
+        if( import_settings.use_cooked_cache )
+            ModelCache::Store( model, file_path, external_dependencies, import_settings, texture_sources, mesh_data );
+
         return model;
 	}
 }
\ No newline at end of file
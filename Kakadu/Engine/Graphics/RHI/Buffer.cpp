@@ -1,6 +1,7 @@
 // Engine Includes.
 #include "RHI.h"
 #include "Buffer.h"
+#include "Counters.h"
 #include "DebugLabel.h"
 #include "GLLabelPrefixes.h"
 #include "Core/Assertion.h"
@@ -48,6 +49,8 @@ namespace Kakadu::RHI
 
 		buffer.Bind();
 		glBufferData( TypeToGLEnum( buffer.type ), buffer.size, data, UsageToGLEnum( usage ) );
+
+		RunningCounters().buffer_reallocations++;
 	}
 
 	internal_function void CloneBuffer( Buffer& buffer )
@@ -224,11 +227,17 @@ namespace Kakadu::RHI
 	{
 		Bind();
 		glBufferSubData( TypeToGLEnum( type ), 0, size, data );
+
+		if( type == BufferType::Uniform )
+			RunningCounters().uniform_buffer_bytes += size;
 	}
 
 	void Buffer::Upload_Partial( const std::span< const std::byte > data_span, const std::size_t offset_from_buffer_start ) const
 	{
 		Bind();
 		glBufferSubData( TypeToGLEnum( type ), ( GLintptr )offset_from_buffer_start, ( GLsizeiptr )data_span.size_bytes(), ( void* )data_span.data() );
+
+		if( type == BufferType::Uniform )
+			RunningCounters().uniform_buffer_bytes += data_span.size_bytes();
 	}
 }
@@ -0,0 +1,30 @@
+// Engine Includes.
+#include "Counters.h"
+#include "Core/Macros.h"
+
+namespace Kakadu::RHI
+{
+	/*
+	 * Internal variables:
+	 */
+
+	internal_variable Counters RUNNING_COUNTERS;
+
+	/*
+	 * Public API:
+	 */
+
+	Counters Counters::operator-( const Counters& other ) const
+	{
+		Counters difference;
+		for( const auto& field : COUNTER_FIELDS )
+			difference.*field.member = this->*field.member - other.*field.member;
+
+		return difference;
+	}
+
+	Counters& RunningCounters()
+	{
+		return RUNNING_COUNTERS;
+	}
+}
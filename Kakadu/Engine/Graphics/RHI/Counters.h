@@ -0,0 +1,60 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Types.h"
+
+// std Includes.
+#include <array>
+
+namespace Kakadu::RHI
+{
+	/* Amount of work handed to GL. */
+	struct Counters
+	{
+	/* Draws: */
+		u64 draw_calls           = 0; // Every glDraw*() call; A multi-draw counts as a single call.
+		u64 draw_calls_indexed   = 0;
+		u64 draw_calls_instanced = 0; // Includes multi-draws, as each of their commands carries an instance count.
+		u64 primitives           = 0; // Points, lines, triangles or quads, summed over all instances.
+		u64 instances            = 0;
+
+	/* Bindings; Only the ones StateCache did not filter out as redundant: */
+		u64 program_binds        = 0;
+		u64 vertex_array_binds   = 0;
+		u64 texture_binds        = 0;
+		u64 framebuffer_binds    = 0;
+
+	/* Uploads: */
+		u64 uniform_bytes        = 0; // Via glUniform*().
+		u64 uniform_buffer_bytes = 0; // Via Buffer::Upload() & Buffer::Upload_Partial() (i.e., including partial uploads of DirtyBlob ranges).
+		u64 buffer_reallocations = 0; // Buffer storage (re-)allocations; Expected to be zero in a steady-state frame.
+
+		Counters operator-( const Counters& other ) const;
+	};
+
+	struct CounterField
+	{
+		const char* name; // snake_case; Used as the CSV column name.
+		const char* display_name;
+		u64 Counters::* member;
+	};
+
+	inline constexpr std::array< CounterField, 12 > COUNTER_FIELDS =
+	{ {
+		{ "draw_calls",				"Draw Calls",				&Counters::draw_calls			},
+		{ "draw_calls_indexed",		"Draw Calls (Indexed)",		&Counters::draw_calls_indexed	},
+		{ "draw_calls_instanced",	"Draw Calls (Instanced)",	&Counters::draw_calls_instanced	},
+		{ "primitives",				"Primitives",				&Counters::primitives			},
+		{ "instances",				"Instances",				&Counters::instances			},
+		{ "program_binds",			"Program Binds",			&Counters::program_binds		},
+		{ "vertex_array_binds",		"Vertex Array Binds",		&Counters::vertex_array_binds	},
+		{ "texture_binds",			"Texture Binds",			&Counters::texture_binds		},
+		{ "framebuffer_binds",		"Framebuffer Binds",		&Counters::framebuffer_binds	},
+		{ "uniform_bytes",			"Uniform Bytes",			&Counters::uniform_bytes		},
+		{ "uniform_buffer_bytes",	"Uniform Buffer Bytes",		&Counters::uniform_buffer_bytes	},
+		{ "buffer_reallocations",	"Buffer Reallocations",		&Counters::buffer_reallocations	},
+	} };
+
+	/* Totals since start-up; Never reset, so the work done by any stretch of code is the difference of two snapshots. */
+	Counters& RunningCounters();
+}
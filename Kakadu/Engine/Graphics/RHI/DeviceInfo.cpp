@@ -40,6 +40,9 @@ namespace Kakadu::RHI
 		const char* renderer_cstr =
 			reinterpret_cast< const char* >( glGetString( GL_RENDERER ) );
 
+		const char* version_cstr =
+			reinterpret_cast< const char* >( glGetString( GL_VERSION ) );
+
 		if( vendor_cstr )
 		{
 			info.vendor_name = vendor_cstr;
@@ -51,6 +54,11 @@ namespace Kakadu::RHI
 			info.device_name = renderer_cstr;
 		}
 
+		if( version_cstr )
+		{
+			info.driver_version = version_cstr;
+		}
+
 		return info;
 	}
 }
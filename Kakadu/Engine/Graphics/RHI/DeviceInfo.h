@@ -22,6 +22,7 @@ namespace Kakadu::RHI
 
 		std::string device_name;
 		std::string vendor_name;
+		std::string driver_version;
 		Vendor vendor = Vendor::Unknown;
 	};
 
@@ -3,6 +3,7 @@
 #include "DebugLabel.h"
 #include "Framebuffer.h"
 #include "GLLabelPrefixes.h"
+#include "StateCache.h"
 #include "Core/Assertion.h"
 #include "Core/AssetDatabase_Tracked.hpp"
 #include "Core/Platform.h"
@@ -185,19 +186,39 @@ namespace Kakadu::RHI
 		CreateAttachments();
 	}
 
+	void Framebuffer::AttachLayer( const i32 layer_index )
+	{
+		ASSERT_DEBUG_ONLY( IsLayered() && layer_index >= 0 && layer_index < description.array_layer_count && "Framebuffer::AttachLayer(): Invalid layer!" );
+
+		constexpr i32 gl_spec_required_level = 0;
+
+		if( HasColorAttachment() )
+			glNamedFramebufferTextureLayer( id.id, GL_COLOR_ATTACHMENT0, color_attachment.Id().id, gl_spec_required_level, layer_index );
+
+		if( HasCombinedDepthStencilAttachment() )
+			glNamedFramebufferTextureLayer( id.id, GL_DEPTH_STENCIL_ATTACHMENT, depth_stencil_attachment.Id().id, gl_spec_required_level, layer_index );
+		else
+		{
+			if( HasSeparateDepthAttachment() )
+				glNamedFramebufferTextureLayer( id.id, GL_DEPTH_ATTACHMENT, depth_attachment.Id().id, gl_spec_required_level, layer_index );
+			if( HasSeparateStencilAttachment() )
+				glNamedFramebufferTextureLayer( id.id, GL_STENCIL_ATTACHMENT, stencil_attachment.Id().id, gl_spec_required_level, layer_index );
+		}
+	}
+
 	void Framebuffer::ActivateForReadWrite() const
 	{
-		glBindFramebuffer( ( GLenum )ActivationMode::Both, id.id );
+		StateCache::BindFramebuffer( ( GLenum )ActivationMode::Both, id.id );
 	}
 
 	void Framebuffer::ActivateForRead() const
 	{
-		glBindFramebuffer( ( GLenum )ActivationMode::Read, id.id );
+		StateCache::BindFramebuffer( ( GLenum )ActivationMode::Read, id.id );
 	}
 
 	void Framebuffer::ActivateForWrite() const
 	{
-		glBindFramebuffer( ( GLenum )ActivationMode::Write, id.id );
+		StateCache::BindFramebuffer( ( GLenum )ActivationMode::Write, id.id );
 	}
 
 	void Framebuffer::Create()
@@ -273,6 +294,8 @@ namespace Kakadu::RHI
 							 attachment_type_enum == GL_DEPTH_STENCIL_ATTACHMENT ) &&
 						   "Invalid attachment type enum passed to Texture::CreateTextureAndAttachToFramebuffer()" );
 
+		ASSERT_DEBUG_ONLY( not ( IsMultiSampled() && description.array_layer_count > 0 ) && "Multi-sampled array framebuffers are not supported!" );
+
 		if( IsMultiSampled() )
 		{
 			std::string full_name( this->name + attachment_type_name + std::to_string( size.X() ) + "x" + std::to_string( size.Y() ) +
@@ -285,6 +308,23 @@ namespace Kakadu::RHI
 				
 			Kakadu::ServiceLocator< AssetDatabase_Tracked< Texture* > >::Get().AddOrUpdateAsset( &attachment_texture );
 		}
+		else if( description.array_layer_count > 0 )
+		{
+			std::string full_name( this->name + attachment_type_name + std::to_string( size.X() ) + "x" + std::to_string( size.Y() ) +
+								   "x" + std::to_string( description.array_layer_count ) );
+			attachment_texture = Texture( Texture::TEXTURE_2D_ARRAY_CONSTRUCTOR,
+										  full_name, format,
+										  size.X(),
+										  size.Y(),
+										  description.array_layer_count,
+										  description.wrap_u,
+										  description.wrap_v,
+										  description.border_color,
+										  description.minification_filter,
+										  description.magnification_filter );
+
+			Kakadu::ServiceLocator< AssetDatabase_Tracked< Texture* > >::Get().AddOrUpdateAsset( &attachment_texture );
+		}
 		else
 		{
 			std::string full_name( this->name + attachment_type_name + std::to_string( size.X() ) + "x" + std::to_string( size.Y() ) );
@@ -301,13 +341,17 @@ namespace Kakadu::RHI
 		}
 
 		constexpr i32 gl_spec_required_level = 0;
-		glFramebufferTexture2D( ( GLenum )ActivationMode::Write,
-								attachment_type_enum,
-								msaa.IsEnabled()
-									? GL_TEXTURE_2D_MULTISAMPLE
-									: GL_TEXTURE_2D,
-								attachment_texture.Id().id,
-								gl_spec_required_level );
+
+		if( description.array_layer_count > 0 ) // Starts out with the first layer attached; See AttachLayer().
+			glFramebufferTextureLayer( ( GLenum )ActivationMode::Write, attachment_type_enum, attachment_texture.Id().id, gl_spec_required_level, 0 );
+		else
+			glFramebufferTexture2D( ( GLenum )ActivationMode::Write,
+									attachment_type_enum,
+									msaa.IsEnabled()
+										? GL_TEXTURE_2D_MULTISAMPLE
+										: GL_TEXTURE_2D,
+									attachment_texture.Id().id,
+									gl_spec_required_level );
 	}
 
 	void Framebuffer::SetClearColor( const Color3& new_clear_color )
@@ -359,6 +403,7 @@ namespace Kakadu::RHI
 			}
 
 			glDeleteFramebuffers( 1, &id.id );
+			StateCache::ForgetFramebuffer( id.id );
 			id.Reset(); // OpenGL does not reset the id to zero.
 		}
 	}
@@ -43,7 +43,9 @@ namespace Kakadu::RHI
 			BitFlags< AttachmentType > attachment_bits;
 			MSAA msaa; // No MSAA by default.
 
-			// 5 bytes of padding.
+			// 1 byte of padding.
+
+			i32 array_layer_count = 0; // Non-zero => Attachments are 2D texture arrays (can not be combined with MSAA); See AttachLayer().
 		};
 
 		Framebuffer();
@@ -64,6 +66,8 @@ namespace Kakadu::RHI
 
 	/* Usage: */
 		void Resize( const i32 new_width_in_pixels, const i32 new_height_in_pixels );
+		/* Only for array framebuffers: Attaches the given layer of every attachment, so that subsequent draws & clears only affect that layer. */
+		void AttachLayer( const i32 layer_index );
 
 		void ActivateForReadWrite() const;
 		void ActivateForRead() const;
@@ -82,6 +86,8 @@ namespace Kakadu::RHI
 
 		i32	 SampleCount()	  const { return msaa.sample_count; }
 		bool IsMultiSampled() const { return msaa.IsEnabled(); }
+		bool IsLayered()	  const { return description.array_layer_count > 0; }
+		i32	 LayerCount()	  const { return IsLayered() ? description.array_layer_count : 1; }
 
 		/* Default framebuffer always uses sRGB Encoding. */
 		bool Is_sRGB() const { return not IsValid() || ( HasColorAttachment() && color_attachment.Is_sRGB() ); }
@@ -9,6 +9,9 @@
 #define GL_LABEL_PREFIX_INSTANCE_BUFFER	"\U0001F53A\U0001F53A\U0001F53A "
 #define GL_LABEL_PREFIX_INDEX_BUFFER	"\U0001F522 "
 #define GL_LABEL_PREFIX_UNIFORM_BUFFER	"\U0001F4E6 "
+#define GL_LABEL_PREFIX_STORAGE_BUFFER	"\U0001F4DA "
+#define GL_LABEL_PREFIX_INDIRECT_BUFFER	"\U0001F4CB "
+#define GL_LABEL_PREFIX_PIXEL_UNPACK_BUFFER	"\U0001F4E5 "
 #define GL_LABEL_PREFIX_VERTEX_ARRAY	"\U0001F1FB\U0001F1E6\U0001F1F4 "
 #define GL_LABEL_PREFIX_TEXTURE			"\U0001F5BC\U0000FE0F "
 #define GL_LABEL_PREFIX_FRAMEBUFFER		"\U0001F5A5\U0000FE0F "
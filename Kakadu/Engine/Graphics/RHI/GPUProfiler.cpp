@@ -0,0 +1,127 @@
+// Engine Includes.
+#include "GPUProfiler.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Kakadu::RHI
+{
+	GPUProfiler::Scope::Scope( GPUProfiler& profiler, std::string_view name )
+		:
+		profiler( profiler ),
+		scope_index( profiler.BeginScope( name ) )
+	{
+	}
+
+	GPUProfiler::Scope::~Scope()
+	{
+		profiler.EndScope( scope_index );
+	}
+
+	GPUProfiler::GPUProfiler()
+		:
+		is_enabled( true ),
+		frames{},
+		frame_slot( 0 ),
+		current_depth( 0 ),
+		frame_index( 0 ),
+		timings_resolved_frame_index( 0 ),
+		dropped_frame_count( 0 )
+	{
+	}
+
+	GPUProfiler::~GPUProfiler()
+	{
+		for( auto& frame : frames )
+			if( not frame.queries.empty() )
+				glDeleteQueries( ( GLsizei )frame.queries.size(), frame.queries.data() );
+	}
+
+	void GPUProfiler::BeginFrame()
+	{
+		frame_slot = ( frame_slot + 1 ) % FRAME_LATENCY;
+		frame_index++;
+
+		/* This slot was last recorded FRAME_LATENCY frames ago. */
+		auto& frame = frames[ frame_slot ];
+
+		if( frame.scope_count > 0 )
+			Resolve( frame );
+
+		frame.scope_count = 0;
+		frame.frame_index = frame_index;
+		current_depth     = 0;
+	}
+
+	u32 GPUProfiler::BeginScope( std::string_view name )
+	{
+		if( not is_enabled )
+			return INVALID_SCOPE_INDEX;
+
+		auto& frame = frames[ frame_slot ];
+
+		const u32 scope_index = frame.scope_count++;
+
+		if( const std::size_t query_count = 2 * ( std::size_t )frame.scope_count;
+			frame.queries.size() < query_count )
+		{
+			const std::size_t previous_query_count = frame.queries.size();
+			frame.queries.resize( std::max( query_count, 2 * previous_query_count ) );
+			glGenQueries( ( GLsizei )( frame.queries.size() - previous_query_count ), frame.queries.data() + previous_query_count );
+		}
+
+		if( frame.scopes.size() < frame.scope_count )
+			frame.scopes.emplace_back();
+
+		auto& scope = frame.scopes[ scope_index ];
+		scope.name.assign( name );
+		scope.depth = current_depth++;
+
+		glQueryCounter( frame.queries[ 2 * scope_index ], GL_TIMESTAMP );
+		frame.last_issued_query_index = 2 * scope_index;
+
+		return scope_index;
+	}
+
+	void GPUProfiler::EndScope( const u32 scope_index )
+	{
+		if( scope_index == INVALID_SCOPE_INDEX )
+			return;
+
+		auto& frame = frames[ frame_slot ];
+
+		glQueryCounter( frame.queries[ 2 * scope_index + 1 ], GL_TIMESTAMP );
+		frame.last_issued_query_index = 2 * scope_index + 1;
+
+		current_depth--;
+	}
+
+	void GPUProfiler::Resolve( FrameRecord& frame )
+	{
+		/* Queries complete in order, so the last one issued being available means all of them are. */
+		GLint is_available = GL_FALSE;
+		glGetQueryObjectiv( frame.queries[ frame.last_issued_query_index ], GL_QUERY_RESULT_AVAILABLE, &is_available );
+
+		if( not is_available )
+		{
+			dropped_frame_count++;
+			return;
+		}
+
+		timings_resolved.resize( frame.scope_count );
+
+		for( u32 scope_index = 0; scope_index < frame.scope_count; scope_index++ )
+		{
+			GLuint64 timestamp_begin = 0, timestamp_end = 0;
+			glGetQueryObjectui64v( frame.queries[ 2 * scope_index ],	 GL_QUERY_RESULT, &timestamp_begin );
+			glGetQueryObjectui64v( frame.queries[ 2 * scope_index + 1 ], GL_QUERY_RESULT, &timestamp_end );
+
+			auto& timing = timings_resolved[ scope_index ];
+			timing.name.assign( frame.scopes[ scope_index ].name );
+			timing.depth          = frame.scopes[ scope_index ].depth;
+			timing.duration_in_ms = ( float )( ( double )( timestamp_end - timestamp_begin ) / 1'000'000.0 ); // Timestamps are in nanoseconds.
+		}
+
+		timings_resolved_frame_index = frame.frame_index;
+	}
+}
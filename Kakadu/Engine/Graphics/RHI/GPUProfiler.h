@@ -0,0 +1,105 @@
+#pragma once
+
+// Engine Includes.
+#include "RHI.h"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#define KAKADU_GPU_PROFILE_SCOPE( profiler, name ) Kakadu::RHI::GPUProfiler::Scope kakadu_gpu_profile_scope_object( profiler, name );
+
+namespace Kakadu::RHI
+{
+	/* Measures the GPU time spent in (nested) scopes via timestamp queries.
+	 * Queries of a frame are read back FRAME_LATENCY frames later, by which point the GPU is expected to be done with them; Results are never waited on.
+	 * If they are still not available by then, that frame's timings are dropped instead. */
+	class GPUProfiler
+	{
+	public:
+		static constexpr u32 FRAME_LATENCY = 4;
+
+		struct Timing
+		{
+			std::string name;
+			u32 depth; // 0 for the outermost scopes. Timings are in depth-first order, i.e., the children of a Timing directly follow it.
+			float duration_in_ms;
+		};
+
+		/* RAII wrapper for BeginScope()/EndScope(). */
+		class Scope
+		{
+		public:
+			Scope( GPUProfiler& profiler, std::string_view name );
+			~Scope();
+
+			DELETE_COPY_AND_MOVE_CONSTRUCTORS( Scope );
+
+		private:
+			GPUProfiler& profiler;
+			u32 scope_index;
+		};
+
+	public:
+		GPUProfiler();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( GPUProfiler );
+
+		~GPUProfiler();
+
+	/* Usage: */
+
+		/* Reads back the timings of the frame issued FRAME_LATENCY frames ago (if available) & starts recording a new frame. */
+		void BeginFrame();
+
+		/* Returns the index to pass to EndScope(). */
+		u32 BeginScope( std::string_view name );
+		void EndScope( const u32 scope_index );
+
+	/* Queries: */
+
+		const std::vector< Timing >& LastResolvedFrameTimings() const { return timings_resolved; }
+		u64 LastResolvedFrameIndex() const { return timings_resolved_frame_index; }
+		u64 DroppedFrameCount() const { return dropped_frame_count; }
+
+	public:
+		bool is_enabled;
+
+	private:
+		static constexpr u32 INVALID_SCOPE_INDEX = ( u32 )-1;
+
+		struct ScopeRecord
+		{
+			std::string name;
+			u32 depth;
+			/* Begin & end timestamps are queries 2 * index & 2 * index + 1. */
+		};
+
+		struct FrameRecord
+		{
+			std::vector< GLuint > queries;
+			std::vector< ScopeRecord > scopes; // Not shrunk between frames, so that the names' storage is re-used.
+			u32 scope_count = 0;
+			/* Scopes end in reverse order of their beginning, so this is not necessarily the last scope's end query (e.g., that of an outermost "Frame" scope is issued last). */
+			u32 last_issued_query_index = 0;
+			u64 frame_index = 0;
+		};
+
+	private:
+		void Resolve( FrameRecord& frame );
+
+	private:
+		std::array< FrameRecord, FRAME_LATENCY > frames;
+		u32 frame_slot;
+		u32 current_depth;
+		u64 frame_index;
+
+		std::vector< Timing > timings_resolved;
+		u64 timings_resolved_frame_index;
+		u64 dropped_frame_count;
+	};
+}
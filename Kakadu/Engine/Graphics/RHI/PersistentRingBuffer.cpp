@@ -0,0 +1,136 @@
+// Engine Includes.
+#include "PersistentRingBuffer.h"
+#include "Counters.h"
+#include "DebugLabel.h"
+#include "Core/Assertion.h"
+
+namespace Kakadu::RHI
+{
+	void WaitForAndDeleteFence( GLsync& fence )
+	{
+		if( not fence )
+			return;
+
+		GLenum result = glClientWaitSync( fence, 0, 0 );
+		while( result == GL_TIMEOUT_EXPIRED )
+			result = glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000 /* 1 ms. */ );
+
+		glDeleteSync( fence );
+		fence = nullptr;
+	}
+
+	u32 ShaderStorageBufferOffsetAlignment()
+	{
+		GLint offset_alignment = 0;
+		glGetIntegerv( GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offset_alignment );
+		return offset_alignment > 0 ? ( u32 )offset_alignment : 1;
+	}
+
+	PersistentRingBuffer::PersistentRingBuffer( const u32 initial_region_size, const u32 region_alignment, const char* debug_label )
+		:
+		buffer_id(),
+		region_size( initial_region_size ),
+		region_alignment( region_alignment > 0 ? region_alignment : 1 ),
+		region_index( 0 ),
+		used_size( 0 ),
+		mapped_memory( nullptr ),
+		debug_label( debug_label ),
+		fences{}
+	{
+		ASSERT_DEBUG_ONLY( initial_region_size > 0 && "PersistentRingBuffer needs a non-zero region size!" );
+
+		Create();
+	}
+
+	PersistentRingBuffer::~PersistentRingBuffer()
+	{
+		Delete();
+	}
+
+	void PersistentRingBuffer::BeginFrame()
+	{
+		fences[ region_index ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+		region_index = ( region_index + 1 ) % REGION_COUNT;
+		used_size    = 0;
+
+		WaitForAndDeleteFence( fences[ region_index ] );
+	}
+
+	bool PersistentRingBuffer::Reserve( const u32 size, const u32 alignment )
+	{
+		if( const u32 required_size = AlignedUsedSize( alignment ) + size;
+			required_size > region_size )
+		{
+			Grow( required_size );
+			return true;
+		}
+
+		return false;
+	}
+
+	u32 PersistentRingBuffer::Allocate( const u32 size, const u32 alignment )
+	{
+		const u32 offset_in_region = AlignedUsedSize( alignment );
+
+		ASSERT_DEBUG_ONLY( offset_in_region + size <= region_size && "PersistentRingBuffer::Allocate() called without enough room Reserve()d!" );
+
+		used_size = offset_in_region + size;
+
+		return CurrentRegionOffset() + offset_in_region;
+	}
+
+	void PersistentRingBuffer::Create()
+	{
+		region_size = ( region_size + region_alignment - 1 ) / region_alignment * region_alignment;
+
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers( 1, &buffer_id.id );
+		glNamedBufferStorage( buffer_id.id, region_size * REGION_COUNT, nullptr, flags );
+		mapped_memory = reinterpret_cast< std::byte* >( glMapNamedBufferRange( buffer_id.id, 0, region_size * REGION_COUNT, flags ) );
+
+		RunningCounters().buffer_reallocations++;
+
+		ASSERT_DEBUG_ONLY( mapped_memory && "PersistentRingBuffer could not be mapped!" );
+
+#ifdef _EDITOR
+		DebugLabel::Set( GL_BUFFER, buffer_id.id, debug_label );
+#endif // _EDITOR
+
+		region_index = 0;
+		used_size    = 0;
+	}
+
+	void PersistentRingBuffer::Delete()
+	{
+		for( auto& fence : fences )
+		{
+			if( fence )
+			{
+				glDeleteSync( fence );
+				fence = nullptr;
+			}
+		}
+
+		if( buffer_id )
+		{
+			glUnmapNamedBuffer( buffer_id.id );
+			glDeleteBuffers( 1, &buffer_id.id );
+			buffer_id.Reset();
+		}
+
+		mapped_memory = nullptr;
+	}
+
+	void PersistentRingBuffer::Grow( const u32 minimum_region_size )
+	{
+		/* Draws issued so far this frame still reference the current buffer; Let them finish before it is deleted. */
+		glFinish();
+
+		Delete();
+		while( region_size < minimum_region_size )
+			region_size *= 2;
+		Create();
+	}
+}
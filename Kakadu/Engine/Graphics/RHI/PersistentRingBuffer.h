@@ -0,0 +1,76 @@
+#pragma once
+
+// Engine Includes.
+#include "RHI.h"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "ID/BufferID.h"
+
+// std Includes.
+#include <array>
+#include <cstddef>
+
+namespace Kakadu::RHI
+{
+	/* Waits (flushing if necessary) until the GPU signals the fence, then deletes it. No-op for null fences. */
+	void WaitForAndDeleteFence( GLsync& fence );
+	/* GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT; For ring buffers whose allocations are bound as shader storage buffer ranges. */
+	u32 ShaderStorageBufferOffsetAlignment();
+
+	/* A single buffer, persistently & coherently mapped once and split into REGION_COUNT regions, which are used round-robin (one per frame).
+	 * A fence is placed after each frame & waited on before its region is reused, so the CPU never overwrites data that the GPU may still be reading.
+	 * Allocations are appended to the current region; When a frame needs more than a region holds, the buffer is re-created with larger regions. */
+	class PersistentRingBuffer
+	{
+	public:
+		static constexpr u32 REGION_COUNT = 3;
+
+	public:
+		/* Region sizes & offsets are kept a multiple of region_alignment (e.g., GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT for ranges bound as whole regions).
+		 * debug_label is expected to outlive the buffer (i.e., a string literal). */
+		PersistentRingBuffer( const u32 initial_region_size, const u32 region_alignment, const char* debug_label );
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( PersistentRingBuffer );
+
+		~PersistentRingBuffer();
+
+	/* Usage: */
+
+		/* Fences the region used by the previous frame & moves on to the next region (waiting for the GPU to be done with it if necessary). */
+		void BeginFrame();
+
+		/* Makes room for size more bytes (after aligning to alignment) in the current region.
+		 * Returns true if the buffer had to be re-created for that; This stalls until the GPU is idle, discards the frame's earlier allocations & the new buffer needs to be (re-)bound. */
+		bool Reserve( const u32 size, const u32 alignment = 1 );
+
+		/* Returns the offset (from the buffer start) of size bytes in the current region, aligned to alignment. Room has to be Reserve()d beforehand. */
+		u32 Allocate( const u32 size, const u32 alignment = 1 );
+
+	/* Queries: */
+
+		u32 Id()					const { return buffer_id.id; }
+		std::byte* MappedMemory()	const { return mapped_memory; }
+
+		u32 RegionSize()			const { return region_size; }
+		u32 CurrentRegionOffset()	const { return region_index * region_size; }
+		u32 UsedSize()				const { return used_size; } // Bytes allocated in the current region so far.
+
+	private:
+		void Create();
+		void Delete();
+		/* Stalls until the GPU is idle. */
+		void Grow( const u32 minimum_region_size );
+
+		u32 AlignedUsedSize( const u32 alignment ) const { return ( used_size + alignment - 1 ) / alignment * alignment; }
+
+	private:
+		BufferID buffer_id;
+		u32 region_size; // In bytes.
+		u32 region_alignment;
+		u32 region_index;
+		u32 used_size;
+		std::byte* mapped_memory;
+		const char* debug_label;
+		std::array< GLsync, REGION_COUNT > fences;
+	};
+}
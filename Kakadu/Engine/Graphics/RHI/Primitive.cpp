@@ -22,4 +22,22 @@ namespace Kakadu::RHI
 		ASSERT( false && "Invalid primitive in Kakadu::RHI::PrimitiveToGLEnum( primitive )!" );
 		return GL_NONE;
 	}
+
+	u32 PrimitiveCount( Primitive primitive, const u32 vertex_count )
+	{
+		switch( primitive )
+		{
+			case Kakadu::RHI::Primitive::Points:			return vertex_count;
+			case Kakadu::RHI::Primitive::Lines:				return vertex_count / 2;
+			case Kakadu::RHI::Primitive::Line_loop:			return vertex_count >= 2 ? vertex_count : 0;
+			case Kakadu::RHI::Primitive::Line_strip:		return vertex_count >= 2 ? vertex_count - 1 : 0;
+			case Kakadu::RHI::Primitive::Triangles:			return vertex_count / 3;
+			case Kakadu::RHI::Primitive::Triangle_strip:	return vertex_count >= 3 ? vertex_count - 2 : 0;
+			case Kakadu::RHI::Primitive::Triangle_fan:		return vertex_count >= 3 ? vertex_count - 2 : 0;
+			case Kakadu::RHI::Primitive::Quads:				return vertex_count / 4;
+		}
+
+		ASSERT( false && "Invalid primitive in Kakadu::RHI::PrimitiveCount( primitive, vertex_count )!" );
+		return 0;
+	}
 }
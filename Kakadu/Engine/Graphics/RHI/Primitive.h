@@ -18,4 +18,6 @@ namespace Kakadu::RHI
 	};
 
 	u32 PrimitiveToGLEnum( Primitive );
+	/* Number of primitives assembled from vertex_count vertices (or indices). */
+	u32 PrimitiveCount( Primitive, const u32 vertex_count );
 }
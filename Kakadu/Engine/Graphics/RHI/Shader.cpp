@@ -12,6 +12,8 @@
 #include "GLLabelPrefixes.h"
 #include "Shader.hpp"
 #include "ShaderIncludePreprocessing.h"
+#include "ShaderProgramCache.h"
+#include "StateCache.h"
 #include "UniformBlockBindingPointManager.h"
 #include "Core/BitFlags.hpp"
 #include "Core/Log.h"
@@ -25,6 +27,26 @@
 
 namespace Kakadu::RHI
 {
+	/* State kept between the phases of a compilation (see ShaderCompiler). */
+	struct Shader::PendingCompilation
+	{
+		std::string vertex_source;
+		std::optional< std::string > geometry_source;
+		std::string fragment_source;
+
+		std::unordered_map< i16, std::filesystem::path > vertex_map_of_IDs_per_include_file;
+		std::unordered_map< i16, std::filesystem::path > geometry_map_of_IDs_per_include_file;
+		std::unordered_map< i16, std::filesystem::path > fragment_map_of_IDs_per_include_file;
+
+		u32 vertex_shader_id   = 0;
+		u32 geometry_shader_id = 0;
+		u32 fragment_shader_id = 0;
+
+		bool program_binary_cache_is_supported = false;
+		/* 3 bytes of padding. */
+		u64 program_binary_cache_key = 0;
+	};
+
 	/* Will be initialized later with FromFile(). */
 	Shader::Shader( const char* name )
 		:
@@ -77,13 +99,12 @@ namespace Kakadu::RHI
 		feature_map( std::move( donor.feature_map ) ),
 
 		uniform_info_map( std::move( donor.uniform_info_map ) ),
+		uniform_info_per_handle( std::move( donor.uniform_info_per_handle ) ),
 
 		uniform_buffer_info_map_regular( std::move( donor.uniform_buffer_info_map_regular ) ),
 		uniform_buffer_info_map_global( std::move( donor.uniform_buffer_info_map_global ) ),
 		uniform_buffer_info_map_intrinsic( std::move( donor.uniform_buffer_info_map_intrinsic ) ),
 
-		last_write_time_map( std::exchange( donor.last_write_time_map, {} ) ),
-
 		uniform_book_keeping_info( std::move( donor.uniform_book_keeping_info ) ),
 
 		uniform_annotation_format_string_table( std::move( donor.uniform_annotation_format_string_table ) ),
@@ -91,17 +112,23 @@ namespace Kakadu::RHI
 		vertex_layout_source( std::move( donor.vertex_layout_source ) ),
 		vertex_layout_active( std::move( donor.vertex_layout_active ) )
 	{
+		ASSERT_DEBUG_ONLY( not donor.pending_compilation && "Shader moved while its compilation is pending!" );
+
 		Delete();
 
-		program_id = std::exchange( donor.program_id, {} );
+		program_id                 = std::exchange( donor.program_id, {} );
+		uses_draw_transform_buffer = std::exchange( donor.uses_draw_transform_buffer, false );
 	}
 
 	Shader& Shader::operator=( Shader&& donor )
 	{
+		ASSERT_DEBUG_ONLY( not pending_compilation && not donor.pending_compilation && "Shader moved while its compilation is pending!" );
+
 		Delete();
 
-		program_id = std::exchange( donor.program_id, {} );
-		name       = std::exchange( donor.name, "<scheduled-for-deletion>" );
+		program_id                 = std::exchange( donor.program_id, {} );
+		uses_draw_transform_buffer = std::exchange( donor.uses_draw_transform_buffer, false );
+		name                       = std::exchange( donor.name, "<scheduled-for-deletion>" );
 
 		vertex_source_path   = std::move( donor.vertex_source_path );
 		geometry_source_path = std::move( donor.geometry_source_path );
@@ -114,14 +141,13 @@ namespace Kakadu::RHI
 		features_requested = std::move( donor.features_requested );
 		feature_map        = std::move( donor.feature_map );
 
-		uniform_info_map = std::move( donor.uniform_info_map );
+		uniform_info_map        = std::move( donor.uniform_info_map );
+		uniform_info_per_handle = std::move( donor.uniform_info_per_handle );
 
 		uniform_buffer_info_map_regular   = std::move( donor.uniform_buffer_info_map_regular );
 		uniform_buffer_info_map_global    = std::move( donor.uniform_buffer_info_map_global );
 		uniform_buffer_info_map_intrinsic = std::move( donor.uniform_buffer_info_map_intrinsic );
 
-		last_write_time_map = std::exchange( donor.last_write_time_map, {} );
-
 		uniform_book_keeping_info = std::move( donor.uniform_book_keeping_info );
 
 		uniform_annotation_format_string_table = std::move( donor.uniform_annotation_format_string_table );
@@ -151,183 +177,20 @@ namespace Kakadu::RHI
 						   const FragmentShaderSourcePath& fragment_shader_source_path,
 						   const Features& features_to_set )
 	{
-		this->vertex_source_path   = ( std::string )vertex_shader_source_path;
-		this->geometry_source_path = ( std::string )geometry_shader_source_path;
-		this->fragment_source_path = ( std::string )fragment_shader_source_path;
-
-		features_requested = features_to_set;
-
-		/* Even though the shader may fail the following compilation or linking stages, last write time should be set in order to make recompilation (due to user modification of sources) possible. */
-		auto SaveTimeIfValid = [ & ]( auto& path )
-		{
-			std::error_code error_code;
-			auto t = std::filesystem::last_write_time( path, error_code );
-			if( error_code )
-				std::cerr << "ERROR::SHADER::COMPILATION::LAST_WRITE_TIME_COULD_NOT_BE_OBTAINED\n\t" << error_code.message() << "\n";
-			else
-				last_write_time_map.emplace( path, t );
-		};
-
-		SaveTimeIfValid( vertex_source_path );
-		if( not geometry_shader_source_path.Empty() )
-			SaveTimeIfValid( geometry_source_path );
-		SaveTimeIfValid( fragment_source_path );
-
-		u32 vertex_shader_id = 0, geometry_shader_id = 0, fragment_shader_id = 0;
-
-		std::optional< std::string > vertex_shader_source;
-		std::optional< std::string > geometry_shader_source;
-		std::optional< std::string > fragment_shader_source;
-		std::unordered_map< std::string, Feature > vertex_shader_features;
-		std::unordered_map< std::string, Feature > geometry_shader_features;
-		std::unordered_map< std::string, Feature > fragment_shader_features;
-
-		if( vertex_shader_source = ParseShaderFromFile( vertex_shader_source_path, ShaderType::Vertex );
-			vertex_shader_source )
-		{
-			auto& shader_source = *vertex_shader_source;
-
-			std::unordered_map< i16, std::filesystem::path > map_of_IDs_per_include_file;
-
-			vertex_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-			PreProcessShaderStage_IncludeDirectives( vertex_shader_source_path, shader_source, ShaderType::Vertex, map_of_IDs_per_include_file );
-			vertex_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-			PreProcessShaderStage_SetFeatures( shader_source, vertex_shader_features, features_to_set );
-
-			if( !CompileShader( shader_source.c_str(), vertex_shader_id, ShaderType::Vertex, map_of_IDs_per_include_file ) )
-				return false;
-		}
-		else
-			return false;
-
-#ifdef _EDITOR
-		DebugLabel::Set( GL_SHADER, vertex_shader_id, GL_LABEL_PREFIX_VERTEX_SHADER + name );
-#endif // _EDITOR
-
-		feature_map.insert( vertex_shader_features.begin(), vertex_shader_features.end() );
-
-		if( not geometry_shader_source_path.Empty() )
-		{
-			if( geometry_shader_source = ParseShaderFromFile( geometry_shader_source_path, ShaderType::Geometry );
-				geometry_shader_source )
-			{
-				auto& shader_source = *geometry_shader_source;
-
-				std::unordered_map< i16, std::filesystem::path > map_of_IDs_per_include_file;
-
-				geometry_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-				PreProcessShaderStage_IncludeDirectives( geometry_shader_source_path, shader_source, ShaderType::Geometry, map_of_IDs_per_include_file );
-				geometry_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-				PreProcessShaderStage_SetFeatures( shader_source, geometry_shader_features, features_to_set );
-
-				if( !CompileShader( shader_source.c_str(), geometry_shader_id, ShaderType::Geometry, map_of_IDs_per_include_file ) )
-				{
-					glDeleteShader( vertex_shader_id );
-					return false;
-				}
-			}
-			else
-			{
-				glDeleteShader( vertex_shader_id );
-				return false;
-			}
-
-			feature_map.insert( geometry_shader_features.begin(), geometry_shader_features.end() );
-
-#ifdef _EDITOR
-				DebugLabel::Set( GL_SHADER, geometry_shader_id, GL_LABEL_PREFIX_GEOMETRY_SHADER + name );
-#endif // _EDITOR
-		}
-
-		if( fragment_shader_source = ParseShaderFromFile( fragment_shader_source_path, ShaderType::Fragment );
-			fragment_shader_source )
-		{
-			auto& shader_source = *fragment_shader_source;
-
-			std::unordered_map< i16, std::filesystem::path > map_of_IDs_per_include_file;
-
-			fragment_source_include_path_array = PreprocessShaderStage_GetIncludeFilePaths( shader_source );
-			PreProcessShaderStage_IncludeDirectives( fragment_shader_source_path, shader_source, ShaderType::Fragment, map_of_IDs_per_include_file );
-			fragment_shader_features = PreProcessShaderStage_ParseFeatures( shader_source );
-			PreProcessShaderStage_SetFeatures( shader_source, fragment_shader_features, features_to_set );
-
-			if( !CompileShader( shader_source.c_str(), fragment_shader_id, ShaderType::Fragment, map_of_IDs_per_include_file ) )
-			{
-				glDeleteShader( vertex_shader_id );
-				if( geometry_shader_id > 0 )
-					glDeleteShader( geometry_shader_id );
-				return false;
-			}
-		}
-		else
-		{
-			glDeleteShader( vertex_shader_id );
-			if( geometry_shader_id > 0 )
-				glDeleteShader( geometry_shader_id );
-
+		if( not Compilation_Prepare( vertex_shader_source_path, geometry_shader_source_path, fragment_shader_source_path, features_to_set ) )
 			return false;
-		}
-
-#ifdef _EDITOR
-		DebugLabel::Set( GL_SHADER, fragment_shader_id, GL_LABEL_PREFIX_FRAGMENT_SHADER + name );
-#endif // _EDITOR
-
-		feature_map.insert( fragment_shader_features.begin(), fragment_shader_features.end() );
-
-		const bool link_result = LinkProgram( vertex_shader_id, geometry_shader_id, fragment_shader_id );
-
-		glDeleteShader( vertex_shader_id );
-		if( not geometry_shader_source_path.Empty() )
-			glDeleteShader( geometry_shader_id );
-		glDeleteShader( fragment_shader_id );
-
-		if( link_result )
-		{
-#ifdef _EDITOR
-			DebugLabel::Set( GL_PROGRAM, program_id.id, GL_LABEL_PREFIX_SHADER_PROGRAM + name );
-#endif // _EDITOR
-
-			QueryVertexAttributes();
-
-			GetUniformBookKeepingInfo();
-			if( uniform_book_keeping_info.count == 0 )
-				return true;
-
-			QueryUniformData();
-
-			ParseShaderSource_VertexLayout( *vertex_shader_source );
-			ParseShaderSource_UniformAnnotations( *vertex_shader_source, ShaderType::Vertex );
-			if( geometry_shader_source )
-				ParseShaderSource_UniformAnnotations( *geometry_shader_source, ShaderType::Geometry );
-			ParseShaderSource_UniformAnnotations( *fragment_shader_source, ShaderType::Fragment );
-
-			QueryUniformData_BlockIndexAndOffsetForBufferMembers();
-			QueryUniformBufferData( uniform_buffer_info_map_regular, Uniform::BufferCategory::Regular );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_regular );
-			QueryUniformBufferData( uniform_buffer_info_map_global, Uniform::BufferCategory::Global );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_global );
-			QueryUniformBufferData( uniform_buffer_info_map_intrinsic, Uniform::BufferCategory::Intrinsic );
-			QueryUniformBufferData_Aggregates( uniform_buffer_info_map_intrinsic );
 
-			CalculateTotalUniformSizes();
-			EnumerateUniformBufferCategories();
-
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_regular )
-				Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
-
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_global )
-				Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
-
-			for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_intrinsic )
-				Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
-		}
+		/* Served from the program binary cache. */
+		if( not pending_compilation )
+			return true;
 
-		return link_result;
+		Compilation_Submit();
+		return Compilation_Finish();
 	}
 
 	void Shader::Bind() const
 	{
-		glUseProgram( program_id.id );
+		StateCache::UseProgram( program_id.id );
 	}
 
 	bool Shader::RecompileFromThis( Shader& new_shader )
@@ -338,35 +201,6 @@ namespace Kakadu::RHI
 									features_requested );
 	}
 
-	bool Shader::SourceFilesAreModified()
-	{
-		for( auto& [ source, last_write_time ] : last_write_time_map )
-		{
-			std::error_code error_code;
-			if( const auto new_last_write_time = std::filesystem::last_write_time( source, error_code );
-				not error_code )
-			{
-				if( new_last_write_time != last_write_time )
-				{
-					last_write_time = new_last_write_time;
-					return true;
-				}
-			}
-			else if( error_code == std::errc::no_such_file_or_directory )
-			{
-				// File is probably temporarily missing due to overwrite, ignore and check again next frame:
-				continue;
-			}
-			else
-			{
-				std::cerr << "Shader::SourceFilesAreModified() (Category: " << error_code.category().name() << "): " << error_code << ".\n";
-				throw std::runtime_error( "Shader::SourceFilesAreModified() (Category: " + std::string( error_code.category().name() ) + "): " + error_code.message() + ".\n" );
-			}
-		}
-
-		return false;
-	}
-
 #ifdef _EDITOR
 	const char* Shader::GetAnnotationFormatString( const u16 annotation_format_string_id )
 	{
@@ -376,6 +210,8 @@ namespace Kakadu::RHI
 
 	void Shader::SetUniform( const Uniform::Information& uniform_info, const void* value_pointer )
 	{
+		RunningCounters().uniform_bytes += uniform_info.size;
+
 		switch( uniform_info.type )
 		{
 			/* Scalars & vectors: */
@@ -423,6 +259,8 @@ namespace Kakadu::RHI
 
 	void Shader::SetUniformArray( const Uniform::Information& uniform_info, const void* value_pointer )
 	{
+		RunningCounters().uniform_bytes += uniform_info.size * uniform_info.count_array;
+
 		switch( uniform_info.type )
 		{
 			/* Scalars & vectors: */
@@ -479,36 +317,171 @@ namespace Kakadu::RHI
 		if( IsValid() )
 		{
 			glDeleteProgram( program_id.id );
+			StateCache::ForgetProgram( program_id.id );
 			program_id.Reset(); // OpenGL does not reset the id to zero.
 		}
 	}
 
-	std::optional< std::string > Shader::ParseShaderFromFile( const char* file_path, const ShaderType shader_type )
+	bool Shader::Compilation_Prepare( const VertexShaderSourcePath& vertex_shader_source_path,
+									  const GeometryShaderSourcePath& geometry_shader_source_path,
+									  const FragmentShaderSourcePath& fragment_shader_source_path,
+									  const Features& features_to_set )
 	{
-		const std::string error_prompt( std::string( "Shader Error (parsing): " ) + ShaderTypeString( shader_type ) + " shader \"" + name + "\" could not be read successfully." );
+		ASSERT_DEBUG_ONLY( not pending_compilation && "Shader::Compilation_Prepare() called while a previous compilation is still pending!" );
 
-		if( const auto source = Kakadu::Utility::ReadFileIntoString( file_path, error_prompt.c_str() );
-			source )
-			return *source;
+		this->vertex_source_path   = ( std::string )vertex_shader_source_path;
+		this->geometry_source_path = ( std::string )geometry_shader_source_path;
+		this->fragment_source_path = ( std::string )fragment_shader_source_path;
+
+		features_requested = features_to_set;
 
-		LogErrors( error_prompt );
+		auto pending = std::make_unique< PendingCompilation >();
 
-		return std::nullopt;
+		/* All stages are preprocessed up-front, as their final sources make up the key of the program binary cache. */
+
+		if( auto vertex_shader_source = PreProcessShaderStage( vertex_shader_source_path, ShaderType::Vertex, features_to_set,
+															   vertex_source_include_path_array, pending->vertex_map_of_IDs_per_include_file ) )
+			pending->vertex_source = std::move( *vertex_shader_source );
+		else
+			return false;
+
+		if( not geometry_shader_source_path.Empty() )
+		{
+			pending->geometry_source = PreProcessShaderStage( geometry_shader_source_path, ShaderType::Geometry, features_to_set,
+															  geometry_source_include_path_array, pending->geometry_map_of_IDs_per_include_file );
+			if( not pending->geometry_source )
+				return false;
+		}
+
+		if( auto fragment_shader_source = PreProcessShaderStage( fragment_shader_source_path, ShaderType::Fragment, features_to_set,
+																 fragment_source_include_path_array, pending->fragment_map_of_IDs_per_include_file ) )
+			pending->fragment_source = std::move( *fragment_shader_source );
+		else
+			return false;
+
+		pending->program_binary_cache_is_supported = ShaderProgramCache::IsSupported();
+
+		if( pending->program_binary_cache_is_supported )
+		{
+			pending->program_binary_cache_key = ShaderProgramCache::ContentKey( *this, pending->vertex_source, pending->geometry_source.value_or( "" ), pending->fragment_source );
+
+			/* Warm start: Compilation, linkage & reflection are skipped altogether. */
+			if( ShaderProgramCache::Load( *this, pending->program_binary_cache_key ) )
+			{
+#ifdef _EDITOR
+				DebugLabel::Set( GL_PROGRAM, program_id.id, GL_LABEL_PREFIX_SHADER_PROGRAM + name );
+#endif // _EDITOR
+
+				if( uniform_book_keeping_info.count != 0 )
+					CompleteUniformBufferData();
+
+				return true;
+			}
+		}
+
+		pending_compilation = std::move( pending );
+		return true;
 	}
 
-	std::vector< std::string > Shader::PreprocessShaderStage_GetIncludeFilePaths( std::string shader_source ) const
+	void Shader::Compilation_Submit()
 	{
-		std::vector< std::string > includes;
+		auto& pending = *pending_compilation;
 
-		std::string_view shader_source_view( shader_source );
+		CompileShader_Submit( pending.vertex_source.c_str(), pending.vertex_shader_id, ShaderType::Vertex );
+		if( pending.geometry_source )
+			CompileShader_Submit( pending.geometry_source->c_str(), pending.geometry_shader_id, ShaderType::Geometry );
+		CompileShader_Submit( pending.fragment_source.c_str(), pending.fragment_shader_id, ShaderType::Fragment );
 
-		for( auto maybe_next_token = Utility::String::ParseTokenAndAdvance_SkipPrefix( shader_source_view, "#include", R"(")", R"(")" );
-			 maybe_next_token.has_value();
-			 maybe_next_token = Utility::String::ParseTokenAndAdvance_SkipPrefix( shader_source_view, "#include", R"(")", R"(")" ) )
+#ifdef _EDITOR
+		DebugLabel::Set( GL_SHADER, pending.vertex_shader_id, GL_LABEL_PREFIX_VERTEX_SHADER + name );
+		if( pending.geometry_source )
+			DebugLabel::Set( GL_SHADER, pending.geometry_shader_id, GL_LABEL_PREFIX_GEOMETRY_SHADER + name );
+		DebugLabel::Set( GL_SHADER, pending.fragment_shader_id, GL_LABEL_PREFIX_FRAGMENT_SHADER + name );
+#endif // _EDITOR
+
+		/* Linking can be submitted right away; A failed compilation simply results in a failed link, which is checked for in Compilation_Finish(). */
+		LinkProgram_Submit( pending.vertex_shader_id, pending.geometry_shader_id, pending.fragment_shader_id,
+							/* make binary retrievable: */ pending.program_binary_cache_is_supported );
+	}
+
+	bool Shader::Compilation_IsComplete() const
+	{
+		if( not pending_compilation )
+			return true;
+
+		i32 is_complete = GL_FALSE;
+		glGetProgramiv( program_id.id, GL_COMPLETION_STATUS_KHR, &is_complete );
+		return is_complete == GL_TRUE;
+	}
+
+	bool Shader::Compilation_Finish()
+	{
+		ASSERT_DEBUG_ONLY( pending_compilation && "Shader::Compilation_Finish() called without a pending compilation!" );
+
+		const auto pending = std::move( pending_compilation );
+
+		/* Check every stage (instead of stopping at the first failure), so that all errors are logged in one go. */
+		bool compilation_result = CompileShader_Check( pending->vertex_shader_id, ShaderType::Vertex, pending->vertex_map_of_IDs_per_include_file );
+		if( pending->geometry_source )
+			compilation_result &= CompileShader_Check( pending->geometry_shader_id, ShaderType::Geometry, pending->geometry_map_of_IDs_per_include_file );
+		compilation_result &= CompileShader_Check( pending->fragment_shader_id, ShaderType::Fragment, pending->fragment_map_of_IDs_per_include_file );
+
+		const bool link_result = compilation_result && LinkProgram_Check();
+
+		glDeleteShader( pending->vertex_shader_id );
+		if( pending->geometry_shader_id > 0 )
+			glDeleteShader( pending->geometry_shader_id );
+		glDeleteShader( pending->fragment_shader_id );
+
+		if( not link_result )
 		{
-			includes.emplace_back( std::string( ENGINE_SHADER_ROOT_ABSOLUTE "/" ) + std::string( *maybe_next_token ) );
+			Delete();
+			return false;
 		}
 
+#ifdef _EDITOR
+		DebugLabel::Set( GL_PROGRAM, program_id.id, GL_LABEL_PREFIX_SHADER_PROGRAM + name );
+#endif // _EDITOR
+
+		QueryProgramData( pending->vertex_source, pending->geometry_source ? &*pending->geometry_source : nullptr, pending->fragment_source );
+
+		if( uniform_book_keeping_info.count != 0 )
+			CompleteUniformBufferData();
+
+		if( pending->program_binary_cache_is_supported )
+			ShaderProgramCache::Store( *this, pending->program_binary_cache_key );
+
+		return true;
+	}
+
+	std::optional< std::string > Shader::PreProcessShaderStage( const char* shader_source_path,
+																const ShaderType shader_type,
+																const Features& features_to_set,
+																std::vector< std::string >& include_path_array,
+																std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file )
+	{
+		std::string shader_source;
+		if( not PreProcessShaderStage_IncludeDirectives( shader_source_path, shader_source, shader_type, map_of_IDs_per_source_file ) )
+			return std::nullopt;
+
+		include_path_array = PreprocessShaderStage_GetIncludeFilePaths( map_of_IDs_per_source_file );
+		auto stage_features = PreProcessShaderStage_ParseFeatures( shader_source );
+		PreProcessShaderStage_SetFeatures( shader_source, stage_features, features_to_set );
+
+		feature_map.insert( stage_features.begin(), stage_features.end() );
+
+		return shader_source;
+	}
+
+	std::vector< std::string > Shader::PreprocessShaderStage_GetIncludeFilePaths( const std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file ) const
+	{
+		/* IDs are assigned in the order files are first included, starting with 1 (0 is the main source file). This also covers nested #includes. */
+		std::vector< std::string > includes( map_of_IDs_per_source_file.size() - map_of_IDs_per_source_file.contains( 0 ) );
+
+		for( const auto& [ file_ID, source_file_path ] : map_of_IDs_per_source_file )
+			if( file_ID != 0 )
+				includes[ file_ID - 1 ] = source_file_path.generic_string();
+
 		return includes;
 	}
 
@@ -652,15 +625,17 @@ namespace Kakadu::RHI
 		return true;
 	}
 
-	bool Shader::CompileShader( const char* source,
-								u32& shader_id,
-								const ShaderType shader_type,
-								std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file )
+	void Shader::CompileShader_Submit( const char* source, u32& shader_id, const ShaderType shader_type )
 	{
 		shader_id = glCreateShader( ShaderTypeID( shader_type ) );
 		glShaderSource( shader_id, /* how many strings: */ 1, &source, NULL );
 		glCompileShader( shader_id );
+	}
 
+	bool Shader::CompileShader_Check( const u32 shader_id,
+									  const ShaderType shader_type,
+									  std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file ) const
+	{
 		i32 success = false;
 		glGetShaderiv( shader_id, GL_COMPILE_STATUS, &success );
 		if( !success )
@@ -672,23 +647,23 @@ namespace Kakadu::RHI
 		return true;
 	}
 
-	bool Shader::LinkProgram( const u32 vertex_shader_id, const u32 fragment_shader_id )
-	{
-		return LinkProgram( vertex_shader_id, 0, fragment_shader_id );
-	}
-
-
-	bool Shader::LinkProgram( const u32 vertex_shader_id, const u32 geometry_shader_id, const u32 fragment_shader_id )
+	void Shader::LinkProgram_Submit( const u32 vertex_shader_id, const u32 geometry_shader_id, const u32 fragment_shader_id, const bool make_binary_retrievable )
 	{
 		program_id.id = glCreateProgram();
 
+		if( make_binary_retrievable )
+			glProgramParameteri( program_id.id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+
 		glAttachShader( program_id.id, vertex_shader_id );
 		if( geometry_shader_id > 0 )
 			glAttachShader( program_id.id, geometry_shader_id );
 		glAttachShader( program_id.id, fragment_shader_id );
 
 		glLinkProgram( program_id.id );
+	}
 
+	bool Shader::LinkProgram_Check() const
+	{
 		i32 success;
 		glGetProgramiv( program_id.id, GL_LINK_STATUS, &success );
 		if( !success )
@@ -997,6 +972,50 @@ namespace Kakadu::RHI
 		}
 	}
 
+	void Shader::QueryProgramData( const std::string& vertex_shader_source, const std::string* geometry_shader_source, const std::string& fragment_shader_source )
+	{
+		QueryVertexAttributes();
+
+		uses_draw_transform_buffer = glGetProgramResourceIndex( program_id.id, GL_SHADER_STORAGE_BLOCK, "_Intrinsic_DrawTransforms" ) != GL_INVALID_INDEX;
+
+		GetUniformBookKeepingInfo();
+		if( uniform_book_keeping_info.count == 0 )
+			return;
+
+		QueryUniformData();
+
+		ParseShaderSource_VertexLayout( vertex_shader_source );
+		ParseShaderSource_UniformAnnotations( vertex_shader_source, ShaderType::Vertex );
+		if( geometry_shader_source )
+			ParseShaderSource_UniformAnnotations( *geometry_shader_source, ShaderType::Geometry );
+		ParseShaderSource_UniformAnnotations( fragment_shader_source, ShaderType::Fragment );
+
+		QueryUniformData_BlockIndexAndOffsetForBufferMembers();
+		QueryUniformBufferData( uniform_buffer_info_map_regular, Uniform::BufferCategory::Regular );
+		QueryUniformBufferData( uniform_buffer_info_map_global, Uniform::BufferCategory::Global );
+		QueryUniformBufferData( uniform_buffer_info_map_intrinsic, Uniform::BufferCategory::Intrinsic );
+	}
+
+	/* Everything here is derived from the uniform & uniform buffer information (including buffer members) alone; No program queries. */
+	void Shader::CompleteUniformBufferData()
+	{
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_regular );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_global );
+		QueryUniformBufferData_Aggregates( uniform_buffer_info_map_intrinsic );
+
+		CalculateTotalUniformSizes();
+		EnumerateUniformBufferCategories();
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_regular )
+			Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_global )
+			Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+
+		for( auto& [ uniform_buffer_name, uniform_buffer_info ] : uniform_buffer_info_map_intrinsic )
+			Uniform::BlockBindingPointManager::RegisterUniformBlock( *this, uniform_buffer_name, uniform_buffer_info );
+	}
+
 	void Shader::QueryVertexAttributes()
 	{
 		i32 active_attribute_count;
@@ -1069,6 +1088,8 @@ namespace Kakadu::RHI
 
 	void Shader::QueryUniformData()
 	{
+		uniform_info_per_handle.clear(); // Will be re-resolved on first use.
+
 		i32 offset = 0;
 		for( auto uniform_index = 0; uniform_index < uniform_book_keeping_info.count; uniform_index++ )
 		{
@@ -1263,7 +1284,7 @@ namespace Kakadu::RHI
 					const i32 element_count = ( j - i - ( done_processing_array_element ? 1 : 0 ) ) / member_count; // -1 because j had been incremented once more before the for loop ended.
 					
 					const auto aggregate_name( uniform_name_without_buffer_name.substr( 0, bracket_pos ) );
-					uniform_buffer_info.members_array_map.emplace( aggregate_name,
+					uniform_buffer_info.members_array_map.emplace( StringID::Intern( aggregate_name ),
 																   Uniform::BufferMemberInformation_Array
 																   { 
 																		.offset        = uniform_info->offset,
@@ -1316,7 +1337,7 @@ namespace Kakadu::RHI
 					}
 
 					const auto aggregate_name( uniform_name_without_buffer_name.substr( 0, dot_pos ) );
-					uniform_buffer_info.members_struct_map.emplace( aggregate_name,
+					uniform_buffer_info.members_struct_map.emplace( StringID::Intern( aggregate_name ),
 																	Uniform::BufferMemberInformation_Struct
 																	{
 																		 .offset      = uniform_info->offset,
@@ -1329,7 +1350,7 @@ namespace Kakadu::RHI
 				}
 				else
 				{
-					uniform_buffer_info.members_single_map.emplace( uniform_name_without_buffer_name, uniform_info );
+					uniform_buffer_info.members_single_map.emplace( StringID::Intern( uniform_name_without_buffer_name ), uniform_info );
 				}
 			}
 		}
@@ -1380,6 +1401,56 @@ namespace Kakadu::RHI
 #endif // _EDITOR
 	}
 
+	/* Keeps the name storage & look-up map together, so that Handles can be registered from anywhere (including static initialization). */
+	struct UniformHandleRegistry
+	{
+		std::vector< std::string > names;
+		std::unordered_map< std::string, u32 > index_map;
+	};
+
+	internal_function UniformHandleRegistry& GetUniformHandleRegistry()
+	{
+		static UniformHandleRegistry registry;
+		return registry;
+	}
+
+	Uniform::Handle Shader::RegisterUniformHandle( const std::string& uniform_name )
+	{
+		auto& registry = GetUniformHandleRegistry();
+
+		if( const auto iterator = registry.index_map.find( uniform_name );
+			iterator != registry.index_map.cend() )
+		{
+			return Uniform::Handle{ .index = iterator->second };
+		}
+
+		const u32 new_index = ( u32 )registry.names.size();
+		registry.names.push_back( uniform_name );
+		registry.index_map.emplace( uniform_name, new_index );
+
+		return Uniform::Handle{ .index = new_index };
+	}
+
+	const std::string& Shader::UniformHandleName( const Uniform::Handle uniform_handle )
+	{
+		return GetUniformHandleRegistry().names[ uniform_handle.index ];
+	}
+
+	void Shader::ResolveUniformHandles()
+	{
+		const auto& names = GetUniformHandleRegistry().names;
+
+		const std::size_t resolved_count = uniform_info_per_handle.size();
+		uniform_info_per_handle.resize( names.size() );
+
+		for( std::size_t index = resolved_count; index < names.size(); index++ )
+		{
+			/* Not using GetUniformInformation( name ) here: It inserts missing uniforms in standalone builds & logs them in Editor builds. */
+			const auto iterator = uniform_info_map.find( names[ index ] );
+			uniform_info_per_handle[ index ] = iterator != uniform_info_map.cend() ? &iterator->second : nullptr;
+		}
+	}
+
 	void Shader::LogErrors( const std::string& error_string ) const
 	{
 		std::cerr << error_string;
@@ -2,6 +2,7 @@
 
 // Engine Includes.
 #include "RHI.h"
+#include "Counters.h"
 #include "ShaderSourcePath.hpp"
 #include "Std140StructTag.h"
 #include "Uniform.h"
@@ -15,6 +16,7 @@
 // std Includes.
 #include <deque>
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -29,10 +31,18 @@ namespace Kakadu
 
 namespace Kakadu::RHI
 {
+	/* Forward Declarations: */
+	class ShaderCompiler;
+	class ShaderPermutationSet;
+	class ShaderProgramCache;
+
 	class Shader
 	{
 		friend class Renderer;
 		friend class BuiltinShaders;
+		friend class ShaderCompiler;
+		friend class ShaderPermutationSet;
+		friend class ShaderProgramCache;
 		friend class std::unordered_map< std::string, Shader >;
 
 		using ReferenceCount = u32;
@@ -107,8 +117,6 @@ namespace Kakadu::RHI
 		const VertexLayout& GetSourceVertexLayout()	const { return vertex_layout_source; }
 		const VertexLayout& GetActiveVertexLayout()	const { return vertex_layout_active; }
 
-		bool SourceFilesAreModified();
-
 #ifdef _EDITOR
 		const char* GetAnnotationFormatString( const u16 annotation_format_string_id );
 #endif // _EDITOR
@@ -137,6 +145,24 @@ namespace Kakadu::RHI
 		bool HasGlobalUniformBlock( const std::string& block_name )		const { return uniform_buffer_info_map_global.contains( block_name ); }
 		bool HasRegularUniformBlock( const std::string& block_name )	const { return uniform_buffer_info_map_regular.contains( block_name ); }
 
+		/* Whether the program reads per-draw world transforms from the _Intrinsic_DrawTransforms storage block (instead of a uniform). */
+		bool UsesDrawTransformBuffer() const { return uses_draw_transform_buffer; }
+
+/* Uniform Handles: */
+
+		/* Returns the existing Handle if the name was registered before. Not meant for the hot path; Register once & keep the Handle around. */
+		static Uniform::Handle RegisterUniformHandle( const std::string& uniform_name );
+		static const std::string& UniformHandleName( const Uniform::Handle uniform_handle );
+
+		/* Returns nullptr if this Shader does not define the uniform (or it was optimized away). */
+		const Uniform::Information* GetUniformInformation( const Uniform::Handle uniform_handle )
+		{
+			if( uniform_handle.index >= uniform_info_per_handle.size() )
+				ResolveUniformHandles();
+
+			return uniform_info_per_handle[ uniform_handle.index ];
+		}
+
 /* Uniform Upload; Non-array types: */
 
 		template< typename UniformType >
@@ -453,6 +479,7 @@ namespace Kakadu::RHI
 				return;
 #endif // _EDITOR
 
+			RunningCounters().uniform_bytes += uniform_info->size;
 			SetUniform( uniform_info->location_or_block_index, value );
 		}
 
@@ -467,9 +494,23 @@ namespace Kakadu::RHI
 				return;
 #endif // _EDITOR
 
+			RunningCounters().uniform_bytes += uniform_info->size * element_count;
 			SetUniformArray( uniform_info->location_or_block_index, value, element_count );
 		}
 
+/* Uniform setters; By handle & value: */
+
+		template< typename UniformType >
+		/* Prohibit Uniform Buffers: */ requires( not std::is_base_of_v< Std140StructTag, UniformType > )
+		void SetUniform( const Uniform::Handle uniform_handle, const UniformType& value )
+		{
+			if( const auto uniform_info = GetUniformInformation( uniform_handle ) )
+			{
+				RunningCounters().uniform_bytes += uniform_info->size;
+				SetUniform( uniform_info->location_or_block_index, value );
+			}
+		}
+
 /* Uniform setters; By info. & pointer: */
 
 		void SetUniform( const Uniform::Information& uniform_info, const void* value_pointer );
@@ -479,16 +520,35 @@ private:
 
 		void Delete();
 
+/* Compilation phases (FromFile() runs them back-to-back, ShaderCompiler overlaps them across Shaders): */
+
+		/* Preprocesses all stages & tries the program binary cache; No compilation is pending afterwards on a cache hit (or on failure, in which case false is returned). */
+		bool Compilation_Prepare( const VertexShaderSourcePath& vertex_shader_source_path,
+								  const GeometryShaderSourcePath& geometry_shader_source_path,
+								  const FragmentShaderSourcePath& fragment_shader_source_path,
+								  const Features& features_to_set );
+		/* Issues the compile & link commands without waiting on them; Can be called on any thread with a context sharing objects with the main one. */
+		void Compilation_Submit();
+		/* Expects KHR/ARB_parallel_shader_compile; Otherwise the query blocks until the link completes. */
+		bool Compilation_IsComplete() const;
+		/* Checks compile & link status, then queries & parses the reflection data. Leaves the Shader without a program on failure. */
+		bool Compilation_Finish();
+
 /* Queries: */
 
 		bool IsValid() const { return ( bool )program_id; }
 
 /* Compilation & Linkage: */
 
-		std::optional< std::string > ParseShaderFromFile( const char* file_path, const ShaderType shader_type );
-		std::vector< std::string > PreprocessShaderStage_GetIncludeFilePaths( std::string shader_source ) const;
+		/* Reads the source & resolves #include directives (both memoized by ShaderIncludePreprocessing), then sets the requested Features; Parsed Features are added to the feature_map. */
+		std::optional< std::string > PreProcessShaderStage( const char* shader_source_path,
+															const ShaderType shader_type,
+															const Features& features_to_set,
+															std::vector< std::string >& include_path_array,
+															std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file );
+		std::vector< std::string > PreprocessShaderStage_GetIncludeFilePaths( const std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file ) const;
 		void PreprocessShaderStage_StripDefinesToBeSet( std::string& shader_source_to_modify, const std::vector< std::string >& features_to_set );
-		std::unordered_map< std::string, Feature > PreProcessShaderStage_ParseFeatures( std::string shader_source );
+		static std::unordered_map< std::string, Feature > PreProcessShaderStage_ParseFeatures( std::string shader_source );
 		void PreProcessShaderStage_SetFeatures( std::string& shader_source_to_modify,
 												std::unordered_map< std::string, Feature >& defined_features,
 												const std::vector< std::string >& features_to_set );
@@ -496,12 +556,13 @@ private:
 													  std::string& shader_source_to_modify,
 													  const ShaderType shader_type,
 													  std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file );
-		bool CompileShader( const char* source,
-							u32& shader_id,
-							const ShaderType shader_type,
-							std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file );
-		bool LinkProgram( const u32 vertex_shader_id, const u32 fragment_shader_id );
-		bool LinkProgram( const u32 vertex_shader_id, const u32 geometry_shader_id, const u32 fragment_shader_id );
+		/* Submission only issues GL commands; Status is queried (& errors are logged) by the _Check() functions. */
+		void CompileShader_Submit( const char* source, u32& shader_id, const ShaderType shader_type );
+		bool CompileShader_Check( const u32 shader_id,
+								  const ShaderType shader_type,
+								  std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file ) const;
+		void LinkProgram_Submit( const u32 vertex_shader_id, const u32 geometry_shader_id, const u32 fragment_shader_id, const bool make_binary_retrievable );
+		bool LinkProgram_Check() const;
 
 		/*std::string ShaderSource_CommentsStripped( const std::string& shader_source );*/
 		void ParseShaderSource_UniformAnnotations( const std::string& shader_source, const ShaderType shader_type );
@@ -509,6 +570,10 @@ private:
 
 /* Shader Introspection: */
 
+		/* Queries the linked program & parses the preprocessed sources for everything apart from the uniform buffer aggregates. */
+		void QueryProgramData( const std::string& vertex_shader_source, const std::string* geometry_shader_source, const std::string& fragment_shader_source );
+		void CompleteUniformBufferData();
+
 		void QueryVertexAttributes();
 
 		void GetUniformBookKeepingInfo();
@@ -526,6 +591,9 @@ private:
 		/* This returns a pointer so Editor vs Standalone builds have a consistent API regarding the return value. */
 		const Uniform::Information* GetUniformInformation( const std::string& uniform_name );
 
+		/* Resolves all Handles registered so far (that are not resolved yet) against the uniform_info_map. */
+		void ResolveUniformHandles();
+
 /* Error Checking/Reporting: */
 
 		void LogErrors( const std::string& error_string ) const;
@@ -546,7 +614,8 @@ private:
 
 	private:
 		RHI::ShaderProgramID program_id;
-		/* 4 bytes of padding. */
+		bool uses_draw_transform_buffer = false;
+		/* 3 bytes of padding. */
 		std::string name;
 
 		std::string vertex_source_path;
@@ -561,13 +630,13 @@ private:
 		std::unordered_map< std::string, Feature > feature_map;
 
 		std::unordered_map< std::string, Uniform::Information > uniform_info_map;
+		/* Indexed by Uniform::Handle::index; nullptr means the uniform does not exist in this Shader. Cleared whenever uniform_info_map is (re)built. */
+		std::vector< const Uniform::Information* > uniform_info_per_handle;
 
 		std::unordered_map< std::string, Uniform::BufferInformation	> uniform_buffer_info_map_regular;
 		std::unordered_map< std::string, Uniform::BufferInformation	> uniform_buffer_info_map_global;
 		std::unordered_map< std::string, Uniform::BufferInformation	> uniform_buffer_info_map_intrinsic;
 
-		std::unordered_map< std::string, std::filesystem::file_time_type > last_write_time_map;
-
 		Uniform::ActiveUniformBookKeepingInformation uniform_book_keeping_info;
 
 		// Expecting format string count to be < 100 so no de-dup map or anything. Keys will be looked-up before insertion.
@@ -575,5 +644,8 @@ private:
 
 		VertexLayout vertex_layout_source;
 		VertexLayout vertex_layout_active;
+
+		struct PendingCompilation;
+		std::unique_ptr< PendingCompilation > pending_compilation;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,278 @@
+// Engine Includes.
+#include "ShaderCompiler.h"
+#include "Core/Assertion.h"
+#include "Core/Platform.h"
+
+// std Includes.
+#include <algorithm>
+#include <utility>
+
+namespace Kakadu::RHI
+{
+	ShaderCompiler::ShaderCompiler()
+		:
+		mode( DetermineMode() ),
+		failed_count( 0 ),
+		stop_requested( false )
+	{
+	}
+
+	ShaderCompiler::~ShaderCompiler()
+	{
+		Finish();
+		StopWorkers();
+	}
+
+	bool ShaderCompiler::Submit( Shader& shader,
+								 const VertexShaderSourcePath& vertex_shader_source_path,
+								 const FragmentShaderSourcePath& fragment_shader_source_path,
+								 const Shader::Features& features_to_set )
+	{
+		using namespace Literals;
+
+		return Submit( shader, vertex_shader_source_path, ""_geom, fragment_shader_source_path, features_to_set );
+	}
+
+	bool ShaderCompiler::Submit( Shader& shader,
+								 const VertexShaderSourcePath& vertex_shader_source_path,
+								 const GeometryShaderSourcePath& geometry_shader_source_path,
+								 const FragmentShaderSourcePath& fragment_shader_source_path,
+								 const Shader::Features& features_to_set )
+	{
+		if( not shader.Compilation_Prepare( vertex_shader_source_path, geometry_shader_source_path, fragment_shader_source_path, features_to_set ) )
+		{
+			failed_count++;
+			return false;
+		}
+
+		/* Served from the program binary cache. */
+		if( not shader.pending_compilation )
+			return true;
+
+		shaders_pending.push_back( &shader );
+
+		switch( mode )
+		{
+			case Mode::WorkerThreads:
+			{
+				/* Creating shared contexts is not free; Not worth it for a single Shader (e.g., a typical hot-reload), which is submitted in Finish() instead. */
+				if( workers.empty() && shaders_pending.size() >= 2 && not StartWorkers() )
+				{
+					/* No shared contexts available; Submit everything queued so far (including this Shader) on this thread from now on. */
+					for( auto shader_queued : shaders_pending )
+						shader_queued->Compilation_Submit();
+
+					submission_queue.clear();
+					break;
+				}
+
+				{
+					std::scoped_lock lock( mutex );
+					submission_queue.push_back( &shader );
+				}
+
+				submission_available.notify_one();
+				break;
+			}
+
+			case Mode::DriverParallel:
+			case Mode::Serial:
+			default:
+				shader.Compilation_Submit();
+				break;
+		}
+
+		return true;
+	}
+
+	u32 ShaderCompiler::Finish()
+	{
+		if( mode == Mode::WorkerThreads )
+		{
+			if( workers.empty() )
+			{
+				/* Workers were never started; Submit on this thread. */
+				submission_queue.clear();
+				for( auto shader : shaders_pending )
+					shader->Compilation_Submit();
+			}
+			else
+			{
+				std::vector< Shader* > shaders_to_finish;
+
+				while( not shaders_pending.empty() )
+				{
+					{
+						std::unique_lock lock( mutex );
+						submission_done.wait( lock, [ & ]() { return not submissions_done.empty(); } );
+
+						shaders_to_finish.swap( submissions_done );
+					}
+
+					for( auto shader : shaders_to_finish )
+					{
+						failed_count += not shader->Compilation_Finish();
+						std::erase( shaders_pending, shader );
+					}
+
+					shaders_to_finish.clear();
+				}
+			}
+		}
+
+		if( mode == Mode::DriverParallel )
+		{
+			/* Reflect each Shader as soon as its link completes, while the driver keeps compiling the rest. */
+			while( not shaders_pending.empty() )
+			{
+				const auto completed_begin = std::stable_partition( shaders_pending.begin(), shaders_pending.end(),
+																	[]( const Shader* shader ) { return not shader->Compilation_IsComplete(); } );
+
+				if( completed_begin == shaders_pending.end() )
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				for( auto iterator = completed_begin; iterator != shaders_pending.end(); iterator++ )
+					failed_count += not ( *iterator )->Compilation_Finish();
+
+				shaders_pending.erase( completed_begin, shaders_pending.end() );
+			}
+		}
+
+		/* Mode::Serial, or Mode::WorkerThreads without workers: */
+		for( auto shader : shaders_pending )
+			failed_count += not shader->Compilation_Finish();
+
+		shaders_pending.clear();
+
+		return std::exchange( failed_count, 0 );
+	}
+
+	std::vector< Shader* > ShaderCompiler::FinishCompleted()
+	{
+		std::vector< Shader* > shaders_finished;
+
+		if( mode == Mode::DriverParallel )
+		{
+			const auto completed_begin = std::stable_partition( shaders_pending.begin(), shaders_pending.end(),
+																[]( const Shader* shader ) { return not shader->Compilation_IsComplete(); } );
+
+			shaders_finished.assign( completed_begin, shaders_pending.end() );
+			shaders_pending.erase( completed_begin, shaders_pending.end() );
+		}
+		else if( mode == Mode::WorkerThreads && not workers.empty() )
+		{
+			{
+				std::scoped_lock lock( mutex );
+				shaders_finished.swap( submissions_done );
+			}
+
+			for( auto shader : shaders_finished )
+				std::erase( shaders_pending, shader );
+		}
+		else
+		{
+			shaders_finished = shaders_pending;
+			Finish();
+			return shaders_finished;
+		}
+
+		for( auto shader : shaders_finished )
+			failed_count += not shader->Compilation_Finish();
+
+		return shaders_finished;
+	}
+
+	ShaderCompiler::Mode ShaderCompiler::DetermineMode()
+	{
+		if( GLAD_GL_KHR_parallel_shader_compile )
+		{
+			glMaxShaderCompilerThreadsKHR( 0xFFFFFFFF ); // Let the driver decide.
+			return Mode::DriverParallel;
+		}
+
+		if( GLAD_GL_ARB_parallel_shader_compile )
+		{
+			glMaxShaderCompilerThreadsARB( 0xFFFFFFFF ); // Let the driver decide.
+			return Mode::DriverParallel;
+		}
+
+		return std::thread::hardware_concurrency() > 1 ? Mode::WorkerThreads : Mode::Serial;
+	}
+
+	bool ShaderCompiler::StartWorkers()
+	{
+		const u32 desired_worker_count = std::clamp( std::thread::hardware_concurrency(), 2u, MAX_WORKER_COUNT + 1 ) - 1;
+		const u32 worker_count         = Platform::CreateSharedContexts( desired_worker_count );
+
+		if( worker_count == 0 )
+		{
+			mode = Mode::Serial;
+			return false;
+		}
+
+		for( u32 context_index = 0; context_index < worker_count; context_index++ )
+			workers.emplace_back( &ShaderCompiler::WorkerLoop, this, context_index );
+
+		return true;
+	}
+
+	void ShaderCompiler::StopWorkers()
+	{
+		if( workers.empty() )
+			return;
+
+		{
+			std::scoped_lock lock( mutex );
+			stop_requested = true;
+		}
+
+		submission_available.notify_all();
+
+		for( auto& worker : workers )
+			worker.join();
+
+		workers.clear();
+
+		Platform::DestroySharedContexts();
+	}
+
+	void ShaderCompiler::WorkerLoop( const u32 context_index )
+	{
+		Platform::MakeSharedContextCurrent( context_index );
+
+		while( true )
+		{
+			Shader* shader = nullptr;
+
+			{
+				std::unique_lock lock( mutex );
+				submission_available.wait( lock, [ & ]() { return stop_requested || not submission_queue.empty(); } );
+
+				if( stop_requested )
+					break;
+
+				shader = submission_queue.front();
+				submission_queue.pop_front();
+			}
+
+			shader->Compilation_Submit();
+
+			/* Wait for the link here rather than on the main thread; glFinish() also makes the results visible to the other contexts. */
+			i32 link_status_dont_care;
+			glGetProgramiv( shader->Id().id, GL_LINK_STATUS, &link_status_dont_care );
+			glFinish();
+
+			{
+				std::scoped_lock lock( mutex );
+				submissions_done.push_back( shader );
+			}
+
+			submission_done.notify_one();
+		}
+
+		Platform::ReleaseCurrentContext();
+	}
+}
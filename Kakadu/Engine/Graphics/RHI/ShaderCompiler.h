@@ -0,0 +1,95 @@
+#pragma once
+
+// Engine Includes.
+#include "Shader.hpp"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Kakadu::RHI
+{
+	/* Compiles many Shaders at once, so that the driver's work for one Shader overlaps with the others' instead of being serialized behind status queries:
+	 *	With KHR/ARB_parallel_shader_compile, every stage & program is submitted right away & the driver compiles them on its own threads; Completion is polled via GL_COMPLETION_STATUS_KHR.
+	 *	Without it, submissions go to a few worker threads, each with its own context sharing objects with the main one.
+	 * Preprocessing, the program binary cache & reflection (uniform/uniform buffer queries & annotation parsing) always run on the calling (main) thread.
+	 * Submitted Shaders must stay alive & must not move until Finish() returns. */
+	class ShaderCompiler
+	{
+	public:
+		enum class Mode : u8
+		{
+			Serial,
+			DriverParallel,
+			WorkerThreads
+		};
+
+	public:
+		ShaderCompiler();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( ShaderCompiler );
+
+		/* Finishes whatever is still pending. */
+		~ShaderCompiler();
+
+	/* Usage: */
+
+		/* Returns false if the sources could not be read/preprocessed; The Shader is left without a program in that case. */
+		bool Submit( Shader& shader,
+					 const VertexShaderSourcePath& vertex_shader_source_path,
+					 const FragmentShaderSourcePath& fragment_shader_source_path,
+					 const Shader::Features& features_to_set = {} );
+		bool Submit( Shader& shader,
+					 const VertexShaderSourcePath& vertex_shader_source_path,
+					 const GeometryShaderSourcePath& geometry_shader_source_path,
+					 const FragmentShaderSourcePath& fragment_shader_source_path,
+					 const Shader::Features& features_to_set = {} );
+
+		/* Blocks until every submitted Shader is compiled, linked & reflected; Shaders are completed in the order their links finish.
+		 * Shaders that failed are left without a program (see Shader::Compilation_Finish()). Returns the number of Shaders that failed. */
+		u32 Finish();
+
+		/* Does not block (unless there is no driver/worker parallelism, in which case everything is finished right away):
+		 * Finishes the Shaders whose compilation & link already completed & returns them. Check Shader::IsValid() for failures. */
+		std::vector< Shader* > FinishCompleted();
+
+	/* Queries: */
+
+		Mode GetMode() const { return mode; }
+		bool HasPending() const { return not shaders_pending.empty(); }
+
+	private:
+		static Mode DetermineMode();
+
+		/* Falls back to Mode::Serial & returns false if no shared contexts could be created. */
+		bool StartWorkers();
+		void StopWorkers();
+		void WorkerLoop( const u32 context_index );
+
+	private:
+		static constexpr u32 MAX_WORKER_COUNT = 4;
+
+		Mode mode;
+		/* 3 bytes of padding. */
+		u32 failed_count;
+
+		std::vector< Shader* > shaders_pending; // Submitted (or queued for submission), not finished yet.
+
+		/* Mode::WorkerThreads only: */
+
+		std::mutex mutex;
+		std::condition_variable submission_available;
+		std::condition_variable submission_done;
+		std::deque< Shader* > submission_queue;		// Waiting for a worker.
+		std::vector< Shader* > submissions_done;	// Compiled & linked on a worker, waiting for Finish().
+		bool stop_requested;
+		/* 7 bytes of padding. */
+
+		std::vector< std::thread > workers;
+	};
+}
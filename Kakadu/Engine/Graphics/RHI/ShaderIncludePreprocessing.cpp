@@ -1,10 +1,81 @@
 // Engine Includes.
 #include "ShaderIncludePreprocessing.h"
+#include "Core/Macros.h"
 #include "Core/Types.h"
 #include "Core/Utility.hpp"
 
+// std Includes.
+#include <mutex>
+
 namespace Kakadu::RHI::ShaderIncludePreprocessing
 {
+	/* Process-wide memoization:
+	 * Every stage of every shader (& of every permutation) includes the same few files (_Global.glsl, _Intrinsic_Lighting.glsl etc.),
+	 * so files are read once & kept along with their last write time, which is re-validated on every use.
+	 * Fully resolved sources are kept too, along with the include graph they were resolved from (i.e., the files & their IDs), so that resolving the same
+	 * source again (e.g., for another permutation) only costs a last write time query per file in its graph. */
+
+	struct CachedFile
+	{
+		std::filesystem::file_time_type last_write_time;
+		std::string contents;
+	};
+
+	struct CachedResolution
+	{
+		std::string resolved_source;
+		std::unordered_map< std::filesystem::path, i16 > map_of_source_file_per_ID;
+		std::vector< std::pair< std::filesystem::path, std::filesystem::file_time_type > > canonical_file_paths_and_last_write_times;
+	};
+
+	internal_variable std::mutex CACHE_MUTEX;
+	internal_variable std::unordered_map< std::filesystem::path, CachedFile > FILE_CACHE;				// Keyed by canonical path.
+	internal_variable std::unordered_map< std::string, CachedResolution > RESOLUTION_CACHE;			// Keyed by canonical path + include directories.
+
+	internal_function std::filesystem::path CanonicalPath( const std::filesystem::path& path )
+	{
+		std::error_code error_code;
+		auto canonical_path = std::filesystem::weakly_canonical( path, error_code );
+		return error_code ? path : canonical_path;
+	}
+
+	/* Returns nullptr if the file could not be read. */
+	internal_function const std::string* ReadFileCached( const std::filesystem::path& file_path )
+	{
+		const auto canonical_path = CanonicalPath( file_path );
+
+		std::error_code error_code;
+		const auto last_write_time = std::filesystem::last_write_time( canonical_path, error_code );
+		if( error_code )
+			return nullptr;
+
+		if( auto iterator = FILE_CACHE.find( canonical_path );
+			iterator != FILE_CACHE.end() && iterator->second.last_write_time == last_write_time )
+			return &iterator->second.contents;
+
+		auto maybe_file = Utility::ReadFileIntoString( file_path.string().c_str() );
+		if( not maybe_file )
+			return nullptr;
+
+		auto& cached_file = FILE_CACHE[ canonical_path ];
+		cached_file.last_write_time = last_write_time;
+		cached_file.contents        = std::move( *maybe_file );
+
+		return &cached_file.contents;
+	}
+
+	internal_function bool ResolutionIsUpToDate( const CachedResolution& resolution )
+	{
+		for( const auto& [ canonical_file_path, last_write_time ] : resolution.canonical_file_paths_and_last_write_times )
+		{
+			std::error_code error_code;
+			if( std::filesystem::last_write_time( canonical_file_path, error_code ) != last_write_time || error_code )
+				return false;
+		}
+
+		return true;
+	}
+
 	/* Implementation Function prototype: */
 	std::string Resolve( const std::filesystem::path& source_path,
 						 std::initializer_list< std::string > include_directories_with_trailing_slashes,
@@ -17,18 +88,56 @@ namespace Kakadu::RHI::ShaderIncludePreprocessing
 						 std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file,
 						 std::span< char > error_log )
 	{
-		/* Map provided by the caller is for caller's use (i.e., they need to refer to the source file corresponding to the key in shader compilation error logs.). 
-		 * The implementation on the other hand needs the inverse map: To assign and look-up indices based on shader source file path. */
-		std::unordered_map< std::filesystem::path, i16 > map_of_source_file_per_ID;
-		map_of_source_file_per_ID[ source_path ] = 0; // The main source file is always the ID 0.
+		std::scoped_lock lock( CACHE_MUTEX );
+
+		std::string resolution_key( CanonicalPath( source_path ).string() );
+		for( const auto& include_directory : include_directories_with_trailing_slashes )
+		{
+			resolution_key += '\n';
+			resolution_key += include_directory;
+		}
 
-		const std::string resolved_source( Resolve( source_path, include_directories_with_trailing_slashes, map_of_source_file_per_ID, error_log ) );
+		auto& resolution = RESOLUTION_CACHE[ resolution_key ];
+
+		if( resolution.resolved_source.empty() || not ResolutionIsUpToDate( resolution ) )
+		{
+			/* Map provided by the caller is for caller's use (i.e., they need to refer to the source file corresponding to the key in shader compilation error logs.). 
+			 * The implementation on the other hand needs the inverse map: To assign and look-up indices based on shader source file path. */
+			std::unordered_map< std::filesystem::path, i16 > map_of_source_file_per_ID;
+			map_of_source_file_per_ID[ source_path ] = 0; // The main source file is always the ID 0.
+
+			std::string resolved_source( Resolve( source_path, include_directories_with_trailing_slashes, map_of_source_file_per_ID, error_log ) );
+
+			if( resolved_source.empty() )
+			{
+				RESOLUTION_CACHE.erase( resolution_key );
+				return "";
+			}
+
+			resolution.resolved_source           = std::move( resolved_source );
+			resolution.map_of_source_file_per_ID = std::move( map_of_source_file_per_ID );
+
+			resolution.canonical_file_paths_and_last_write_times.clear();
+			for( const auto& [ source_file_path, file_ID ] : resolution.map_of_source_file_per_ID )
+			{
+				const auto canonical_path = CanonicalPath( source_file_path );
+				resolution.canonical_file_paths_and_last_write_times.emplace_back( canonical_path, FILE_CACHE[ canonical_path ].last_write_time );
+			}
+		}
 
 		/* Remap: */
-		for( auto& [ source_file_path, file_ID ] : map_of_source_file_per_ID )
+		for( auto& [ source_file_path, file_ID ] : resolution.map_of_source_file_per_ID )
 			map_of_IDs_per_source_file[ file_ID ] = source_file_path;
 
-		return resolved_source;
+		return resolution.resolved_source;
+	}
+
+	void InvalidateCache()
+	{
+		std::scoped_lock lock( CACHE_MUTEX );
+
+		FILE_CACHE.clear();
+		RESOLUTION_CACHE.clear();
 	}
 
 	/* Implementation Function definition: */
@@ -37,16 +146,14 @@ namespace Kakadu::RHI::ShaderIncludePreprocessing
 						 std::unordered_map< std::filesystem::path, i16 >& map_of_source_file_per_ID,
 						 std::span< char > error_log )
 	{
-		std::string source;
-
-		if( auto maybe_file = Utility::ReadFileIntoString( source_path.string().c_str() );
-			not maybe_file )
+		const std::string* maybe_source = ReadFileCached( source_path );
+		if( not maybe_source )
 		{
 			std::snprintf( error_log.data(), error_log.size(), "File could not be opened." );
 			return ""; // File could not be opened.
 		}
-		else
-			source = std::move( *maybe_file );
+
+		const std::string& source = *maybe_source;
 
 		std::string processed;
 
@@ -6,12 +6,17 @@
 // std Includes.
 #include <filesystem>
 #include <span>
+#include <string>
 #include <unordered_map>
 
 namespace Kakadu::RHI::ShaderIncludePreprocessing
 {
+	/* Results are memoized process-wide & re-validated against the last write times of every file involved; See the .cpp for details. */
 	std::string Resolve( const std::filesystem::path& source_path, 
 						 std::initializer_list< std::string > include_directories_with_trailing_slashes,
 						 std::unordered_map< i16, std::filesystem::path >& map_of_IDs_per_source_file,
 						 std::span< char > error_log );
+
+	/* Drops all memoized files & resolved sources; Called by the shader hot-reload path. */
+	void InvalidateCache();
 }
@@ -0,0 +1,186 @@
+// Engine Includes.
+#include "ShaderPermutationSet.h"
+#include "ShaderCompiler.h"
+#include "ShaderIncludePreprocessing.h"
+#include "Asset/Paths.h"
+#include "Core/Log.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Kakadu::RHI
+{
+	ShaderPermutationSet::ShaderPermutationSet( const char* name,
+												const VertexShaderSourcePath& vertex_shader_source_path,
+												const FragmentShaderSourcePath& fragment_shader_source_path )
+		:
+		ShaderPermutationSet( name, vertex_shader_source_path, GeometryShaderSourcePath( std::string_view( "" ) ), fragment_shader_source_path )
+	{
+	}
+
+	ShaderPermutationSet::ShaderPermutationSet( const char* name,
+												const VertexShaderSourcePath& vertex_shader_source_path,
+												const GeometryShaderSourcePath& geometry_shader_source_path,
+												const FragmentShaderSourcePath& fragment_shader_source_path )
+		:
+		name( name ),
+		vertex_source_path( vertex_shader_source_path ),
+		geometry_source_path( geometry_shader_source_path ),
+		fragment_source_path( fragment_shader_source_path )
+	{
+		ParseFeatureDeclarations();
+	}
+
+	std::pair< Shader*, bool > ShaderPermutationSet::GetOrCompile( const Shader::Features& features )
+	{
+		const auto feature_mask = MaskOf( features );
+
+		if( auto shader = Find( feature_mask ) )
+			return { shader, false };
+
+		auto& shader = CreateVariant( feature_mask );
+
+		shader.FromFile( VertexShaderSourcePath( vertex_source_path ),
+						 GeometryShaderSourcePath( geometry_source_path ),
+						 FragmentShaderSourcePath( fragment_source_path ),
+						 FeaturesOf( feature_mask ) );
+
+		return { &shader, true };
+	}
+
+	Shader* ShaderPermutationSet::Submit( ShaderCompiler& compiler, const Shader::Features& features )
+	{
+		const auto feature_mask = MaskOf( features );
+
+		if( Find( feature_mask ) )
+			return nullptr;
+
+		auto& shader = CreateVariant( feature_mask );
+
+		compiler.Submit( shader,
+						 VertexShaderSourcePath( vertex_source_path ),
+						 GeometryShaderSourcePath( geometry_source_path ),
+						 FragmentShaderSourcePath( fragment_source_path ),
+						 FeaturesOf( feature_mask ) );
+
+		return &shader;
+	}
+
+	ShaderPermutationSet::FeatureMask ShaderPermutationSet::MaskOf( const Shader::Features& features )
+	{
+		FeatureMask feature_mask = 0;
+
+		for( const auto& feature_definition : features )
+		{
+			auto bit_iterator = std::find( feature_definition_per_bit.begin(), feature_definition_per_bit.end(), feature_definition );
+
+			if( bit_iterator == feature_definition_per_bit.end() )
+			{
+				const std::string feature_name( feature_definition.substr( 0, feature_definition.find( ' ' ) ) );
+
+				const bool is_declared = std::find( feature_definition_per_bit.begin(), feature_definition_per_bit.end(), feature_name ) != feature_definition_per_bit.end();
+				const bool is_defined  = std::find( defined_feature_names.begin(), defined_feature_names.end(), feature_name ) != defined_feature_names.end();
+
+				if( not is_declared && not is_defined )
+				{
+					Log::Warning( "Shader permutation set \"" + name + "\" does not declare Feature \"" + feature_name + "\"; It is ignored." );
+					continue;
+				}
+
+				if( feature_definition_per_bit.size() == MAX_FEATURE_BIT_COUNT )
+				{
+					Log::Error( "Shader permutation set \"" + name + "\" ran out of Feature bits; \"" + feature_definition + "\" is ignored." );
+					continue;
+				}
+
+				feature_definition_per_bit.push_back( feature_definition );
+				bit_iterator = feature_definition_per_bit.end() - 1;
+			}
+
+			feature_mask |= FeatureMask( 1 ) << ( bit_iterator - feature_definition_per_bit.begin() );
+		}
+
+		return feature_mask;
+	}
+
+	Shader::Features ShaderPermutationSet::FeaturesOf( const FeatureMask feature_mask ) const
+	{
+		Shader::Features features;
+
+		for( u32 bit_index = 0; bit_index < feature_definition_per_bit.size(); bit_index++ )
+			if( feature_mask & ( FeatureMask( 1 ) << bit_index ) )
+				features.push_back( feature_definition_per_bit[ bit_index ] );
+
+		return features;
+	}
+
+	std::string ShaderPermutationSet::VariantName( const FeatureMask feature_mask ) const
+	{
+		if( feature_mask == 0 )
+			return name;
+
+		std::string variant_name( name + " (" );
+
+		for( const auto& feature_definition : FeaturesOf( feature_mask ) )
+			variant_name += feature_definition + " | ";
+
+		variant_name.resize( variant_name.size() - 3 ); // Remove the last " | ".
+		return variant_name + ")";
+	}
+
+	Shader* ShaderPermutationSet::Find( const FeatureMask feature_mask )
+	{
+		if( auto iterator = variant_map.find( feature_mask );
+			iterator != variant_map.end() )
+			return &iterator->second;
+
+		return nullptr;
+	}
+
+	void ShaderPermutationSet::ParseFeatureDeclarations()
+	{
+		std::unordered_map< std::string, Shader::Feature > feature_map;
+
+		for( const auto source_path : { &vertex_source_path, &geometry_source_path, &fragment_source_path } )
+		{
+			if( source_path->empty() )
+				continue;
+
+			std::unordered_map< i16, std::filesystem::path > map_of_IDs_per_source_file_dont_care;
+			char error_string[ 256 ] = { 0 };
+
+			const auto source( ShaderIncludePreprocessing::Resolve( *source_path, { ENGINE_SHADER_ROOT_ABSOLUTE "/" }, map_of_IDs_per_source_file_dont_care, error_string ) );
+
+			/* The actual error is reported when a variant is compiled. */
+			if( source.empty() )
+			{
+				Log::Warning( "Shader permutation set \"" + name + "\" could not parse Feature declarations of \"" + *source_path + "\"." );
+				continue;
+			}
+
+			feature_map.merge( Shader::PreProcessShaderStage_ParseFeatures( source ) );
+		}
+
+		for( auto& [ feature_name, feature ] : feature_map )
+		{
+			if( feature.is_set )
+				defined_feature_names.push_back( feature_name );
+			else
+				feature_definition_per_bit.push_back( feature_name );
+		}
+
+		/* Alphabetical order makes the bits (& variant names) independent of declaration order. */
+		std::sort( feature_definition_per_bit.begin(), feature_definition_per_bit.end() );
+
+		if( feature_definition_per_bit.size() > MAX_FEATURE_BIT_COUNT )
+		{
+			Log::Error( "Shader permutation set \"" + name + "\" declares more than " + std::to_string( MAX_FEATURE_BIT_COUNT ) + " Features; The rest are ignored." );
+			feature_definition_per_bit.resize( MAX_FEATURE_BIT_COUNT );
+		}
+	}
+
+	Shader& ShaderPermutationSet::CreateVariant( const FeatureMask feature_mask )
+	{
+		return variant_map.try_emplace( feature_mask, VariantName( feature_mask ).c_str() ).first->second;
+	}
+}
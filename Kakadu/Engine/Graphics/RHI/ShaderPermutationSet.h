@@ -0,0 +1,80 @@
+#pragma once
+
+// Engine Includes.
+#include "Shader.hpp"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Kakadu::RHI
+{
+	/* Forward Declarations: */
+	class ShaderCompiler;
+
+	/* All variants (permutations) of one set of shader sources, keyed by a bitmask of the Features they are compiled with.
+	 * Bits are assigned up front to the Features declared via "#pragma feature <feature_name>" in any stage (including #included files), in alphabetical order.
+	 * Definitions that carry a value (e.g., "SAMPLE_COUNT 2") or override a "#define"d Feature get their own bit the first time they are requested.
+	 * Variants are only compiled when first requested & are shared by everyone requesting the same Features, regardless of the order they are listed in. */
+	class ShaderPermutationSet
+	{
+	public:
+		using FeatureMask = u64;
+
+		static constexpr u32 MAX_FEATURE_BIT_COUNT = sizeof( FeatureMask ) * 8;
+
+	public:
+		ShaderPermutationSet( const char* name,
+							  const VertexShaderSourcePath& vertex_shader_source_path,
+							  const FragmentShaderSourcePath& fragment_shader_source_path );
+		ShaderPermutationSet( const char* name,
+							  const VertexShaderSourcePath& vertex_shader_source_path,
+							  const GeometryShaderSourcePath& geometry_shader_source_path,
+							  const FragmentShaderSourcePath& fragment_shader_source_path );
+
+		/* Variants are referenced by address (by Materials, the Renderer etc.). */
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( ShaderPermutationSet );
+
+	/* Usage: */
+
+		/* Returns the variant compiled with the given Features & whether it was compiled by this call.
+		 * Failed compilations also produce a (program-less) variant, so that they are not retried on every request; Hot-reload recompiles them like any other Shader. */
+		std::pair< Shader*, bool > GetOrCompile( const Shader::Features& features );
+		/* Same as above, except that the compilation is only submitted & completes with the given compiler's Finish(). Returns nullptr if the variant already exists. */
+		Shader* Submit( ShaderCompiler& compiler, const Shader::Features& features );
+
+	/* Queries: */
+
+		const std::string& Name() const { return name; }
+
+		/* Assigns bits to not-yet-seen definitions with values, hence not const. Features that are not declared in the sources are ignored (as they are when compiling). */
+		FeatureMask MaskOf( const Shader::Features& features );
+		/* In bit order, which is also the order they are set in the compiled sources. */
+		Shader::Features FeaturesOf( const FeatureMask feature_mask ) const;
+		/* E.g., "Blinn-Phong (INSTANCING_ENABLED | SHADOWS_ENABLED)". */
+		std::string VariantName( const FeatureMask feature_mask ) const;
+
+		Shader* Find( const FeatureMask feature_mask );
+		const std::unordered_map< FeatureMask, Shader >& Variants() const { return variant_map; }
+
+	private:
+		void ParseFeatureDeclarations();
+		Shader& CreateVariant( const FeatureMask feature_mask );
+
+	private:
+		std::string name;
+		std::string vertex_source_path;
+		std::string geometry_source_path;
+		std::string fragment_source_path;
+
+		std::vector< std::string > feature_definition_per_bit;
+		/* Features that are #define'd in the sources; Overriding them requires a dedicated bit per definition. */
+		std::vector< std::string > defined_feature_names;
+
+		std::unordered_map< FeatureMask, Shader > variant_map;
+	};
+}
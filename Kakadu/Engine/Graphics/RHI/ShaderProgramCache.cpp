@@ -0,0 +1,308 @@
+// Engine Includes.
+#include "ShaderProgramCache.h"
+#include "DeviceInfo.h"
+#include "Shader.hpp"
+#include "Asset/Paths.h"
+#include "Core/CookedFile.hpp"
+#include "Core/Log.h"
+#include "Core/MemoryMappedFile.h"
+#include "Core/ServiceLocator.hpp"
+
+// std Includes.
+#include <array>
+#include <format>
+#include <string_view>
+#include <vector>
+
+namespace Kakadu::RHI
+{
+	constexpr u32 PROGRAM_CACHE_MAGIC          = 'K' | ( 'K' << 8 ) | ( 'P' << 16 ) | ( 'B' << 24 );
+	/* Bump whenever the layout below or the reflection data kept by Shader changes. */
+	constexpr u32 PROGRAM_CACHE_FORMAT_VERSION = 1;
+
+	/*
+	 * Cache file layout (native endianness, arrays are aligned to their element type):
+	 *
+	 * Header:			magic, version, content key.
+	 * Program:			binary format, binary.
+	 * Vertex layouts:	uses draw transform buffer, source attributes, active attributes.
+	 * Uniforms:		active uniform count, max. name length, annotation format strings, uniform infos (name & Uniform::Information).
+	 * Buffers:			regular, global & intrinsic buffer infos (name, size, offset, member names).
+	 */
+
+	internal_function u64 HashString( const std::string_view string, const u64 hash )
+	{
+		/* Hashing the length first keeps consecutive strings from aliasing (e.g., "ab" + "c" vs. "a" + "bc"). */
+		const u64 length = string.size();
+		return HashBytes( std::as_bytes( std::span( string ) ), HashBytes( std::as_bytes( std::span( &length, 1 ) ), hash ) );
+	}
+
+	bool ShaderProgramCache::IsSupported()
+	{
+		local_persist const bool is_supported = []()
+		{
+			i32 binary_format_count = 0;
+			glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &binary_format_count );
+			return binary_format_count > 0;
+		}();
+
+		return is_supported;
+	}
+
+	u64 ShaderProgramCache::ContentKey( const Shader& shader,
+										const std::string& vertex_source, const std::string& geometry_source, const std::string& fragment_source )
+	{
+		const auto& device_info = ServiceLocator< DeviceInfo >::Get();
+
+		u64 hash = HASH_BYTES_INITIAL_VALUE;
+
+		hash = HashString( vertex_source,	hash );
+		hash = HashString( geometry_source,	hash );
+		hash = HashString( fragment_source,	hash );
+
+		for( const auto& feature : shader.features_requested )
+			hash = HashString( feature, hash );
+
+		hash = HashString( device_info.vendor_name,		hash );
+		hash = HashString( device_info.device_name,		hash );
+		hash = HashString( device_info.driver_version,	hash );
+
+		return hash;
+	}
+
+	bool ShaderProgramCache::Load( Shader& shader, const u64 content_key )
+	{
+		const auto cache_file_path = CacheFilePath( shader );
+
+		const MemoryMappedFile cache_file( cache_file_path );
+		if( not cache_file.IsValid() )
+			return false;
+
+		CookedFileReader reader( cache_file.Bytes() );
+
+		if( reader.Read< u32 >() != PROGRAM_CACHE_MAGIC ||
+			reader.Read< u32 >() != PROGRAM_CACHE_FORMAT_VERSION ||
+			reader.Read< u64 >() != content_key )
+			return false;
+
+		const auto binary_format = reader.Read< u32 >();
+		const auto binary        = reader.ReadArray< std::byte >();
+
+		const bool uses_draw_transform_buffer = reader.Read< u8 >() != 0;
+		const auto vertex_attributes_source   = reader.ReadArray< VertexAttribute >();
+		const auto vertex_attributes_active   = reader.ReadArray< VertexAttribute >();
+
+		const i32 uniform_count           = reader.Read< i32 >();
+		const i32 uniform_name_max_length = reader.Read< i32 >();
+
+		std::deque< std::string > annotation_format_string_table;
+		for( u32 format_string_count = reader.Read< u32 >(); format_string_count > 0 && not reader.Failed(); format_string_count-- )
+			annotation_format_string_table.emplace_back( reader.ReadString() );
+
+		std::unordered_map< std::string, Uniform::Information > uniform_info_map;
+		for( u32 uniform_info_count = reader.Read< u32 >(); uniform_info_count > 0 && not reader.Failed(); uniform_info_count-- )
+		{
+			const std::string uniform_name( reader.ReadString() );
+
+			Uniform::Information uniform_info;
+			uniform_info.location_or_block_index     = reader.Read< i32 >();
+			uniform_info.size                        = reader.Read< i32 >();
+			uniform_info.offset                      = reader.Read< i32 >();
+			uniform_info.count_array                 = reader.Read< i32 >();
+			uniform_info.type                        = reader.Read< DataType >();
+			uniform_info.is_buffer_member            = reader.Read< u8 >() != 0;
+			uniform_info.annotation_type             = reader.Read< UniformAnnotation::Type >();
+			uniform_info.annotation_format_string_id = reader.Read< u16 >();
+			uniform_info.annotation_meta_data        = reader.Read< decltype( uniform_info.annotation_meta_data ) >();
+			uniform_info.editor_name                 = reader.ReadString();
+
+			uniform_info_map.emplace( uniform_name, std::move( uniform_info ) );
+		}
+
+		/* Buffer members refer to uniform infos by pointer; Resolved after the uniform info map is moved into its final place. */
+		struct BufferEntry
+		{
+			std::string_view name;
+			i32 size;
+			i32 offset;
+			std::vector< std::string_view > member_names;
+		};
+
+		std::array< std::vector< BufferEntry >, 3 > buffer_entries_per_category;
+		for( auto& buffer_entries : buffer_entries_per_category )
+		{
+			for( u32 buffer_count = reader.Read< u32 >(); buffer_count > 0 && not reader.Failed(); buffer_count-- )
+			{
+				auto& buffer_entry = buffer_entries.emplace_back( BufferEntry{ .name = reader.ReadString(), .size = reader.Read< i32 >(), .offset = reader.Read< i32 >() } );
+
+				for( u32 member_count = reader.Read< u32 >(); member_count > 0 && not reader.Failed(); member_count-- )
+					buffer_entry.member_names.push_back( reader.ReadString() );
+			}
+		}
+
+		if( reader.Failed() || binary.empty() )
+			return false;
+
+		for( const auto& buffer_entries : buffer_entries_per_category )
+			for( const auto& buffer_entry : buffer_entries )
+				for( const auto& member_name : buffer_entry.member_names )
+					if( not uniform_info_map.contains( std::string( member_name ) ) )
+						return false;
+
+		/* Everything is parsed & valid; Now hand the binary over to the driver, which may still reject it (e.g., after a driver update keeping the same version string). */
+
+		const u32 program_id = glCreateProgram();
+		glProgramBinary( program_id, ( GLenum )binary_format, binary.data(), ( GLsizei )binary.size() );
+
+		i32 success = false;
+		glGetProgramiv( program_id, GL_LINK_STATUS, &success );
+		if( not success )
+		{
+			glDeleteProgram( program_id );
+
+			/* The stale file is overwritten once the Shader is compiled from source & stored again. */
+			Log::Info( R"(Shader ")" + shader.name + R"(": Cached program binary was rejected by the driver; Compiling from source.)" );
+
+			return false;
+		}
+
+		shader.program_id.id               = program_id;
+		shader.uses_draw_transform_buffer  = uses_draw_transform_buffer;
+		shader.vertex_layout_active        = VertexLayout( vertex_attributes_active );
+		if( not vertex_attributes_source.empty() )
+			shader.vertex_layout_source = VertexLayout( vertex_attributes_source );
+
+		shader.uniform_book_keeping_info.count           = uniform_count;
+		shader.uniform_book_keeping_info.name_max_length = uniform_name_max_length;
+		shader.uniform_book_keeping_info.name_holder     = std::string( uniform_name_max_length, '?' );
+
+		shader.uniform_annotation_format_string_table = std::move( annotation_format_string_table );
+		shader.uniform_info_map                       = std::move( uniform_info_map );
+		shader.uniform_info_per_handle.clear(); // Will be re-resolved on first use.
+
+		const std::array< std::pair< std::unordered_map< std::string, Uniform::BufferInformation >*, Uniform::BufferCategory >, 3 > buffer_info_maps
+		{ {
+			{ &shader.uniform_buffer_info_map_regular,		Uniform::BufferCategory::Regular	},
+			{ &shader.uniform_buffer_info_map_global,		Uniform::BufferCategory::Global		},
+			{ &shader.uniform_buffer_info_map_intrinsic,	Uniform::BufferCategory::Intrinsic	}
+		} };
+
+		for( auto index = 0; index < buffer_info_maps.size(); index++ )
+		{
+			auto& [ buffer_info_map, category ] = buffer_info_maps[ index ];
+
+			for( const auto& buffer_entry : buffer_entries_per_category[ index ] )
+			{
+				auto& uniform_buffer_information = ( *buffer_info_map )[ std::string( buffer_entry.name ) ] =
+				{
+					.binding_point = -1, // This will be filled later via BufferManager::ConnectBufferToBlock().
+					.size          = buffer_entry.size,
+					.offset        = buffer_entry.offset,
+					.category      = category
+				};
+
+				for( const auto& member_name : buffer_entry.member_names )
+				{
+					const std::string member_name_string( member_name );
+					uniform_buffer_information.members_map.emplace( member_name_string, &shader.uniform_info_map.find( member_name_string )->second );
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool ShaderProgramCache::Store( const Shader& shader, const u64 content_key )
+	{
+		i32 binary_length = 0;
+		glGetProgramiv( shader.program_id.id, GL_PROGRAM_BINARY_LENGTH, &binary_length );
+		if( binary_length <= 0 )
+			return false;
+
+		std::vector< std::byte > binary( binary_length );
+		GLenum binary_format = 0;
+		GLsizei written_length = 0;
+		glGetProgramBinary( shader.program_id.id, binary_length, &written_length, &binary_format, binary.data() );
+		if( written_length <= 0 )
+			return false;
+
+		CookedFileWriter writer;
+
+		writer.Write( PROGRAM_CACHE_MAGIC );
+		writer.Write( PROGRAM_CACHE_FORMAT_VERSION );
+		writer.Write( content_key );
+
+		writer.Write( ( u32 )binary_format );
+		writer.WriteArray( std::span< const std::byte >( binary.data(), written_length ) );
+
+		writer.Write( ( u8 )shader.uses_draw_transform_buffer );
+		writer.WriteArray( shader.vertex_layout_source.Attributes() );
+		writer.WriteArray( shader.vertex_layout_active.Attributes() );
+
+		writer.Write( shader.uniform_book_keeping_info.count );
+		writer.Write( shader.uniform_book_keeping_info.name_max_length );
+
+		writer.Write( ( u32 )shader.uniform_annotation_format_string_table.size() );
+		for( const auto& format_string : shader.uniform_annotation_format_string_table )
+			writer.WriteString( format_string );
+
+		writer.Write( ( u32 )shader.uniform_info_map.size() );
+		for( const auto& [ uniform_name, uniform_info ] : shader.uniform_info_map )
+		{
+			writer.WriteString( uniform_name );
+			writer.Write( uniform_info.location_or_block_index );
+			writer.Write( uniform_info.size );
+			writer.Write( uniform_info.offset );
+			writer.Write( uniform_info.count_array );
+			writer.Write( uniform_info.type );
+			writer.Write( ( u8 )uniform_info.is_buffer_member );
+			writer.Write( uniform_info.annotation_type );
+			writer.Write( uniform_info.annotation_format_string_id );
+			writer.Write( uniform_info.annotation_meta_data );
+			writer.WriteString( uniform_info.editor_name );
+		}
+
+		for( const auto* buffer_info_map : { &shader.uniform_buffer_info_map_regular, &shader.uniform_buffer_info_map_global, &shader.uniform_buffer_info_map_intrinsic } )
+		{
+			writer.Write( ( u32 )buffer_info_map->size() );
+			for( const auto& [ uniform_buffer_name, uniform_buffer_info ] : *buffer_info_map )
+			{
+				writer.WriteString( uniform_buffer_name );
+				writer.Write( uniform_buffer_info.size );
+				writer.Write( uniform_buffer_info.offset );
+
+				writer.Write( ( u32 )uniform_buffer_info.members_map.size() );
+				for( const auto& [ member_name, member_info ] : uniform_buffer_info.members_map )
+					writer.WriteString( member_name );
+			}
+		}
+
+		const auto cache_file_path = CacheFilePath( shader );
+
+		std::error_code error_code;
+		std::filesystem::create_directories( cache_file_path.parent_path(), error_code );
+
+		if( not writer.SaveToFile( cache_file_path ) )
+		{
+			Log::Warning( R"(Shader ")" + shader.name + R"(": Program binary could not be written to ")" + cache_file_path.string() + R"(".)" );
+			return false;
+		}
+
+		return true;
+	}
+
+	std::filesystem::path ShaderProgramCache::CacheFilePath( const Shader& shader )
+	{
+		u64 identity_hash = HASH_BYTES_INITIAL_VALUE;
+
+		identity_hash = HashString( shader.name,					identity_hash );
+		identity_hash = HashString( shader.vertex_source_path,		identity_hash );
+		identity_hash = HashString( shader.geometry_source_path,	identity_hash );
+		identity_hash = HashString( shader.fragment_source_path,	identity_hash );
+
+		for( const auto& feature : shader.features_requested )
+			identity_hash = HashString( feature, identity_hash );
+
+		return std::filesystem::path( ENGINE_SHADER_CACHE_ROOT_ABSOLUTE ) / std::format( "{:016x}.program", identity_hash );
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Engine Includes.
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace Kakadu::RHI
+{
+	/* Forward Declarations: */
+	class Shader;
+
+	/* On-disk cache of linked programs (via glGetProgramBinary()/glProgramBinary()), together with the reflection data Shader would otherwise query & parse after linking.
+	 * One file per Shader identity (name, stage paths & requested Features), so a recompiled Shader overwrites its previous entry instead of piling up stale ones.
+	 * The file also stores a content key (fully preprocessed stage sources, requested Features & the driver's vendor/renderer/version strings); A mismatch means a cache miss.
+	 * Binaries rejected by the driver (e.g., after a driver update that kept the version string) are deleted & the Shader is compiled from source as usual. */
+	class ShaderProgramCache
+	{
+	public:
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( ShaderProgramCache );
+
+		/* False if the driver does not support any program binary formats. */
+		static bool IsSupported();
+
+		/* Stage sources are expected to be fully preprocessed (includes resolved & Features set); Pass an empty geometry source if the Shader has no geometry stage. */
+		static u64 ContentKey( const Shader& shader,
+							   const std::string& vertex_source, const std::string& geometry_source, const std::string& fragment_source );
+
+		/* Creates the program of the given Shader from the cached binary & restores its reflection data.
+		 * Returns false on a miss or if the driver rejects the binary; The Shader is left without a program in that case. */
+		static bool Load( Shader& shader, const u64 content_key );
+		/* Expects the program of the Shader to be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set & its reflection data to be complete. */
+		static bool Store( const Shader& shader, const u64 content_key );
+
+	private:
+		ShaderProgramCache() = delete;
+
+		static std::filesystem::path CacheFilePath( const Shader& shader );
+	};
+}
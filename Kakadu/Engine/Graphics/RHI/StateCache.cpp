@@ -0,0 +1,344 @@
+// Engine Includes.
+#include "StateCache.h"
+#include "Counters.h"
+#include "Core/Macros.h"
+
+// std Includes.
+#include <array>
+#include <utility> // std::exchange().
+
+namespace Kakadu::RHI::StateCache
+{
+	/*
+	 * Internal types:
+	 */
+
+	template< typename Type >
+	struct Cached
+	{
+		Type value{};
+		bool is_known = false;
+	};
+
+	struct TextureBinding
+	{
+		GLenum target;
+		u32 texture_id;
+
+		bool operator==( const TextureBinding& ) const = default;
+	};
+
+	struct StencilFunction
+	{
+		GLenum function;
+		i32 reference_value;
+		u32 mask;
+
+		bool operator==( const StencilFunction& ) const = default;
+	};
+
+	struct StencilOperation
+	{
+		GLenum stencil_fail;
+		GLenum stencil_pass_depth_fail;
+		GLenum both_pass;
+
+		bool operator==( const StencilOperation& ) const = default;
+	};
+
+	struct BlendFunction
+	{
+		GLenum source_color_factor;
+		GLenum destination_color_factor;
+		GLenum source_alpha_factor;
+		GLenum destination_alpha_factor;
+
+		bool operator==( const BlendFunction& ) const = default;
+	};
+
+	/* GL guarantees at least 80 combined texture image units in 4.6; The engine uses far fewer. Units beyond this are not cached. */
+	constexpr u32 TEXTURE_UNIT_CACHE_SIZE = 32;
+
+	enum CapabilityIndex : u8
+	{
+		DepthTest,
+		StencilTest,
+		Blend,
+		CullFace,
+		Framebuffer_sRGB,
+		DepthClamp,
+
+		Count
+	};
+
+	struct State
+	{
+		Cached< u32 > program;
+		Cached< u32 > vertex_array;
+		Cached< u32 > framebuffer_read;
+		Cached< u32 > framebuffer_draw;
+
+		Cached< u32 > active_texture_unit;
+		std::array< Cached< TextureBinding >, TEXTURE_UNIT_CACHE_SIZE > texture_bindings;
+
+		std::array< Cached< bool >, CapabilityIndex::Count > capabilities;
+
+		Cached< bool > depth_mask;
+		Cached< GLenum > depth_function;
+
+		Cached< u32 > stencil_mask;
+		Cached< StencilFunction > stencil_function;
+		Cached< StencilOperation > stencil_operation;
+
+		Cached< BlendFunction > blend_function;
+		Cached< GLenum > blend_equation;
+
+		Cached< GLenum > cull_face;
+		Cached< GLenum > front_face;
+	};
+
+	/*
+	 * Internal variables:
+	 */
+
+	internal_variable State STATE;
+	internal_variable Statistics STATISTICS_CURRENT;
+	internal_variable Statistics STATISTICS_LAST_FRAME;
+
+	/*
+	 * Internal functions:
+	 */
+
+	/* Returns true if the GL call needs to be issued (and records the new value), false if it is redundant. */
+	template< typename Type >
+	internal_function bool Update( Cached< Type >& cached, const Type& new_value )
+	{
+		if( cached.is_known && cached.value == new_value )
+		{
+			STATISTICS_CURRENT.skipped++;
+			return false;
+		}
+
+		cached.value    = new_value;
+		cached.is_known = true;
+
+		STATISTICS_CURRENT.issued++;
+		return true;
+	}
+
+	template< typename Type >
+	internal_function void Forget( Cached< Type >& cached, const u32 object_id )
+	{
+		if( cached.value == object_id )
+			cached.is_known = false;
+	}
+
+	internal_function constexpr i32 ToCapabilityIndex( const GLenum capability )
+	{
+		switch( capability )
+		{
+			case GL_DEPTH_TEST:			return CapabilityIndex::DepthTest;
+			case GL_STENCIL_TEST:		return CapabilityIndex::StencilTest;
+			case GL_BLEND:				return CapabilityIndex::Blend;
+			case GL_CULL_FACE:			return CapabilityIndex::CullFace;
+			case GL_FRAMEBUFFER_SRGB:	return CapabilityIndex::Framebuffer_sRGB;
+			case GL_DEPTH_CLAMP:		return CapabilityIndex::DepthClamp;
+			default:					return -1;
+		}
+	}
+
+	/*
+	 * Public API:
+	 */
+
+	void Invalidate()
+	{
+		STATE = {};
+	}
+
+	void BeginFrame()
+	{
+		STATISTICS_LAST_FRAME = std::exchange( STATISTICS_CURRENT, {} );
+	}
+
+	const Statistics& LastFrameStatistics()
+	{
+		return STATISTICS_LAST_FRAME;
+	}
+
+	void UseProgram( const u32 program_id )
+	{
+		if( Update( STATE.program, program_id ) )
+		{
+			glUseProgram( program_id );
+			RunningCounters().program_binds++;
+		}
+	}
+
+	void BindVertexArray( const u32 vertex_array_id )
+	{
+		if( Update( STATE.vertex_array, vertex_array_id ) )
+		{
+			glBindVertexArray( vertex_array_id );
+			RunningCounters().vertex_array_binds++;
+		}
+	}
+
+	void BindFramebuffer( const GLenum target, const u32 framebuffer_id )
+	{
+		switch( target )
+		{
+			case GL_READ_FRAMEBUFFER:
+				if( Update( STATE.framebuffer_read, framebuffer_id ) )
+				{
+					glBindFramebuffer( GL_READ_FRAMEBUFFER, framebuffer_id );
+					RunningCounters().framebuffer_binds++;
+				}
+				break;
+			case GL_DRAW_FRAMEBUFFER:
+				if( Update( STATE.framebuffer_draw, framebuffer_id ) )
+				{
+					glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer_id );
+					RunningCounters().framebuffer_binds++;
+				}
+				break;
+			default: /* GL_FRAMEBUFFER */
+			{
+				/* Evaluate both so that both cache entries are updated. */
+				const bool read_changed = Update( STATE.framebuffer_read, framebuffer_id );
+				const bool draw_changed = Update( STATE.framebuffer_draw, framebuffer_id );
+
+				if( read_changed || draw_changed )
+				{
+					glBindFramebuffer( GL_FRAMEBUFFER, framebuffer_id );
+					RunningCounters().framebuffer_binds++;
+				}
+				break;
+			}
+		}
+	}
+
+	void SetActiveTextureUnit( const u32 slot )
+	{
+		if( Update( STATE.active_texture_unit, slot ) )
+			glActiveTexture( GL_TEXTURE0 + slot );
+	}
+
+	void BindTexture( const GLenum target, const u32 texture_id )
+	{
+		/* Binding before any SetActiveTextureUnit() call targets whatever unit is active; Can not cache it. */
+		if( const auto& unit = STATE.active_texture_unit;
+			unit.is_known && unit.value < TEXTURE_UNIT_CACHE_SIZE )
+		{
+			if( Update( STATE.texture_bindings[ unit.value ], TextureBinding{ .target = target, .texture_id = texture_id } ) )
+			{
+				glBindTexture( target, texture_id );
+				RunningCounters().texture_binds++;
+			}
+		}
+		else
+		{
+			STATISTICS_CURRENT.issued++;
+			glBindTexture( target, texture_id );
+			RunningCounters().texture_binds++;
+		}
+	}
+
+	void ForgetProgram( const u32 program_id )
+	{
+		Forget( STATE.program, program_id );
+	}
+
+	void ForgetVertexArray( const u32 vertex_array_id )
+	{
+		Forget( STATE.vertex_array, vertex_array_id );
+	}
+
+	void ForgetFramebuffer( const u32 framebuffer_id )
+	{
+		Forget( STATE.framebuffer_read, framebuffer_id );
+		Forget( STATE.framebuffer_draw, framebuffer_id );
+	}
+
+	void ForgetTexture( const u32 texture_id )
+	{
+		for( auto& binding : STATE.texture_bindings )
+			if( binding.value.texture_id == texture_id )
+				binding.is_known = false;
+	}
+
+	void SetCapability( const GLenum capability, const bool enable )
+	{
+		if( const auto index = ToCapabilityIndex( capability );
+			index >= 0 )
+		{
+			if( not Update( STATE.capabilities[ index ], enable ) )
+				return;
+		}
+		else
+			STATISTICS_CURRENT.issued++;
+
+		if( enable )
+			glEnable( capability );
+		else
+			glDisable( capability );
+	}
+
+	void SetDepthMask( const bool enable )
+	{
+		if( Update( STATE.depth_mask, enable ) )
+			glDepthMask( ( GLboolean )enable );
+	}
+
+	void SetDepthFunction( const GLenum function )
+	{
+		if( Update( STATE.depth_function, function ) )
+			glDepthFunc( function );
+	}
+
+	void SetStencilMask( const u32 mask )
+	{
+		if( Update( STATE.stencil_mask, mask ) )
+			glStencilMask( mask );
+	}
+
+	void SetStencilFunction( const GLenum function, const i32 reference_value, const u32 mask )
+	{
+		if( Update( STATE.stencil_function, StencilFunction{ .function = function, .reference_value = reference_value, .mask = mask } ) )
+			glStencilFunc( function, reference_value, mask );
+	}
+
+	void SetStencilOperation( const GLenum stencil_fail, const GLenum stencil_pass_depth_fail, const GLenum both_pass )
+	{
+		if( Update( STATE.stencil_operation, StencilOperation{ .stencil_fail = stencil_fail, .stencil_pass_depth_fail = stencil_pass_depth_fail, .both_pass = both_pass } ) )
+			glStencilOp( stencil_fail, stencil_pass_depth_fail, both_pass );
+	}
+
+	void SetBlendFunctionSeparate( const GLenum source_color_factor, const GLenum destination_color_factor,
+								   const GLenum source_alpha_factor, const GLenum destination_alpha_factor )
+	{
+		if( Update( STATE.blend_function, BlendFunction{ .source_color_factor      = source_color_factor,
+														 .destination_color_factor = destination_color_factor,
+														 .source_alpha_factor      = source_alpha_factor,
+														 .destination_alpha_factor = destination_alpha_factor } ) )
+			glBlendFuncSeparate( source_color_factor, destination_color_factor, source_alpha_factor, destination_alpha_factor );
+	}
+
+	void SetBlendEquation( const GLenum equation )
+	{
+		if( Update( STATE.blend_equation, equation ) )
+			glBlendEquation( equation );
+	}
+
+	void SetCullFace( const GLenum face )
+	{
+		if( Update( STATE.cull_face, face ) )
+			glCullFace( face );
+	}
+
+	void SetFrontFace( const GLenum winding_order )
+	{
+		if( Update( STATE.front_face, winding_order ) )
+			glFrontFace( winding_order );
+	}
+}
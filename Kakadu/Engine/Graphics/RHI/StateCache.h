@@ -0,0 +1,61 @@
+#pragma once
+
+// Engine Includes.
+#include "RHI.h"
+#include "Core/Types.h"
+
+/* Shadow copy of the (subset of the) OpenGL state that the engine changes frequently.
+ * Every setter compares the requested value against the last one set & issues the GL call only when it differs.
+ * All state changes of the engine are expected to go through here; Code that modifies GL state directly (e.g., 3rd party libraries that do not restore state) should call Invalidate() afterwards.
+ * Cached values start out as "unknown", so the first call to each setter is always issued. */
+
+namespace Kakadu::RHI::StateCache
+{
+	struct Statistics
+	{
+		u64 issued  = 0;
+		u64 skipped = 0;
+	};
+
+	/* Forgets all cached values; The next call to each setter will be issued. */
+	void Invalidate();
+
+	/* Stores the statistics gathered so far as the last frame's & resets the running counters. */
+	void BeginFrame();
+	const Statistics& LastFrameStatistics();
+
+/* Bindings: */
+
+	void UseProgram( const u32 program_id );
+	void BindVertexArray( const u32 vertex_array_id );
+	/* target is one of GL_FRAMEBUFFER, GL_READ_FRAMEBUFFER or GL_DRAW_FRAMEBUFFER. */
+	void BindFramebuffer( const GLenum target, const u32 framebuffer_id );
+	void SetActiveTextureUnit( const u32 slot );
+	/* Binds to the currently active texture unit. */
+	void BindTexture( const GLenum target, const u32 texture_id );
+
+	/* Deleted object names can be recycled by GL; These make sure a recycled name is not mistaken for a still-bound object. */
+	void ForgetProgram( const u32 program_id );
+	void ForgetVertexArray( const u32 vertex_array_id );
+	void ForgetFramebuffer( const u32 framebuffer_id );
+	void ForgetTexture( const u32 texture_id );
+
+/* Fixed-function State: */
+
+	/* Only GL_DEPTH_TEST, GL_STENCIL_TEST, GL_BLEND, GL_CULL_FACE & GL_FRAMEBUFFER_SRGB are cached; Others are always issued. */
+	void SetCapability( const GLenum capability, const bool enable );
+
+	void SetDepthMask( const bool enable );
+	void SetDepthFunction( const GLenum function );
+
+	void SetStencilMask( const u32 mask );
+	void SetStencilFunction( const GLenum function, const i32 reference_value, const u32 mask );
+	void SetStencilOperation( const GLenum stencil_fail, const GLenum stencil_pass_depth_fail, const GLenum both_pass );
+
+	void SetBlendFunctionSeparate( const GLenum source_color_factor, const GLenum destination_color_factor,
+								   const GLenum source_alpha_factor, const GLenum destination_alpha_factor );
+	void SetBlendEquation( const GLenum equation );
+
+	void SetCullFace( const GLenum face );
+	void SetFrontFace( const GLenum winding_order );
+}
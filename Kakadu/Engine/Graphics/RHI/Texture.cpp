@@ -3,6 +3,7 @@
 #include "Capabilities.h"
 #include "DebugLabel.h"
 #include "GLLabelPrefixes.h"
+#include "StateCache.h"
 #include "Texture.h"
 #include "Core/ServiceLocator.hpp"
 #include "Core/Assertion.h"
@@ -13,9 +14,11 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( ZERO_INITIALIZATION ),
+		layer_count( 1 ),
 		type( TextureType::None ),
 		name( "<defaulted>" ),
-		import_settings{ .format = Format::NOT_ASSIGNED }
+		import_settings{ .format = Format::NOT_ASSIGNED },
+		is_loading( false )
 	{
 	}
 
@@ -30,6 +33,7 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( width, height ),
+		layer_count( 1 ),
 		type( TextureType::Texture2D ),
 		name( name ),
 		import_settings
@@ -40,7 +44,8 @@ namespace Kakadu::RHI
 			.min_filter   = min_filter,
 			.mag_filter   = mag_filter,
 			.format       = DetermineActualFormat( format )
-		}
+		},
+		is_loading( false )
 	{
 		glGenTextures( 1, &id.id );
 		Bind();
@@ -74,13 +79,15 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( width, height ),
+		layer_count( 1 ),
 		type( TextureType::Texture2D_MultiSample ),
 		name( multi_sample_texture_name ),
 		import_settings
 		{
 			.format = DetermineActualFormat( format ),
 			.msaa = MSAA{ Capabilities::QueryMSAASupport( format, sample_count ) ? sample_count : u8( 1 ) }
-		}
+		},
+		is_loading( false )
 	{
 		glGenTextures( 1, &id.id );
 		Bind();
@@ -112,6 +119,7 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( width, height ),
+		layer_count( 1 ),
 		type( TextureType::Cubemap ),
 		name( name ),
 		import_settings
@@ -120,7 +128,8 @@ namespace Kakadu::RHI
 			.min_filter   = min_filter,
 			.mag_filter   = mag_filter,
 			.format       = DetermineActualFormat( format )
-		}
+		},
+		is_loading( false )
 	{
 		glGenTextures( 1, &id.id );
 		Bind();
@@ -144,33 +153,92 @@ namespace Kakadu::RHI
 		Unbind();
 	}
 
+	/* 2D array allocate-only constructor (no data). */
+	Texture::Texture( Texture2DArrayConstructorTag tag,
+					  const std::string_view name,
+					  //const std::byte* data, This is omitted from this public constructor.
+					  const Format format,
+					  const i32 width, const i32 height,
+					  const i32 layer_count,
+					  const TextureWrapping wrap_u, const TextureWrapping wrap_v,
+					  const Color4 border_color,
+					  const TextureFiltering min_filter, TextureFiltering mag_filter )
+		:
+		id( {} ),
+		size( width, height ),
+		layer_count( layer_count ),
+		type( TextureType::Texture2DArray ),
+		name( name ),
+		import_settings
+		{
+			.wrap_u       = wrap_u,
+			.wrap_v       = wrap_v,
+			.border_color = border_color,
+			.min_filter   = min_filter,
+			.mag_filter   = mag_filter,
+			.format       = DetermineActualFormat( format )
+		},
+		is_loading( false )
+	{
+		ASSERT_DEBUG_ONLY( layer_count > 0 && "Texture arrays need at least 1 layer!" );
+
+		glGenTextures( 1, &id.id );
+		Bind();
+
+#ifdef _EDITOR
+		if( not name.empty() )
+			DebugLabel::Set( GL_TEXTURE, id.id, GL_LABEL_PREFIX_TEXTURE + this->name );
+#endif // _EDITOR
+
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, TextureFilteringToGLEnum( min_filter ) );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, TextureFilteringToGLEnum( mag_filter ) );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S,	 TextureWrappingToGLEnum( wrap_u ) );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T,	 TextureWrappingToGLEnum( wrap_v ) );
+
+		if( wrap_u == TextureWrapping::ClampToBorder || wrap_v == TextureWrapping::ClampToBorder )
+			glTexParameterfv( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, border_color.data );
+
+		glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, InternalFormat( format ), width, height, layer_count, 0, PixelDataFormat( format ), PixelDataType( format ), nullptr );
+
+		/* No mip-map generation since there is no data yet. */
+
+		Unbind();
+	}
+
 	Texture::Texture( Texture&& donor )
 		:
 		id( std::exchange( donor.id, {} ) ),
 		size( std::move( donor.size ) ),
+		layer_count( std::exchange( donor.layer_count, 1 ) ),
 		type( std::move( donor.type ) ),
 #ifdef _DEBUG
 		name( std::exchange( donor.name, "<moved-from>" ) ),
 #else
 		name( std::move( donor.name ) ),
 #endif // _DEBUG
-		import_settings( std::exchange( donor.import_settings, { .format = Format::NOT_ASSIGNED } ) )
+		import_settings( std::exchange( donor.import_settings, { .format = Format::NOT_ASSIGNED } ) ),
+		is_loading( std::exchange( donor.is_loading, false ) )
 	{
+		ASSERT_DEBUG_ONLY( not is_loading && "A Texture that is still loading asynchronously can not be moved!" );
 	}
 
 	Texture& Texture::operator=( Texture&& donor )
 	{
 		Delete();
 
-		id   = std::exchange( donor.id, {} );
-		size = std::move( donor.size );
-		type = std::move( donor.type );
+		id          = std::exchange( donor.id, {} );
+		size        = std::move( donor.size );
+		layer_count = std::exchange( donor.layer_count, 1 );
+		type        = std::move( donor.type );
 #ifdef _DEBUG
 		name = std::exchange( donor.name, "<moved-from>" );
 #else
 		name = std::move( donor.name );
 #endif // _DEBUG
 		import_settings = std::exchange( donor.import_settings, { .format = Format::NOT_ASSIGNED } );
+		is_loading      = std::exchange( donor.is_loading, false );
+
+		ASSERT_DEBUG_ONLY( not is_loading && "A Texture that is still loading asynchronously can not be moved!" );
 
 		return *this;
 	}
@@ -187,7 +255,7 @@ namespace Kakadu::RHI
 
 	void Texture::Activate( const i32 slot ) const
 	{
-		glActiveTexture( GL_TEXTURE0 + slot );
+		StateCache::SetActiveTextureUnit( slot );
 		Bind();
 	}
 
@@ -268,6 +336,16 @@ namespace Kakadu::RHI
 		}
 	}
 
+	void Texture::ProcessAsyncUploads( const float time_budget_in_milliseconds )
+	{
+		Loader::ProcessAsyncUploads( time_budget_in_milliseconds );
+	}
+
+	void Texture::ShutdownAsyncLoading()
+	{
+		Loader::ShutdownAsync();
+	}
+
 /*
  * TEXTURE PRIVATE API
  */
@@ -284,6 +362,7 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( width, height ),
+		layer_count( 1 ),
 		type( TextureType::Texture2D ),
 		name( name ),
 		import_settings
@@ -295,7 +374,8 @@ namespace Kakadu::RHI
 			.mag_filter       = mag_filter,
 			.generate_mipmaps = true,
 			.format           = DetermineActualFormat( format )
-		}
+		},
+		is_loading( false )
 	{
 		glGenTextures( 1, &id.id );
 		Bind();
@@ -333,6 +413,7 @@ namespace Kakadu::RHI
 		:
 		id( {} ),
 		size( width, height ),
+		layer_count( 1 ),
 		type( TextureType::Cubemap ),
 		name( name ),
 		import_settings
@@ -341,7 +422,8 @@ namespace Kakadu::RHI
 			.min_filter       = min_filter,
 			.mag_filter       = mag_filter,
 			.format           = DetermineActualFormat( format )
-		}
+		},
+		is_loading( false )
 	{
 		glGenTextures( 1, &id.id );
 		Bind();
@@ -366,6 +448,12 @@ namespace Kakadu::RHI
 
 	void Texture::Delete()
 	{
+		if( is_loading )
+		{
+			Loader::CancelAsync( *this );
+			is_loading = false;
+		}
+
 		if( IsValid() )
 		{
 #ifdef _EDITOR
@@ -373,17 +461,18 @@ namespace Kakadu::RHI
 #endif // _EDITOR
 
 			glDeleteTextures( 1, &id.id );
+			StateCache::ForgetTexture( id.id );
 			id.Reset(); // OpenGL does not reset the id to zero.
 		}
 	}
 
 	void Texture::Bind() const
 	{
-		glBindTexture( TextureTypeToGLEnum( type ), id.id );
+		StateCache::BindTexture( TextureTypeToGLEnum( type ), id.id );
 	}
 
 	void Texture::Unbind() const
 	{
-		glBindTexture( TextureTypeToGLEnum( type ), 0 );
+		StateCache::BindTexture( TextureTypeToGLEnum( type ), 0 );
 	}
 }
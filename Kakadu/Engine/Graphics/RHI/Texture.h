@@ -27,10 +27,12 @@ namespace Kakadu::RHI
 	{
 		struct CubeMapConstructorTag {};
 		struct Texture2DMultiSampleConstructorTag {};
+		struct Texture2DArrayConstructorTag {};
 
 	public:
 		static constexpr CubeMapConstructorTag CUBEMAP_CONSTRUCTOR = {};
 		static constexpr Texture2DMultiSampleConstructorTag TEXTURE_2D_MULTISAMPLE_CONSTRUCTOR = {};
+		static constexpr Texture2DArrayConstructorTag TEXTURE_2D_ARRAY_CONSTRUCTOR = {};
 
 		enum class Format : u8
 		{
@@ -120,7 +122,7 @@ namespace Kakadu::RHI
 	private:
 		friend class AssetDatabase< Texture >;
 		
-		ASSET_LOADER_CLASS_DECLARATION( Texture );
+		ASSET_LOADER_CLASS_DECLARATION_WITH_ASYNC( Texture );
 
 	public:
 		Texture();
@@ -156,6 +158,21 @@ namespace Kakadu::RHI
 				 const TextureFiltering min_filter = TextureFiltering::Linear_MipmapLinear,
 				 const TextureFiltering mag_filter = TextureFiltering::Linear );
 
+		/* 2D array allocate-only constructor (no data).
+		 * All layers share the same size, format & sampler state. */
+		Texture( Texture2DArrayConstructorTag tag,
+				 const std::string_view name,
+				 //const std::byte* data, This is omitted from this public constructor.
+				 const Format format,
+				 const i32 width,
+				 const i32 height,
+				 const i32 layer_count,
+				 const TextureWrapping wrap_u      = TextureWrapping::ClampToEdge,
+				 const TextureWrapping wrap_v      = TextureWrapping::ClampToEdge,
+				 const Color4 border_color         = Color4::Black(),
+				 const TextureFiltering min_filter = TextureFiltering::Linear_MipmapLinear,
+				 const TextureFiltering mag_filter = TextureFiltering::Linear );
+
 		DELETE_COPY_CONSTRUCTORS( Texture );
 
 		/* Allow moving: */
@@ -166,11 +183,14 @@ namespace Kakadu::RHI
 
 	/* Queries: */
 		bool IsValid() const { return ( bool )id; }
+		/* True while an asynchronously loaded Texture still shows its placeholder contents. */
+		bool IsLoading() const { return is_loading; }
 
 		RHI::TextureID		Id()						const { return id; }
 		const Vector2I&		Size()						const { return size; }
 		i32					Width()						const { return size.X(); }
 		i32					Height()					const { return size.Y(); }
+		i32					LayerCount()				const { return layer_count; } // 1 for non-array Textures.
 		TextureType			Type()						const { return type; }
 		const std::string&	Name()						const { return name; }
 		TextureWrapping		Wrapping_U()				const { return import_settings.wrap_u; }
@@ -195,6 +215,12 @@ namespace Kakadu::RHI
 		static u32 PixelDataFormat( const Texture::Format format );
 		static u32 PixelDataType( const Texture::Format format );
 
+		/* Streams the decoded images of asynchronously loaded Textures to the GPU, until the given time budget is used up (at least one per call).
+		 * Has to be called once per frame on the GL thread. */
+		static void ProcessAsyncUploads( const float time_budget_in_milliseconds );
+		/* Stops the decoding threads & releases the GL resources used for streaming. Has to be called before the GL context is destroyed. */
+		static void ShutdownAsyncLoading();
+
 	private:
 		/* Private regular constructor: Only the AssetDatabase< Texture > should be able to construct a Texture with data. */
 		Texture( const std::string_view name,
@@ -230,11 +256,14 @@ namespace Kakadu::RHI
 	private:
 		RHI::TextureID id;
 		Vector2I size;
+		i32 layer_count;
 		TextureType type;
 		std::string name;
 
 		ImportSettings import_settings;
 
-		/* 4 bytes of padding. */
+		bool is_loading;
+
+		/* 3 bytes of padding. */
 	};
 };
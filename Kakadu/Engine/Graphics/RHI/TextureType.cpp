@@ -11,6 +11,7 @@ namespace Kakadu::RHI
 		{
 			case Kakadu::RHI::TextureType::Texture2D:				return GL_TEXTURE_2D;
 			case Kakadu::RHI::TextureType::Texture2D_MultiSample:	return GL_TEXTURE_2D_MULTISAMPLE;
+			case Kakadu::RHI::TextureType::Texture2DArray:			return GL_TEXTURE_2D_ARRAY;
 			case Kakadu::RHI::TextureType::Cubemap:					return GL_TEXTURE_CUBE_MAP;
 
 			default:
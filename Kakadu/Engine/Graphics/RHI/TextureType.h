@@ -11,6 +11,7 @@ namespace Kakadu::RHI
 
 		Texture2D,
 		Texture2D_MultiSample,
+		Texture2DArray,
 		Cubemap 
 	};
 
@@ -4,6 +4,7 @@
 #include "DataType.h"
 #include "Graphics/UniformAnnotation.h" // TODO: Dependency - wrong direction. Fix later by moving this out of both Uniform::Information and Shader and keep elsewhere.
 #include "Core/Blob.hpp"
+#include "Core/StringID.h"
 #include "Core/Types.h"
 
 // std Includes.
@@ -14,6 +15,17 @@
 
 namespace Kakadu::RHI::Uniform
 {
+	/* Index into a process-wide table of uniform names; Obtained once via Shader::RegisterUniformHandle().
+	 * The same Handle is valid for every Shader (and Material), so it can be resolved once & stored.
+	 * Shaders map Handles to their Information lazily; This mapping is redone after recompilation, so Handles stay valid across hot-reloads. */
+	struct Handle
+	{
+		u32 index;
+
+		constexpr bool operator ==( const Handle& other ) const = default;
+		constexpr bool operator !=( const Handle& other ) const = default;
+	};
+
 	struct Information
 	{
 		i32 location_or_block_index; // Changes meaning depending on context; location if this is a stand-alone uniform, or the index of the block if this resides in a uniform buffer block.
@@ -80,9 +92,10 @@ namespace Kakadu::RHI::Uniform
 		BufferCategory category;
 
 		std::unordered_map< std::string, Information*						> members_map;			// Key is qualified by the buffer name. Example: "Lighting.spot_light_data".
-		std::unordered_map< std::string, BufferMemberInformation_Struct		> members_struct_map;	// Key is the uniform name alone. Example: "spot_light_data".
-		std::unordered_map< std::string, BufferMemberInformation_Array		> members_array_map;	// Key is the uniform name alone. Example: "point_lights".
-		std::unordered_map< std::string, Information*						> members_single_map;	// Key is the uniform name alone. Example: "color_modulation".
+		/* Looked up on every partial update, hence keyed by (interned) StringIDs instead: */
+		std::unordered_map< StringID, BufferMemberInformation_Struct		> members_struct_map;	// Key is the uniform name alone. Example: "spot_light_data".
+		std::unordered_map< StringID, BufferMemberInformation_Array			> members_array_map;	// Key is the uniform name alone. Example: "point_lights".
+		std::unordered_map< StringID, Information*							> members_single_map;	// Key is the uniform name alone. Example: "color_modulation".
 
 		bool IsRegular()	const { return category == BufferCategory::Regular;		}
 		bool IsGlobal()		const { return category == BufferCategory::Global;		}
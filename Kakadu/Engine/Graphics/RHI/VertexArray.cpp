@@ -2,6 +2,7 @@
 #include "RHI.h"
 #include "DebugLabel.h"
 #include "GLLabelPrefixes.h"
+#include "StateCache.h"
 #include "VertexArray.h"
 #include "Core/ServiceLocator.hpp"
 
@@ -130,12 +131,12 @@ namespace Kakadu::RHI
 
 	void VertexArray::Bind() const
 	{
-		glBindVertexArray( id.id );
+		StateCache::BindVertexArray( id.id );
 	}
 
 	void VertexArray::Unbind() const
 	{
-		glBindVertexArray( 0 );
+		StateCache::BindVertexArray( 0 );
 	}
 
 	void VertexArray::Delete()
@@ -143,6 +144,7 @@ namespace Kakadu::RHI
 		if( IsValid() )
 		{
 			glDeleteVertexArrays( 1, &id.id );
+			StateCache::ForgetVertexArray( id.id );
 			id.Reset(); // OpenGL does not reset the id to zero.
 		}
 	}
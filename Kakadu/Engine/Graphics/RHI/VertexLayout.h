@@ -82,6 +82,7 @@ namespace Kakadu::RHI
 		u32 Stride_Instanced() const;
 		
 		u32 Count() const { return ( u32 )attributes.size(); }
+		std::span< const VertexAttribute > Attributes() const { return attributes; }
 
 		bool IsCompatibleWith( const VertexLayout& other ) const;
 
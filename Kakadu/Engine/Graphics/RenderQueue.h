@@ -1,6 +1,7 @@
 #pragma once
 
 // Engine Includes.
+#include "DrawPacket.h"
 #include "Renderable.h"
 #include "RenderQueueID.h"
 #include "RenderState.h"
@@ -31,6 +32,9 @@ namespace Kakadu
 
 		std::vector< Renderable* > renderable_list;
 
+		/* Rebuilt & sorted every frame from the renderable_list (visible & enabled Renderables only). Kept here to reuse its allocation. */
+		std::vector< DrawPacket > draw_packet_list;
+
 		std::unordered_map< RHI::Shader*, ReferenceCount > shader_reference_counts;
 		std::map< std::string, RHI::Shader* > shaders_in_flight;
 
@@ -20,12 +20,13 @@ namespace Kakadu
 		bool depth_write_enable  = true;
 		bool stencil_test_enable = false;
 		bool blending_enable     = false;
+		bool depth_clamp_enable  = false; // Fragments in front of the near plane (or beyond the far plane) get clamped depths instead of being clipped.
 
 	/* Sorting: */
 
 		SortingMode sorting_mode = SortingMode::FrontToBack;
 
-		/* 2 bytes of padding here. */
+		/* 1 byte of padding here. */
 
 	/* Face-culling & winding-order: */
 
@@ -56,5 +57,5 @@ namespace Kakadu
 
 		RHI::BlendingFunction blending_function = RHI::BlendingFunction::Add;
 
-	}; /* Total: 2 bytes of padding. */
+	}; /* Total: 1 byte of padding. */
 }
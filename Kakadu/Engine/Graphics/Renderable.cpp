@@ -14,20 +14,26 @@ namespace Kakadu
 		is_enabled( false ),
 		is_receiving_shadows( false ),
 		is_casting_shadows( false ),
+		is_static( false ),
 		transform( nullptr ),
-		world_matrix( nullptr ),
+		transform_hierarchy( nullptr ),
+		transform_hierarchy_node_index( TransformHierarchy::NO_PARENT ),
+		world_bounds_version( 0 ),
 		mesh( nullptr ),
 		material( nullptr )
 	{
 	}
 
-	Renderable::Renderable( const Mesh* mesh, Material* material, Transform* transform, const bool receive_shadows, const bool cast_shadows, const Matrix4x4* world_matrix )
+	Renderable::Renderable( const Mesh* mesh, Material* material, Transform* transform, const bool receive_shadows, const bool cast_shadows )
 		:
 		is_enabled( true ),
 		is_receiving_shadows( receive_shadows ),
 		is_casting_shadows( cast_shadows ),
+		is_static( false ),
 		transform( transform ),
-		world_matrix( world_matrix ),
+		transform_hierarchy( nullptr ),
+		transform_hierarchy_node_index( TransformHierarchy::NO_PARENT ),
+		world_bounds_version( 0 ),
 		mesh( mesh ),
 		material( material )
 	{
@@ -44,14 +50,23 @@ namespace Kakadu
 #endif // _DEBUG || _EDITOR
 	}
 
+	Renderable::Renderable( const Mesh* mesh, Material* material, TransformHierarchy& transform_hierarchy, const TransformHierarchy::NodeIndex transform_hierarchy_node_index,
+							const bool receive_shadows, const bool cast_shadows )
+		:
+		Renderable( mesh, material, nullptr, receive_shadows, cast_shadows )
+	{
+		this->transform_hierarchy            = &transform_hierarchy;
+		this->transform_hierarchy_node_index = transform_hierarchy_node_index;
+	}
+
 	Renderable::~Renderable()
 	{
 	}
 
 	const Matrix4x4* Renderable::WorldMatrix()
 	{
-		if( world_matrix )
-			return world_matrix;
+		if( transform_hierarchy )
+			return &transform_hierarchy->WorldMatrix( transform_hierarchy_node_index );
 
 		if( transform )
 			return &transform->GetFinalMatrix();
@@ -61,8 +76,8 @@ namespace Kakadu
 
 	Vector3 Renderable::WorldPosition() const
 	{
-		if( world_matrix )
-			return world_matrix->GetRow< 3 >( 3 /* Last row holds the translation in row-major form. */ );
+		if( transform_hierarchy )
+			return transform_hierarchy->WorldMatrix( transform_hierarchy_node_index ).GetRow< 3 >( 3 /* Last row holds the translation in row-major form. */ );
 
 		if( transform )
 			return transform->GetTranslation();
@@ -70,13 +85,43 @@ namespace Kakadu
 		return Vector3{};
 	}
 
+	Math::AABB Renderable::WorldBounds()
+	{
+		if( mesh->HasInstancing() )
+			return mesh->Bounds_Instanced();
+
+		if( not HasWorldTransform() )
+			return Math::AABB::Infinite();
+
+		if( const auto version = WorldMatrixVersion();
+			version != world_bounds_version )
+		{
+			world_bounds         = mesh->Bounds().Transformed( *WorldMatrix() );
+			world_bounds_version = version;
+		}
+
+		return world_bounds;
+	}
+
 	void Renderable::SetMesh( const Mesh* mesh )
 	{
 		this->mesh = mesh;
+		world_bounds_version = 0;
 	}
 
 	void Renderable::SetMaterial( Material* material )
 	{
 		this->material = material;
 	}
+
+	u32 Renderable::WorldMatrixVersion() const
+	{
+		if( transform_hierarchy )
+			return transform_hierarchy->WorldMatrixVersion( transform_hierarchy_node_index );
+
+		if( transform )
+			return transform->Version();
+
+		return 0;
+	}
 }
@@ -4,6 +4,7 @@
 #include "Material.hpp"
 #include "Mesh.h"
 #include "Scene/Transform.h"
+#include "Scene/TransformHierarchy.h"
 
 namespace Kakadu
 {
@@ -18,11 +19,12 @@ namespace Kakadu
 
 		DEFAULT_COPY_AND_MOVE_CONSTRUCTORS( Renderable );
 
-		/* Shadows are off by default, for perf. reasons. User must enable them explicitly in order to use them. 
-		 *
-		 * "world_matrix" is for hierarchy-baked nodes that supply a precomputed world matrix directly (which may contain shear and therefore can not be a Transform).
-		 * When provided, it takes precedence over "transform" as the source of the world transform. Root/standalone objects keep using "transform" instead. */
-		Renderable( const Mesh* mesh, Material* material, Transform* transform = nullptr, const bool receive_shadows = false, const bool cast_shadows = false, const Matrix4x4* world_matrix = nullptr );
+		/* Shadows are off by default, for perf. reasons. User must enable them explicitly in order to use them. */
+		Renderable( const Mesh* mesh, Material* material, Transform* transform = nullptr, const bool receive_shadows = false, const bool cast_shadows = false );
+		/* For hierarchy nodes (e.g., of a ModelInstance), whose world matrices may contain shear and therefore can not be a Transform.
+		 * The hierarchy must outlive the Renderable & must not move. */
+		Renderable( const Mesh* mesh, Material* material, TransformHierarchy& transform_hierarchy, const TransformHierarchy::NodeIndex transform_hierarchy_node_index,
+					const bool receive_shadows = false, const bool cast_shadows = false );
 
 		~Renderable();
 
@@ -32,12 +34,15 @@ namespace Kakadu
 		const Material*		GetMaterial()	const { return material;	}
 
 		/* World matrix to upload to the GPU.
-		 * Sourced from the directly-supplied world matrix (hierarchy-baked nodes) or the Transform's final matrix (root objects).
+		 * Sourced from the hierarchy node's world matrix or the Transform's final matrix (root objects).
 		 * Returns nullptr if neither is set. */
 		const Matrix4x4* WorldMatrix();
 		/* Cheap world-space position that can be used for sorting. Does not trigger a Transform final-matrix recompute. */
 		Vector3 WorldPosition() const;
-		bool HasWorldTransform() const { return transform || world_matrix; }
+		bool HasWorldTransform() const { return transform || transform_hierarchy; }
+		/* World-space bounds used for culling; Only recalculated when the world matrix's version changed since the last call.
+		 * Instanced Meshes supply their own (world-space) instance bounds. Renderables without a world transform (screen-space quads, skyboxes etc.) return infinite bounds, i.e., are never culled. */
+		Math::AABB WorldBounds();
 
 		void SetMesh( const Mesh* mesh );
 		void SetMaterial( Material* material );
@@ -46,12 +51,22 @@ namespace Kakadu
 		bool is_enabled;
 		bool is_receiving_shadows;
 		bool is_casting_shadows;
-		/* 5 bytes of padding. */
+		/* Static renderables are not expected to move; The Renderer caches their shadows & only re-renders them when they (or the light) do change. */
+		bool is_static;
+		/* 4 bytes of padding. */
+
+	private:
+		/* 0 means "never seen"; Both Transform & TransformHierarchy versions start at 1. */
+		u32 WorldMatrixVersion() const;
 
 	private:
 		Transform* transform;
-		const Matrix4x4* world_matrix;
+		TransformHierarchy* transform_hierarchy;
+		TransformHierarchy::NodeIndex transform_hierarchy_node_index;
+		u32 world_bounds_version;
 		const Mesh* mesh;
 		Material* material;
+
+		Math::AABB world_bounds;
 	};
 }
@@ -5,6 +5,7 @@
 #include "BuiltinTextures.h"
 #include "Core/AssetDatabase.hpp"
 #include "Core/AssetDatabase_Tracked.hpp"
+#include "Core/Hash.h"
 #include "Core/ImGuiCustomColors.h"
 #include "Core/ImGuiDrawer.hpp"
 #include "Core/ImGuiUtility.h"
@@ -14,11 +15,18 @@
 #include "Primitive/Primitive_Cube_FullScreen.h"
 #include "RHI/GLDebugOutput.h"
 #include "RHI/GLLabelPrefixes.h"
+#include "RHI/ShaderCompiler.h"
+#include "RHI/ShaderIncludePreprocessing.h"
+#include "RHI/StateCache.h"
 #include "RHI/GLDebugGroup.h" // TODO: Enable only for non-standalone builds.
+#include "RHI/GPUProfiler.h"
 
 // Vendor Includes.
 #include <IconFontCppHeaders/IconsFontAwesome6.h>
 
+// std Includes.
+#include <deque>
+
 #ifdef _EDITOR
 #define LOG_WARNING( message ) Log::Warning( ICON_FA_DRAW_POLYGON " " message )
 #define LOG_ERROR( message ) Log::Error( ICON_FA_DRAW_POLYGON " " message )
@@ -41,8 +49,81 @@ if( not render_queue_map.contains( queue_id ) )\
 #define LOG_ERROR_AND_RETURN_IF_QUEUE_DOES_NOT_EXIST( function_name, queue_id ) do {} while( false )
 #endif // _EDITOR
 
+/* Opens a debug group (for graphics debuggers), a GPU timing scope (see RHI::GPUProfiler) & a frame statistics scope (see FrameStatisticsRecorder) of the same name,
+ * until the end of the enclosing block. */
+#define RENDERER_SCOPE( name )\
+const std::string renderer_scope_name( name );\
+KAKADU_GL_DEBUG_GROUP( renderer_scope_name )\
+KAKADU_GPU_PROFILE_SCOPE( gpu_profiler, renderer_scope_name )\
+KAKADU_FRAME_STATISTICS_SCOPE( frame_statistics_recorder, renderer_scope_name )
+
 namespace Kakadu
 {
+	/*
+	 * Internal functions:
+	 */
+
+	/* Records a single glDraw*() call in RHI::RunningCounters(). */
+	internal_function void CountDrawCall( const RHI::Primitive primitive, const i32 vertex_count, const u32 instance_count, const bool is_indexed, const bool is_instanced )
+	{
+		auto& counters = RHI::RunningCounters();
+
+		counters.draw_calls++;
+		counters.draw_calls_indexed   += is_indexed;
+		counters.draw_calls_instanced += is_instanced;
+		counters.primitives           += ( u64 )RHI::PrimitiveCount( primitive, ( u32 )vertex_count ) * instance_count;
+		counters.instances            += instance_count;
+	}
+
+	/* Cached hashes reject most non-equivalent pairs without comparing their uniform blobs & texture maps. */
+	internal_function bool MaterialsAreEquivalent( const Material& material_1, const Material& material_2 )
+	{
+		return &material_1 == &material_2 ||
+			   ( material_1.ParameterHash() == material_2.ParameterHash() && material_1.IsEquivalentTo( material_2 ) );
+	}
+
+	/* Returns one past the last packet of the run starting at run_begin that can be merged into a single instanced draw call:
+	 * Consecutive packets with the same Mesh (& an equivalent Material, if requested) that all have world transforms. */
+	internal_function std::size_t FindDynamicInstancingRunEnd( const std::vector< DrawPacket >& draw_packet_list, const std::size_t run_begin, const bool material_needs_to_match )
+	{
+		const Renderable& first = *draw_packet_list[ run_begin ].renderable;
+
+		std::size_t run_end = run_begin + 1;
+		for( ; run_end < draw_packet_list.size(); run_end++ )
+		{
+			const Renderable& renderable = *draw_packet_list[ run_end ].renderable;
+
+			if( renderable.GetMesh() != first.GetMesh() ||
+				( material_needs_to_match && not MaterialsAreEquivalent( *renderable.GetMaterial(), *first.GetMaterial() ) ) ||
+				not renderable.HasWorldTransform() )
+				break;
+		}
+
+		return run_end;
+	}
+
+	/* Returns one past the last packet of the run starting at run_begin that can be submitted with a single indirect multi-draw:
+	 * Consecutive packets with pooled Meshes of the same GeometryPool page & primitive type (& an equivalent Material, if requested) that all have world transforms. */
+	internal_function std::size_t FindMultiDrawRunEnd( const std::vector< DrawPacket >& draw_packet_list, const std::size_t run_begin, const bool material_needs_to_match )
+	{
+		const Renderable& first = *draw_packet_list[ run_begin ].renderable;
+
+		std::size_t run_end = run_begin + 1;
+		for( ; run_end < draw_packet_list.size(); run_end++ )
+		{
+			const Renderable& renderable = *draw_packet_list[ run_end ].renderable;
+
+			if( not renderable.GetMesh()->IsPooled() ||
+				renderable.GetMesh()->VertexArrayId() != first.GetMesh()->VertexArrayId() ||
+				renderable.GetMesh()->Primitive() != first.GetMesh()->Primitive() ||
+				( material_needs_to_match && not MaterialsAreEquivalent( *renderable.GetMaterial(), *first.GetMaterial() ) ) ||
+				not renderable.HasWorldTransform() )
+				break;
+		}
+
+		return run_end;
+	}
+
 	Renderer::Renderer( Description&& description, RendererIntrospectionSurface* introspection_surface )
 		:
 		wireframe_thickness_in_pixels( 1.0f ),
@@ -59,9 +140,17 @@ namespace Kakadu
 			}
 		),
 		framebuffer_output_index( description.output_to_composite_framebuffer ? BuiltinFramebufferIndex::Composite : BuiltinFramebufferIndex::Default ),
-		lights_point_active_count( 0 ),
-		lights_spot_active_count( 0 ),
-		shadow_mapping_projection_parameters{ .left = -50.0f, .right = +50.0f, .bottom = -50.0f, .top = +50.0f, .near = 0.1f, .far = 100.0f },
+		light_cluster_buffer( 256 * 1024 ),
+		draw_transform_buffer( 1024 ),
+		draw_command_buffer( 256 ),
+		gpu_profiler(),
+		frame_statistics_recorder(),
+		shadow_mapping_settings(),
+		shadow_mapping_settings_in_use(),
+		shadow_cascades{},
+		shadow_cascade_active_count( 0 ),
+		shadow_static_caster_signature( 0 ),
+		uniform_handle_transform_world( RHI::Shader::RegisterUniformHandle( "uniform_transform_world" ) ),
 		shaders_need_uniform_buffer_lighting( false ),
 		shaders_need_uniform_buffer_other( false ),
 		framebuffer_sRGB_encoding_is_enabled( false ),
@@ -85,11 +174,7 @@ namespace Kakadu
 
 		DetermineMSAASampleCountsPerFormat();
 
-		if( shaders_need_uniform_buffer_lighting )
-		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED", Vector4( 0.005f, 0.05f, 0.0f, 0.0f ) );
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y",		Vector2I( 3, 3 ) );
-		}
+		CreateShadowMapFramebuffer();
 
 		InitializeBuiltinQueues();
 		InitializeBuiltinPasses();
@@ -109,7 +194,8 @@ namespace Kakadu
 
 	void Renderer::Update()
 	{
-		CalculateShadowMappingInformation();
+		if( shadow_mapping_settings != shadow_mapping_settings_in_use )
+			CreateShadowMapFramebuffer();
 	}
 
 	void Renderer::UpdatePerPass( const RenderPassID pass_id_to_update, Camera& camera )
@@ -135,6 +221,20 @@ namespace Kakadu
 
 	void Renderer::RenderFrame()
 	{
+		gpu_profiler.BeginFrame();
+		frame_statistics_recorder.BeginFrame();
+
+		RENDERER_SCOPE( "Frame" );
+
+		RHI::StateCache::BeginFrame();
+
+		draw_transform_buffer.BeginFrame();
+		draw_command_buffer.BeginFrame();
+		light_cluster_buffer.BeginFrame();
+
+		/* Cascades follow the camera, so they can only be fitted once the lighting pass is updated for this frame. */
+		CalculateShadowMappingInformation();
+
 		// "Shaded" part of shaded wireframe needs to run first, which is in here.
 		if( viewport_shading_mode != ViewportShadingMode::Shaded && viewport_shading_mode != ViewportShadingMode::ShadedWireframe )
 		{
@@ -147,11 +247,18 @@ namespace Kakadu
 		{
 			if( PassHasContentToRender( pass ) )
 			{
-				KAKADU_GL_DEBUG_GROUP( GL_LABEL_PREFIX_RENDER_PASS + pass.name );
+				RENDERER_SCOPE( GL_LABEL_PREFIX_RENDER_PASS + pass.name );
+
+				if( pass_id == RENDER_PASS_ID_SHADOW_MAPPING )
+				{
+					RenderShadowMappingPass( pass );
+					continue;
+				}
 
 				SetIntrinsicsPerPass( pass );
 
 				const Vector3 camera_position( Matrix::CameraWorldPositionFromViewMatrix( current_camera_info.view_matrix ) );
+				const Math::Frustum frustum( current_camera_info.view_projection_matrix );
 
 				UploadIntrinsics();
 				UploadGlobals();
@@ -163,83 +270,16 @@ namespace Kakadu
 					if( auto& queue = render_queue_map[ queue_id ]; 
 						QueueHasContentToRender( queue ) )
 					{
-						KAKADU_GL_DEBUG_GROUP( GL_LABEL_PREFIX_RENDER_QUEUE + queue.name );
+						RENDERER_SCOPE( GL_LABEL_PREFIX_RENDER_QUEUE + queue.name );
 
-						// TODO: Do not set render state for state that is not changing (i.e., dirty check).
-						if( queue.render_state_override )
-						{
-							if( pass.render_state_override_is_allowed )
-								SetRenderState( *queue.render_state_override, pass.target_framebuffer /* No clearing for queues. */ );
+						/* Redundant state changes are filtered out by RHI::StateCache. */
+						if( queue.render_state_override && pass.render_state_override_is_allowed )
+							SetRenderState( *queue.render_state_override, pass.target_framebuffer /* No clearing for queues. */ );
 
-							SortRenderablesInQueue( camera_position, queue.renderable_list, queue.render_state_override->sorting_mode );
-						}
-
-						switch( pass_id.id )
-						{
-							case RENDER_PASS_ID_SHADOW_MAPPING.id:
-							{
-								RHI::Shader& shadow_map_write_shader           = *BuiltinShaders::Get( "Shadow-map Write" );
-								RHI::Shader& shadow_map_write_instanced_shader = *BuiltinShaders::Get( "Shadow-map Write (Instanced)" );
-								
-								shadow_map_write_shader.Bind();
+						const RenderState& effective_render_state = queue.render_state_override ? *queue.render_state_override : pass.render_state;
 
-								for( auto& renderable : queue.renderable_list )
-								{
-									if( renderable->is_enabled && renderable->is_casting_shadows && not renderable->mesh->HasInstancing() )
-									{
-										renderable->mesh->Bind();
-
-										if( renderable->HasWorldTransform() )
-											shadow_map_write_shader.SetUniform( "uniform_transform_world", *renderable->WorldMatrix() );
-
-										DrawMesh( *renderable->mesh );
-									}
-								}
-
-								shadow_map_write_instanced_shader.Bind();
-
-								for( auto& renderable : queue.renderable_list )
-								{
-									if( renderable->is_enabled && renderable->is_casting_shadows && renderable->mesh->HasInstancing() )
-									{
-										renderable->mesh->Bind();
-
-										DrawMesh( *renderable->mesh );
-									}
-								}
-							}
-							break;
-
-							default: // "Regular" passes:
-							{
-								for( const auto& [ shader_name, shader ] : queue.shaders_in_flight )
-								{
-									shader->Bind();
-
-									for( auto& [ material_name, material ] : queue.materials_in_flight )
-									{
-										if( material->shader->Id() == shader->Id() )
-										{
-											material->UploadUniforms();
-
-											for( auto& renderable : queue.renderable_list )
-											{
-												if( renderable->is_enabled && renderable->material == material )
-												{
-													renderable->mesh->Bind();
-
-													if( renderable->HasWorldTransform() )
-														material->SetAndUploadUniform( "uniform_transform_world", *renderable->WorldMatrix() );
-
-													DrawMesh( *renderable->mesh );
-												}
-											}
-										}
-									}
-								}
-							}
-							break;
-						}
+						BuildDrawPacketList( queue, pass_id, effective_render_state, frustum, camera_position );
+						RenderDrawPacketList( queue.draw_packet_list );
 					}
 				}
 			}
@@ -258,13 +298,15 @@ namespace Kakadu
 		else
 			Blit( MainFramebuffer(), PostProcessingFramebuffer() );
 
-		KAKADU_GL_DEBUG_GROUP( "[Post-Processing] " );
+		{
+			RENDERER_SCOPE( "[Post-Processing] " );
 
-		for( auto& [ post_fx_name, post_fx ] : post_processing_effect_map )
-			if( post_fx->is_enabled )
-				RenderFullscreenEffect( *post_fx );
+			for( auto& [ post_fx_name, post_fx ] : post_processing_effect_map )
+				if( post_fx->is_enabled )
+					RenderFullscreenEffect( *post_fx );
 
-		RenderFullscreenEffect( tone_mapping );
+			RenderFullscreenEffect( tone_mapping );
+		}
 	}
 
 	void Renderer::DrawMesh( const Mesh& mesh ) const
@@ -285,32 +327,18 @@ namespace Kakadu
 
 	void Renderer::OnFramebufferResize( const i32 new_width_in_pixels, const i32 new_height_in_pixels )
 	{
+		using namespace Literals;
+
 		glViewport( 0, 0, new_width_in_pixels, new_height_in_pixels );
 
 		if( shaders_need_uniform_buffer_other )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_VIEWPORT_SIZE", Vector2( ( float )new_width_in_pixels, ( float )new_height_in_pixels ) );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_VIEWPORT_SIZE"_id, Vector2( ( float )new_width_in_pixels, ( float )new_height_in_pixels ) );
 		}
 
 		DefaultFramebuffer() = RHI::Framebuffer( RHI::Framebuffer::DEFAULT_FRAMEBUFFER_CONSTRUCTOR );
 
-		/* Shadow maps: */
-		ShadowMappingFramebuffer_DirectionalLight() = RHI::Framebuffer( RHI::Framebuffer::Description
-																		{
-																			.name = "Shadow Map [Dir. Light]",
-
-																			.width_in_pixels  = new_width_in_pixels,
-																			.height_in_pixels = new_height_in_pixels,
-
-																			.minification_filter  = RHI::TextureFiltering::Nearest,
-																			.magnification_filter = RHI::TextureFiltering::Nearest,
-
-																			/* Default wrapping = clamp to border, with border = Color4{ 0,0,0,0 }. */
-
-																			/* Default color format = RGBA. */
-
-																			.attachment_bits = RHI::Framebuffer::AttachmentType::Depth
-																		} );
+		/* Shadow maps do not depend on the viewport size; See CreateShadowMapFramebuffer(). */
 
 
 		/* Main: */
@@ -658,18 +686,28 @@ namespace Kakadu
 		skybox_material.SetTexture( "uniform_tex", skybox_texture );
 	}
 
-	const void* Renderer::GetShaderGlobal( const std::string& buffer_name ) const
+	void Renderer::SetShadowMappingSettings( const CascadedShadowMapSettings& new_settings )
 	{
-		return uniform_buffer_management_global.Get( buffer_name );
+		shadow_mapping_settings = new_settings;
 	}
 
-	void* Renderer::GetShaderGlobal( const std::string& buffer_name )
+	const void* Renderer::GetShaderGlobal( const StringID buffer_id ) const
 	{
-		return uniform_buffer_management_global.Get( buffer_name );
+		return uniform_buffer_management_global.Get( buffer_id );
+	}
+
+	void* Renderer::GetShaderGlobal( const StringID buffer_id )
+	{
+		return uniform_buffer_management_global.Get( buffer_id );
 	}
 
 	void Renderer::RegisterShader( RHI::Shader& shader )
 	{
+		using namespace Literals;
+
+		/* Built-in shaders are compiled on first use, so the lighting buffer can be created at any point; It needs its defaults only when it is (re)created. */
+		const bool uniform_buffer_lighting_is_new = not uniform_buffer_management_intrinsic.HasBuffer( "_Intrinsic_Lighting"_id );
+
 		if( shader.HasUniformBlocks() )
 		{
 			/* Regular Uniform Buffers are handled by the Material class.
@@ -696,6 +734,12 @@ namespace Kakadu
 		{
 			shaders_using_intrinsics_lighting.insert( &shader );
 			shaders_need_uniform_buffer_lighting = true;
+
+			if( uniform_buffer_lighting_is_new )
+			{
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_SHADOW_BIAS_MIN_MAX_2_RESERVED"_id, Vector4( 1.0f, 4.0f, 0.0f, 0.0f ) ); // In texels.
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_SHADOW_SAMPLE_COUNT_X_Y"_id,		Vector2I( 3, 3 ) );
+			}
 		}
 
 		if( shader.GetUniformBufferInfoMap_Intrinsic().contains( "_Intrinsic_Other" ) )
@@ -705,7 +749,10 @@ namespace Kakadu
 		}
 
 		if( ++shaders_registered_reference_count_map[ &shader ] == 1 )
+		{
 			shaders_registered.insert( &shader );
+			shader_source_watcher.Add( shader );
+		}
 	}
 
 	void Renderer::UnregisterShader( RHI::Shader& shader )
@@ -764,41 +811,79 @@ namespace Kakadu
 
 		shaders_registered.erase( &shader );
 		shaders_registered_reference_count_map.erase( &shader );
+		shader_source_watcher.Remove( shader );
 	}
 	
 	void Renderer::RecompileModifiedShaders()
 	{
-		std::vector< RHI::Shader* > shaders_to_recompile;
+		/* Source files are watched from the first call on, i.e., only when hot-reloading is enabled. */
+		shader_source_watcher.Enable();
+
+		/* A batch is in flight: Swap in whatever finished; The old programs stay in use until then. */
+		if( shader_recompiler )
+		{
+			for( auto recompiled_shader : shader_recompiler->FinishCompleted() )
+				ReplaceWithRecompiledShader( *shader_to_replace_per_recompiled_shader[ recompiled_shader ], *recompiled_shader );
+
+			if( shader_recompiler->HasPending() )
+				return;
 
-		/* Can not traverse registered shaders AND remove/add shaders to be recompiled at the same time. */
+			shader_recompiler.reset();
+			shaders_recompiled.clear();
+			shader_to_replace_per_recompiled_shader.clear();
+		}
 
-		for( const auto& shader : shaders_registered )
-			if( shader->SourceFilesAreModified() )
-				shaders_to_recompile.push_back( shader );
+		const auto shaders_to_recompile = shader_source_watcher.ConsumeAffectedShaders();
 
-		for( auto& shader : shaders_to_recompile )
-		{
-			RHI::Shader new_shader( shader->name.c_str() );
-			if( shader->RecompileFromThis( new_shader ) )
-			{
-				UnregisterShader( *shader );
+		if( shaders_to_recompile.empty() )
+			return;
 
-				*shader = std::move( new_shader );
+		/* Last write times already guard the memoized #include files, but files may be replaced in ways that keep them (e.g., checkouts restoring timestamps). */
+		RHI::ShaderIncludePreprocessing::InvalidateCache();
 
-				RegisterShader( *shader );
+		/* Recompile all affected shaders in one batch (e.g., a modified include file can affect many of them); std::deque keeps the new shaders' addresses stable while compiling. */
+		shader_recompiler = std::make_unique< RHI::ShaderCompiler >();
+
+		for( auto shader : shaders_to_recompile )
+		{
+			auto& new_shader = shaders_recompiled.emplace_back( shader->name.c_str() );
 
-				for( auto& [ queue_ID, queue ] : render_queue_map )
-					for( auto& [ material_name, material ] : queue.materials_in_flight )
-						if( material->shader == shader )
-							material->OnShaderHotReload();
+			shader_recompiler->Submit( new_shader,
+									   RHI::VertexShaderSourcePath( shader->vertex_source_path ),
+									   RHI::GeometryShaderSourcePath( shader->geometry_source_path ),
+									   RHI::FragmentShaderSourcePath( shader->fragment_source_path ),
+									   shader->features_requested );
 
-				Log::Success( "Recompiled modified shader: \"" + shader->name + "\"" );
-			}
+			/* Failed preprocessing or served from the program binary cache; Either way, there is nothing to wait for. */
+			if( not new_shader.pending_compilation )
+				ReplaceWithRecompiledShader( *shader, new_shader );
 			else
-				Log::Error( "Failed to recompile modified shader: \"" + shader->name + "\"" );
+				shader_to_replace_per_recompiled_shader[ &new_shader ] = shader;
 		}
 	}
 
+	void Renderer::ReplaceWithRecompiledShader( RHI::Shader& shader, RHI::Shader& recompiled_shader )
+	{
+		if( not recompiled_shader.IsValid() )
+		{
+			Log::Error( "Failed to recompile modified shader: \"" + shader.name + "\"" );
+			return;
+		}
+
+		UnregisterShader( shader );
+
+		shader = std::move( recompiled_shader );
+
+		RegisterShader( shader );
+
+		for( auto& [ queue_ID, queue ] : render_queue_map )
+			for( auto& [ material_name, material ] : queue.materials_in_flight )
+				if( material->shader == &shader )
+					material->OnShaderHotReload();
+
+		Log::Success( "Recompiled modified shader: \"" + shader.name + "\"" );
+	}
+
 	void Renderer::ResetToDefaultFramebuffer()
 	{
 		framebuffer_current_destination = &DefaultFramebuffer();
@@ -887,11 +972,18 @@ namespace Kakadu
 
 	Renderer::BloomAntiFlickerSetting Renderer::GetBloomAntiFlickerSetting() const
 	{
-		const std::string bloom_downsample_shader_name = bloom_downsampling.material.GetShader()->name;
+		/* Variant names are generated from their Features, so query the Features directly. */
+		const auto& bloom_downsample_shader_features = bloom_downsampling.material.GetShader()->GetFeatures();
+
+		const auto FeatureIsSet = [ & ]( const char* feature_name )
+		{
+			const auto iterator = bloom_downsample_shader_features.find( feature_name );
+			return iterator != bloom_downsample_shader_features.cend() && iterator->second.is_set;
+		};
 
 		return ( BloomAntiFlickerSetting )
-			( i32( bloom_downsample_shader_name == "Post-Process Bloom Downsample (Anti Flicker Coarse)" ) +
-			  i32( bloom_downsample_shader_name == "Post-Process Bloom Downsample (Anti Flicker Fine)"   ) * 2 );
+			( i32( FeatureIsSet( "ANTI_FLICKER_COARSE" ) ) +
+			  i32( FeatureIsSet( "ANTI_FLICKER_FINE"   ) ) * 2 );
 	}
 
 	void Renderer::SetBloomAntiFlickerSetting( const BloomAntiFlickerSetting new_setting )
@@ -961,11 +1053,11 @@ namespace Kakadu
 					 .name               = "Shadow Mapping",
 					 .target_framebuffer = &ShadowMappingFramebuffer_DirectionalLight(),
 					 .queue_id_set       = { RENDER_QUEUE_ID_GEOMETRY },
-					 .view_matrix		 = Matrix4x4{},
-					 .projection_matrix  = Matrix4x4{},
+					 /* View & projection matrices are per-cascade; See CalculateShadowMappingInformation(). */
 					 .render_state       = RenderState
 					 {
-						 .sorting_mode = SortingMode::FrontToBack,
+						 .depth_clamp_enable = true, // Casters in front of a cascade still cast shadows; See ShadowCascade::culling_frustum.
+						 .sorting_mode       = SortingMode::FrontToBack,
 					 },
 					 .render_state_override_is_allowed = false,
 					 .clear_framebuffer                = true
@@ -983,12 +1075,18 @@ namespace Kakadu
 
 	void Renderer::Draw_Indexed( const Mesh& mesh ) const
 	{
-		glDrawElements( ( GLint )mesh.Primitive(), mesh.IndexCount(), GL_UNSIGNED_INT, 0 );
+		/* Base vertex & first index are zero for Meshes with their own buffers. */
+		glDrawElementsBaseVertex( ( GLint )mesh.Primitive(), mesh.IndexCount(), GL_UNSIGNED_INT,
+								  ( const void* )( ( std::size_t )mesh.FirstIndex() * sizeof( u32 ) ), mesh.BaseVertex() );
+
+		CountDrawCall( mesh.Primitive(), mesh.IndexCount(), 1, true, false );
 	}
 
 	void Renderer::Draw_NonIndexed( const Mesh& mesh ) const
 	{
 		glDrawArrays( ( GLint )mesh.Primitive(), 0, mesh.VertexCount() );
+
+		CountDrawCall( mesh.Primitive(), mesh.VertexCount(), 1, false, false );
 	}
 
 	void Renderer::DrawInstanced( const Mesh& mesh ) const
@@ -1001,16 +1099,114 @@ namespace Kakadu
 	void Renderer::DrawInstanced_Indexed( const Mesh& mesh ) const
 	{
 		glDrawElementsInstanced( ( GLint )mesh.Primitive(), mesh.IndexCount(), GL_UNSIGNED_INT, 0, mesh.InstanceCount() );
+
+		CountDrawCall( mesh.Primitive(), mesh.IndexCount(), mesh.InstanceCount(), true, true );
 	}
 
 	void Renderer::DrawInstanced_NonIndexed( const Mesh& mesh ) const
 	{
 		glDrawArraysInstanced( ( GLint )mesh.Primitive(), 0, mesh.VertexCount(), mesh.InstanceCount() );
+
+		CountDrawCall( mesh.Primitive(), mesh.VertexCount(), mesh.InstanceCount(), false, true );
+	}
+
+	void Renderer::DrawMesh_WithDrawTransforms( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const
+	{
+		ASSERT_DEBUG_ONLY( not mesh.HasInstancing() && "Instanced meshes carry their own world transforms & can not use the DrawTransformBuffer!" );
+
+		mesh.HasIndices()
+			? DrawWithDrawTransforms_Indexed( mesh, first_draw_transform_index, instance_count )
+			: DrawWithDrawTransforms_NonIndexed( mesh, first_draw_transform_index, instance_count );
+	}
+
+	void Renderer::DrawWithDrawTransforms_Indexed( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const
+	{
+		glDrawElementsInstancedBaseVertexBaseInstance( ( GLint )mesh.Primitive(), mesh.IndexCount(), GL_UNSIGNED_INT,
+													   ( const void* )( ( std::size_t )mesh.FirstIndex() * sizeof( u32 ) ), instance_count,
+													   mesh.BaseVertex(), first_draw_transform_index );
+
+		CountDrawCall( mesh.Primitive(), mesh.IndexCount(), instance_count, true, true );
+	}
+
+	void Renderer::DrawWithDrawTransforms_NonIndexed( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const
+	{
+		glDrawArraysInstancedBaseInstance( ( GLint )mesh.Primitive(), 0, mesh.VertexCount(), instance_count, first_draw_transform_index );
+
+		CountDrawCall( mesh.Primitive(), mesh.VertexCount(), instance_count, false, true );
+	}
+
+	void Renderer::DrawMesh_DynamicallyInstanced( const Mesh& mesh, const std::vector< DrawPacket >& draw_packet_list, const std::size_t range_begin, const std::size_t range_end )
+	{
+		const u32 instance_count = ( u32 )( range_end - range_begin );
+
+		u32 first_draw_transform_index;
+		auto transforms = draw_transform_buffer.Allocate( instance_count, first_draw_transform_index );
+
+		for( u32 instance_index = 0; instance_index < instance_count; instance_index++ )
+			transforms[ instance_index ] = *draw_packet_list[ range_begin + instance_index ].renderable->WorldMatrix();
+
+		DrawMesh_WithDrawTransforms( mesh, first_draw_transform_index, instance_count );
+	}
+
+	void Renderer::DrawMeshes_MultiDrawIndirect( const std::vector< DrawPacket >& draw_packet_list, const std::size_t range_begin, const std::size_t range_end )
+	{
+		const u32 draw_count = ( u32 )( range_end - range_begin );
+
+		/* Consecutive packets of the same Mesh collapse into a single command with multiple instances. */
+		u32 command_count = 1;
+		for( std::size_t packet_index = range_begin + 1; packet_index < range_end; packet_index++ )
+			if( draw_packet_list[ packet_index ].renderable->mesh != draw_packet_list[ packet_index - 1 ].renderable->mesh )
+				command_count++;
+
+		u32 first_draw_transform_index;
+		auto transforms = draw_transform_buffer.Allocate( draw_count, first_draw_transform_index );
+
+		std::size_t indirect_offset;
+		auto commands = draw_command_buffer.Allocate( command_count, indirect_offset );
+
+		const Mesh* previous_mesh = nullptr;
+		u32 command_index         = 0;
+		u64 primitive_count       = 0;
+
+		for( u32 draw_index = 0; draw_index < draw_count; draw_index++ )
+		{
+			auto& renderable = *draw_packet_list[ range_begin + draw_index ].renderable;
+
+			transforms[ draw_index ] = *renderable.WorldMatrix();
+
+			primitive_count += RHI::PrimitiveCount( renderable.mesh->Primitive(), ( u32 )renderable.mesh->IndexCount() );
+
+			if( renderable.mesh == previous_mesh )
+			{
+				commands[ command_index - 1 ].instance_count++;
+				continue;
+			}
+
+			previous_mesh = renderable.mesh;
+
+			commands[ command_index++ ] = DrawElementsIndirectCommand
+			{
+				.index_count    = ( u32 )previous_mesh->IndexCount(),
+				.instance_count = 1,
+				.first_index    = previous_mesh->FirstIndex(),
+				.base_vertex    = previous_mesh->BaseVertex(),
+				.base_instance  = first_draw_transform_index + draw_index
+			};
+		}
+
+		glMultiDrawElementsIndirect( ( GLenum )previous_mesh->Primitive(), GL_UNSIGNED_INT, reinterpret_cast< const void* >( indirect_offset ), command_count, 0 );
+
+		auto& counters = RHI::RunningCounters();
+		counters.draw_calls++;
+		counters.draw_calls_indexed++;
+		counters.draw_calls_instanced++;
+		counters.primitives += primitive_count;
+		counters.instances  += draw_count;
 	}
 
 	void Renderer::RenderFullscreenEffect( FullscreenEffect& effect )
 	{
-		KAKADU_GL_DEBUG_GROUP( "[FULLSCREEN-FX-EMOJI] " + effect.name );
+		RENDERER_SCOPE( "[FULLSCREEN-FX-EMOJI] " + effect.name );
 
 		full_screen_quad_mesh.Bind();
 
@@ -1067,21 +1263,23 @@ namespace Kakadu
 
 	void Renderer::SetIntrinsics( const BitFlags< IntrinsicModifyTarget > targets )
 	{
+		using namespace Literals;
+
 		if( targets == IntrinsicModifyTarget::None )
 			return;
 
 		if( shaders_need_uniform_buffer_other && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_Projection ) )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_PROJECTION", current_camera_info.projection_matrix );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_TRANSFORM_PROJECTION"_id, current_camera_info.projection_matrix );
 			if( not targets.IsSet( IntrinsicModifyTarget::UniformBuffer_View ) ) // No need to upload twice.
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_PROJECTION", current_camera_info.view_projection_matrix );
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_TRANSFORM_VIEW_PROJECTION"_id, current_camera_info.view_projection_matrix );
 
 			if( Matrix::IsPerspectiveProjection( current_camera_info.projection_matrix ) ) // No need to upload these if they will not mean anything anyway.
 			{
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_NEAR",					current_camera_info.plane_near );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_FAR",					current_camera_info.plane_far );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_ASPECT_RATIO",			current_camera_info.aspect_ratio );
-				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_PROJECTION_VERTICAL_FIELD_OF_VIEW", current_camera_info.vertical_field_of_view );
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_PROJECTION_NEAR"_id,					current_camera_info.plane_near );
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_PROJECTION_FAR"_id,					current_camera_info.plane_far );
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_PROJECTION_ASPECT_RATIO"_id,			current_camera_info.aspect_ratio );
+				uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_PROJECTION_VERTICAL_FIELD_OF_VIEW"_id, current_camera_info.vertical_field_of_view );
 			}
 		}
 
@@ -1091,42 +1289,38 @@ namespace Kakadu
 
 		if( shaders_need_uniform_buffer_other && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_View ) )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW",				view_matrix );
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_ROTATION_ONLY",	view_matrix_rotation_only );
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other", "_INTRINSIC_TRANSFORM_VIEW_PROJECTION",		current_camera_info.view_projection_matrix );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_TRANSFORM_VIEW"_id,				view_matrix );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_TRANSFORM_VIEW_ROTATION_ONLY"_id,	view_matrix_rotation_only );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Other"_id, "_INTRINSIC_TRANSFORM_VIEW_PROJECTION"_id,		current_camera_info.view_projection_matrix );
 		}
 
 		if( shaders_need_uniform_buffer_lighting && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_Lighting ) )
 		{
 			/* Lighting is always updated, regardless of dirty state. That's because I don't want to deal with it right now. */
 
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT_IS_ACTIVE", 
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_DIRECTIONAL_LIGHT_IS_ACTIVE"_id, 
 															light_directional && light_directional->is_enabled ? 1u : 0u );
 			if( light_directional && light_directional->is_enabled )
 			{
 				light_directional->data.direction_view_space = light_directional->transform->Forward() * view_matrix_3x3;
-				uniform_buffer_management_intrinsic.SetPartial_Struct( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT", light_directional->data );
+				uniform_buffer_management_intrinsic.SetPartial_Struct( "_Intrinsic_Lighting"_id, "_INTRINSIC_DIRECTIONAL_LIGHT"_id, light_directional->data );
 			}
 
-			lights_point_active_count = 0;
-			for( auto index = 0; index < lights_point.size(); index++ )
+			lights_point_active_data.clear();
+			for( auto& point_light : lights_point )
 			{
-				auto& point_light = lights_point[ index ];
-
 				if( point_light->is_enabled )
 				{
 					/* Shaders expect the lights' position & direction in view space. */
 					point_light->data.position_view_space = Vector4( point_light->transform->GetTranslation(), 1.0f ) * view_matrix;
-					uniform_buffer_management_intrinsic.SetPartial_Array( "_Intrinsic_Lighting", "_INTRINSIC_POINT_LIGHTS", lights_point_active_count++, point_light->data );
+					lights_point_active_data.push_back( point_light->data );
 				}
 			}
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_POINT_LIGHT_ACTIVE_COUNT", lights_point_active_count );
 
-			lights_spot_active_count = 0;
-			for( auto index = 0; index < lights_spot.size(); index++ )
+			lights_spot_active_data.clear();
+			Vector4 spot_light_ambient_sum;
+			for( auto& spot_light : lights_spot )
 			{
-				auto& spot_light = lights_spot[ index ];
-
 				if( spot_light->is_enabled )
 				{
 					/* Shaders expect the lights' position & direction in view space. */
@@ -1137,16 +1331,28 @@ namespace Kakadu
 					spot_light->data.direction_view_space_and_cos_cutoff_angle_outer.vector = spot_light->transform->Forward() * view_matrix_3x3;
 					spot_light->data.direction_view_space_and_cos_cutoff_angle_outer.scalar = Math::Cos( Radians( spot_light->data.cutoff_angle_outer ) );
 
-					uniform_buffer_management_intrinsic.SetPartial_Array( "_Intrinsic_Lighting", "_INTRINSIC_SPOT_LIGHTS", lights_spot_active_count++, spot_light->data );
+					lights_spot_active_data.push_back( spot_light->data );
+					spot_light_ambient_sum += spot_light->data.ambient; // Only .rgb is used.
 				}
 			}
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_SPOT_LIGHT_ACTIVE_COUNT", lights_spot_active_count );
+
+			/* Bin the lights into clusters of the current view volume; Shaders only evaluate the lights of the cluster a fragment falls into. */
+			light_cluster_grid.Build( current_camera_info.projection_matrix, lights_point_active_data, lights_spot_active_data );
+			light_cluster_buffer.Upload( lights_point_active_data, lights_spot_active_data, light_cluster_grid );
+
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_POINT_LIGHT_ACTIVE_COUNT"_id, ( u32 )lights_point_active_data.size() );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_SPOT_LIGHT_ACTIVE_COUNT"_id,  ( u32 )lights_spot_active_data.size() );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_SPOT_LIGHT_AMBIENT_SUM"_id,   spot_light_ambient_sum );
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_LIGHT_CLUSTER_DEPTH_SCALE_BIAS_IS_LOGARITHMIC_RESERVED"_id,
+															light_cluster_grid.DepthSlicing() );
 		}
 
 		if( shaders_need_uniform_buffer_lighting && targets.IsSet( IntrinsicModifyTarget::UniformBuffer_Lighting_ShadowMapping ) )
 		{
-			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting", "_INTRINSIC_DIRECTIONAL_LIGHT_VIEW_PROJECTION_TRANSFORM", 
-															light_directional_view_projection_transform_matrix );
+			for( u32 cascade_index = 0; cascade_index < shadow_cascade_active_count; cascade_index++ )
+				uniform_buffer_management_intrinsic.SetPartial_Array( "_Intrinsic_Lighting"_id, "_INTRINSIC_SHADOW_CASCADES"_id, cascade_index, shadow_cascades[ cascade_index ].data );
+
+			uniform_buffer_management_intrinsic.SetPartial( "_Intrinsic_Lighting"_id, "_INTRINSIC_SHADOW_CASCADE_COUNT"_id, shadow_cascade_active_count );
 		}
 	}
 
@@ -1160,40 +1366,273 @@ namespace Kakadu
 		uniform_buffer_management_global.UploadAll();
 	}
 
-	void Renderer::CalculateShadowMappingInformation()
+	void Renderer::CreateShadowMapFramebuffer()
 	{
-		if( light_directional == nullptr )
-			return;
+		shadow_mapping_settings.cascade_count        = Math::Clamp( shadow_mapping_settings.cascade_count, 1u, CascadedShadowMapSettings::CASCADE_MAX_COUNT );
+		shadow_mapping_settings.resolution_in_pixels = Math::ClampMin( shadow_mapping_settings.resolution_in_pixels, 1 );
+
+		ShadowMappingFramebuffer_DirectionalLight() = RHI::Framebuffer( RHI::Framebuffer::Description
+																		{
+																			.name = "Shadow Map [Dir. Light]",
 
-		Transform light_transform_copy( *light_directional->transform );
+																			.width_in_pixels  = shadow_mapping_settings.resolution_in_pixels,
+																			.height_in_pixels = shadow_mapping_settings.resolution_in_pixels,
 
-		const auto view_matrix = light_transform_copy.GetInverseOfFinalMatrix_NoScale();
+																			.minification_filter  = RHI::TextureFiltering::Nearest,
+																			.magnification_filter = RHI::TextureFiltering::Nearest,
 
-		// TODO: AABBs.
-		// TODO: Render the projection volume as a wireframe cube. More generally, create a debug-render pass, with wire-frame rendering.
-		// Use ortho. projection for directional light. For now, use big values for the projection volume:
-		const auto projection_matrix = Matrix::OrthographicProjection( shadow_mapping_projection_parameters );
+																			/* Default wrapping = clamp to border, with border = Color4{ 0,0,0,0 }. */
 
-		auto& shadow_mapping_pass = render_pass_map[ RENDER_PASS_ID_SHADOW_MAPPING ];
-		
-		bool recalculate_view_projection_matrix = false;
+																			/* Default color format = RGBA. */
 
-		if( shadow_mapping_pass.view_matrix != view_matrix )
-		{
-			shadow_mapping_pass.view_matrix = view_matrix;
-			recalculate_view_projection_matrix = true;
-		}
+																			.attachment_bits = RHI::Framebuffer::AttachmentType::Depth,
 
-		if( shadow_mapping_pass.projection_matrix != projection_matrix )
+																			.array_layer_count = ( i32 )shadow_mapping_settings.cascade_count /* One layer per cascade. */
+																		} );
+
+		/* Same layout as the shadow map, as its layers are copied over every frame. */
+		ShadowMappingCacheFramebuffer_DirectionalLight() = shadow_mapping_settings.cache_static_casters
+			? RHI::Framebuffer( RHI::Framebuffer::Description
+								{
+									.name = "Shadow Map Cache [Dir. Light]",
+
+									.width_in_pixels  = shadow_mapping_settings.resolution_in_pixels,
+									.height_in_pixels = shadow_mapping_settings.resolution_in_pixels,
+
+									.minification_filter  = RHI::TextureFiltering::Nearest,
+									.magnification_filter = RHI::TextureFiltering::Nearest,
+
+									.attachment_bits = RHI::Framebuffer::AttachmentType::Depth,
+
+									.array_layer_count = ( i32 )shadow_mapping_settings.cascade_count
+								} )
+			: RHI::Framebuffer();
+
+		for( auto& cascade : shadow_cascades )
+			cascade.static_cache_is_valid = false;
+
+		shadow_mapping_settings_in_use = shadow_mapping_settings;
+	}
+
+	void Renderer::CalculateShadowMappingInformation()
+	{
+		const u32 shadow_cascade_previous_active_count = shadow_cascade_active_count;
+
+		shadow_cascade_active_count = 0;
+
+		const auto& lighting_pass = render_pass_map[ RENDER_PASS_ID_LIGHTING ];
+
+		if( light_directional && light_directional->is_enabled && lighting_pass.view_matrix && lighting_pass.projection_matrix )
 		{
-			shadow_mapping_pass.projection_matrix = projection_matrix;
-			recalculate_view_projection_matrix = true;
+			const auto& camera_view_matrix       = *lighting_pass.view_matrix;
+			const auto& camera_projection_matrix = *lighting_pass.projection_matrix;
+			const auto& p                        = camera_projection_matrix.data;
+
+			/* Recover the plane offsets from the depth terms of the projection matrix (see Matrix::PerspectiveProjection() & Matrix::OrthographicProjection()). */
+			const bool camera_is_perspective = Matrix::IsPerspectiveProjection( camera_projection_matrix );
+			const float camera_near          = camera_is_perspective ? p[ 3 ][ 2 ] / ( -1.0f - p[ 2 ][ 2 ] ) : ( -1.0f - p[ 3 ][ 2 ] ) / p[ 2 ][ 2 ];
+			const float camera_far           = camera_is_perspective ? p[ 3 ][ 2 ] / ( +1.0f - p[ 2 ][ 2 ] ) : ( +1.0f - p[ 3 ][ 2 ] ) / p[ 2 ][ 2 ];
+			const float shadow_distance      = Math::Min( shadow_mapping_settings.max_distance, camera_far );
+
+			/* Distance from the view axis to the corners of the view volume (at unit depth for perspective projections). */
+			const float corner_radial_distance = Math::Sqrt( 1.0f / ( p[ 0 ][ 0 ] * p[ 0 ][ 0 ] ) + 1.0f / ( p[ 1 ][ 1 ] * p[ 1 ][ 1 ] ) );
+
+			if( shadow_distance > camera_near )
+			{
+				const u32 cascade_count = shadow_mapping_settings_in_use.cascade_count;
+
+				Transform light_transform_copy( *light_directional->transform );
+
+				/* Cascades are fitted in the light's view space without its translation; It does not matter for directional lights. */
+				const Matrix4x4 light_view_matrix_rotation_only( light_transform_copy.GetInverseOfFinalMatrix_NoScale().SubMatrix< 3 >() );
+				const Matrix4x4 camera_view_matrix_inverse( camera_view_matrix.InvertedAffine() );
+
+				/* Bounds of the shadow casters, to extend the cascades' culling frusta towards casters between the light & the cascades.
+				 * Also keep track of the static casters, so that their cached shadows can be invalidated when they change. */
+				u64 static_caster_signature = Hash::FNV1A_OFFSET_BASIS;
+				const auto AddToStaticCasterSignature = [ &static_caster_signature ]( const u64 value )
+				{
+					static_caster_signature = Hash::FNV1a( std::as_bytes( std::span( &value, 1 ) ), static_caster_signature );
+				};
+
+				shadow_caster_bounds_light_space.clear();
+				for( auto& queue_id : render_pass_map[ RENDER_PASS_ID_SHADOW_MAPPING ].queue_id_set )
+				{
+					for( auto& renderable : render_queue_map[ queue_id ].renderable_list )
+					{
+						if( not renderable->is_enabled || not renderable->is_casting_shadows )
+							continue;
+
+						if( renderable->is_static )
+						{
+							AddToStaticCasterSignature( reinterpret_cast< std::uintptr_t >( renderable ) );
+							AddToStaticCasterSignature( reinterpret_cast< std::uintptr_t >( renderable->mesh ) );
+							AddToStaticCasterSignature( renderable->WorldMatrixVersion() );
+						}
+
+						if( const auto world_bounds = renderable->WorldBounds();
+							not world_bounds.IsEmpty() && not world_bounds.IsInfinite() )
+							shadow_caster_bounds_light_space.push_back( world_bounds.Transformed( light_view_matrix_rotation_only ) );
+					}
+				}
+
+				if( static_caster_signature != shadow_static_caster_signature )
+				{
+					shadow_static_caster_signature = static_caster_signature;
+					for( auto& cascade : shadow_cascades )
+						cascade.static_cache_is_valid = false;
+				}
+
+				const float resolution = ( float )shadow_mapping_settings_in_use.resolution_in_pixels;
+
+				/* Practical split scheme: Blend between uniform & logarithmic splits (logarithmic ones are not possible without a positive near plane). */
+				const auto SplitDepth = [ & ]( const u32 split_index )
+				{
+					const float t           = ( float )split_index / cascade_count;
+					const float uniform     = Math::Lerp( camera_near, shadow_distance, t );
+					const float logarithmic = camera_near > 0.0f ? camera_near * Math::Pow( shadow_distance / camera_near, t ) : uniform;
+
+					return Math::Lerp( uniform, logarithmic, shadow_mapping_settings.split_lambda );
+				};
+
+				for( u32 cascade_index = 0; cascade_index < cascade_count; cascade_index++ )
+				{
+					const float split_near = cascade_index == 0				  ? camera_near		: SplitDepth( cascade_index );
+					const float split_far  = cascade_index == cascade_count - 1 ? shadow_distance : SplitDepth( cascade_index + 1 );
+
+					/* Bounding sphere of the view volume slice, centered on the view axis: Its radius only depends on the split depths & the projection,
+					 * so the cascade does not change size (& thus the shadows do not shimmer) as the camera rotates or moves. */
+					const float slice_near_radial = camera_is_perspective ? split_near * corner_radial_distance : corner_radial_distance;
+					const float slice_far_radial  = camera_is_perspective ? split_far  * corner_radial_distance : corner_radial_distance;
+
+					const float center_depth = Math::Clamp( ( slice_far_radial * slice_far_radial - slice_near_radial * slice_near_radial + split_far * split_far - split_near * split_near ) /
+															( 2.0f * ( split_far - split_near ) ),
+															split_near, split_far );
+					const float radius       = Math::Sqrt( Math::Max( slice_near_radial * slice_near_radial + ( center_depth - split_near ) * ( center_depth - split_near ),
+																	  slice_far_radial  * slice_far_radial  + ( split_far - center_depth ) * ( split_far - center_depth ) ) );
+
+					const Vector4 center_light_space( Vector4( 0.0f, 0.0f, center_depth, 1.0f ) * camera_view_matrix_inverse * light_view_matrix_rotation_only );
+
+					/* Move the cascade in whole texel increments only, so that the same world positions keep mapping to the same texels. */
+					const float texel_size = 2.0f * radius / resolution;
+					const float center_x   = Math::Round( center_light_space.X() / texel_size ) * texel_size;
+					const float center_y   = Math::Round( center_light_space.Y() / texel_size ) * texel_size;
+
+					const float plane_near = center_light_space.Z() - radius;
+					const float plane_far  = center_light_space.Z() + radius;
+
+					float culling_plane_near = plane_near;
+					for( const auto& caster_bounds : shadow_caster_bounds_light_space )
+					{
+						if( caster_bounds.min.Z() < culling_plane_near &&
+							caster_bounds.max.X() >= center_x - radius && caster_bounds.min.X() <= center_x + radius &&
+							caster_bounds.max.Y() >= center_y - radius && caster_bounds.min.Y() <= center_y + radius )
+							culling_plane_near = caster_bounds.min.Z();
+					}
+
+					auto& cascade = shadow_cascades[ cascade_index ];
+
+					cascade.view_matrix       = light_view_matrix_rotation_only * Matrix::Translation( -center_x, -center_y, 0.0f );
+					cascade.projection_matrix = Matrix::OrthographicProjection( -radius, +radius, -radius, +radius, plane_near, plane_far );
+
+					/* The cascade only moves in whole texels (or when the light rotates), so cached static casters stay valid while the camera moves within a texel. */
+					if( const Matrix4x4 view_projection_matrix = cascade.view_matrix * cascade.projection_matrix;
+						view_projection_matrix != cascade.data.view_projection_transform )
+					{
+						cascade.data.view_projection_transform = view_projection_matrix;
+						cascade.static_cache_is_valid          = false;
+					}
+
+					cascade.data.far_depth_view_space_texel_depth_2_reserved = Vector4( split_far, texel_size / ( plane_far - plane_near ), 0.0f, 0.0f );
+
+					cascade.culling_frustum = Math::Frustum( cascade.view_matrix *
+															 Matrix::OrthographicProjection( -radius, +radius, -radius, +radius, culling_plane_near, plane_far ) );
+				}
+
+				shadow_cascade_active_count = cascade_count;
+			}
 		}
 
-		if( recalculate_view_projection_matrix )
-		{
-			light_directional_view_projection_transform_matrix = view_matrix * projection_matrix;
+		if( shadow_cascade_active_count != 0 || shadow_cascade_previous_active_count != 0 )
 			SetIntrinsics( IntrinsicModifyTarget::UniformBuffer_Lighting_ShadowMapping );
+	}
+
+	void Renderer::RenderShadowMappingPass( const RenderPass& pass )
+	{
+		const bool cache_static_casters = shadow_mapping_settings_in_use.cache_static_casters;
+
+		RHI::Framebuffer& cache_framebuffer = ShadowMappingCacheFramebuffer_DirectionalLight();
+
+		for( u32 cascade_index = 0; cascade_index < shadow_cascade_active_count; cascade_index++ )
+		{
+			RENDERER_SCOPE( "Cascade " + std::to_string( cascade_index ) );
+
+			auto& cascade = shadow_cascades[ cascade_index ];
+
+			current_camera_info.view_matrix            = cascade.view_matrix;
+			current_camera_info.projection_matrix      = cascade.projection_matrix;
+			current_camera_info.view_projection_matrix = cascade.data.view_projection_transform;
+
+			/* Lighting intrinsics are of no use to the shadow-map write shaders, so the light clusters are not rebuilt for the cascades. */
+			SetIntrinsics( BitFlags< IntrinsicModifyTarget >( IntrinsicModifyTarget::UniformBuffer_View, IntrinsicModifyTarget::UniformBuffer_Projection ) );
+
+			UploadIntrinsics();
+			UploadGlobals();
+
+			const Vector3 camera_position( Matrix::CameraWorldPositionFromViewMatrix( cascade.view_matrix ) );
+
+			const auto RenderShadowCasters = [ & ]( const ShadowCasterSelection shadow_caster_selection )
+			{
+				for( auto& queue_id : pass.queue_id_set )
+				{
+					if( auto& queue = render_queue_map[ queue_id ];
+						QueueHasContentToRender( queue ) )
+					{
+						RENDERER_SCOPE( GL_LABEL_PREFIX_RENDER_QUEUE + queue.name );
+
+						/* Queue render state overrides are not allowed for this pass. */
+						BuildDrawPacketList( queue, RENDER_PASS_ID_SHADOW_MAPPING, pass.render_state, cascade.culling_frustum, camera_position, shadow_caster_selection );
+						RenderShadowCasterDrawPacketList( queue.draw_packet_list );
+					}
+				}
+			};
+
+			/* Only the cascade's layer is attached, so clearing does not touch the other cascades. */
+
+			if( cache_static_casters && not cascade.static_cache_is_valid )
+			{
+				RENDERER_SCOPE( "Static Casters (Cache Update)" );
+
+				SetRenderState( pass.render_state, &cache_framebuffer );
+
+				cache_framebuffer.AttachLayer( ( i32 )cascade_index );
+				cache_framebuffer.Clear();
+
+				RenderShadowCasters( ShadowCasterSelection::StaticOnly );
+
+				cascade.static_cache_is_valid = true;
+			}
+
+			SetRenderState( pass.render_state, pass.target_framebuffer );
+
+			pass.target_framebuffer->AttachLayer( ( i32 )cascade_index );
+
+			if( cache_static_casters )
+			{
+				/* Start from the cached static casters' depths & only render the dynamic casters on top. */
+				glCopyImageSubData( cache_framebuffer.depth_attachment.Id().id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, ( GLint )cascade_index,
+									pass.target_framebuffer->depth_attachment.Id().id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, ( GLint )cascade_index,
+									cache_framebuffer.size.X(), cache_framebuffer.size.Y(), 1 );
+
+				RenderShadowCasters( ShadowCasterSelection::DynamicOnly );
+			}
+			else
+			{
+				if( pass.clear_framebuffer )
+					pass.target_framebuffer->Clear();
+
+				RenderShadowCasters( ShadowCasterSelection::All );
+			}
 		}
 	}
 
@@ -1440,85 +1879,95 @@ namespace Kakadu
 
 	void Renderer::EnableFramebuffer_sRGBEncoding()
 	{
-		glEnable( GL_FRAMEBUFFER_SRGB );
+		RHI::StateCache::SetCapability( GL_FRAMEBUFFER_SRGB, true );
 		framebuffer_sRGB_encoding_is_enabled = true;
 	}
 
 	void Renderer::DisableFramebuffer_sRGBEncoding()
 	{
-		glDisable( GL_FRAMEBUFFER_SRGB );
+		RHI::StateCache::SetCapability( GL_FRAMEBUFFER_SRGB, false );
 		framebuffer_sRGB_encoding_is_enabled = false;
 	}
 
 	void Renderer::EnableStencilTest()
 	{
-		glEnable( GL_STENCIL_TEST );
+		RHI::StateCache::SetCapability( GL_STENCIL_TEST, true );
 	}
 
 	void Renderer::DisableStencilTest()
 	{
-		glDisable( GL_STENCIL_TEST );
+		RHI::StateCache::SetCapability( GL_STENCIL_TEST, false );
 	}
 
 	void Renderer::SetStencilWriteMask( const u32 mask )
 	{
-		glStencilMask( mask );
+		RHI::StateCache::SetStencilMask( mask );
 	}
 
 	void Renderer::SetStencilTestResponses( const RHI::StencilTestResponse stencil_fail, const RHI::StencilTestResponse stencil_pass_depth_fail, const RHI::StencilTestResponse both_pass )
 	{
-		glStencilOp( RHI::StencilTestResponseToGLEnum( stencil_fail ),
-					 RHI::StencilTestResponseToGLEnum( stencil_pass_depth_fail ),
-					 RHI::StencilTestResponseToGLEnum( both_pass ) );
+		RHI::StateCache::SetStencilOperation( RHI::StencilTestResponseToGLEnum( stencil_fail ),
+											  RHI::StencilTestResponseToGLEnum( stencil_pass_depth_fail ),
+											  RHI::StencilTestResponseToGLEnum( both_pass ) );
 	}
 
 	void Renderer::SetStencilComparisonFunction( const RHI::ComparisonFunction comparison_function, const i32 reference_value, const u32 mask )
 	{
-		glStencilFunc( RHI::ComparisonFunctionToGLEnum( comparison_function ), reference_value, mask );
+		RHI::StateCache::SetStencilFunction( RHI::ComparisonFunctionToGLEnum( comparison_function ), reference_value, mask );
 	}
 
 	void Renderer::EnableDepthTest()
 	{
-		glEnable( GL_DEPTH_TEST );
+		RHI::StateCache::SetCapability( GL_DEPTH_TEST, true );
 	}
 
 	void Renderer::DisableDepthTest()
 	{
-		glDisable( GL_DEPTH_TEST );
+		RHI::StateCache::SetCapability( GL_DEPTH_TEST, false );
+	}
+
+	void Renderer::EnableDepthClamp()
+	{
+		RHI::StateCache::SetCapability( GL_DEPTH_CLAMP, true );
+	}
+
+	void Renderer::DisableDepthClamp()
+	{
+		RHI::StateCache::SetCapability( GL_DEPTH_CLAMP, false );
 	}
 
 	void Renderer::ToggleDepthWrite( const bool enable )
 	{
-		glDepthMask( ( GLint )enable );
+		RHI::StateCache::SetDepthMask( enable );
 	}
 
 	void Renderer::SetDepthComparisonFunction( const RHI::ComparisonFunction comparison_function )
 	{
-		glDepthFunc( RHI::ComparisonFunctionToGLEnum( comparison_function ) );
+		RHI::StateCache::SetDepthFunction( RHI::ComparisonFunctionToGLEnum( comparison_function ) );
 	}
 
 	void Renderer::EnableBlending()
 	{
-		glEnable( GL_BLEND );
+		RHI::StateCache::SetCapability( GL_BLEND, true );
 	}
 
 	void Renderer::DisableBlending()
 	{
-		glDisable( GL_BLEND );
+		RHI::StateCache::SetCapability( GL_BLEND, false );
 	}
 
 	void Renderer::SetBlendingFactors( const RHI::BlendingFactor source_color_factor, const RHI::BlendingFactor destination_color_factor,
 									   const RHI::BlendingFactor source_alpha_factor, const RHI::BlendingFactor destination_alpha_factor )
 	{
-		glBlendFuncSeparate( RHI::BlendingFactorToGLEnum( source_color_factor ),
-							 RHI::BlendingFactorToGLEnum( destination_color_factor ),
-							 RHI::BlendingFactorToGLEnum( source_alpha_factor ),
-							 RHI::BlendingFactorToGLEnum( destination_alpha_factor ) );
+		RHI::StateCache::SetBlendFunctionSeparate( RHI::BlendingFactorToGLEnum( source_color_factor ),
+												   RHI::BlendingFactorToGLEnum( destination_color_factor ),
+												   RHI::BlendingFactorToGLEnum( source_alpha_factor ),
+												   RHI::BlendingFactorToGLEnum( destination_alpha_factor ) );
 	}
 
 	void Renderer::SetBlendingFunction( const RHI::BlendingFunction function )
 	{
-		glBlendEquation( RHI::BlendingFunctionToGLEnum( function ) );
+		RHI::StateCache::SetBlendEquation( RHI::BlendingFunctionToGLEnum( function ) );
 	}
 
 	void Renderer::RenderOtherViewportShadingModes()
@@ -1657,7 +2106,7 @@ namespace Kakadu
 									renderable->mesh->Bind();
 
 									if( renderable->HasWorldTransform() )
-										shader->SetUniform( "uniform_transform_world", *renderable->WorldMatrix() );
+										shader->SetUniform( uniform_handle_transform_world, *renderable->WorldMatrix() );
 
 									DrawMesh( *renderable->mesh );
 								}
@@ -1695,6 +2144,11 @@ namespace Kakadu
 
 		SetDepthComparisonFunction( render_state_to_set.depth_comparison_function );
 
+		if( render_state_to_set.depth_clamp_enable )
+			EnableDepthClamp();
+		else
+			DisableDepthClamp();
+
 		if( render_state_to_set.stencil_test_enable )
 			EnableStencilTest();
 		else
@@ -1737,6 +2191,175 @@ namespace Kakadu
 			framebuffer_current_destination->Clear();
 	}
 
+	void Renderer::BuildDrawPacketList( RenderQueue& queue, const RenderPassID pass_id, const RenderState& render_state,
+										const Math::Frustum& frustum, const Vector3& camera_position,
+										const ShadowCasterSelection shadow_caster_selection )
+	{
+		auto& draw_packet_list = queue.draw_packet_list;
+
+		draw_packet_list.clear();
+		draw_packet_list.reserve( queue.renderable_list.size() );
+
+		const SortingMode sorting_mode = render_state.sorting_mode;
+		const u32 state                = render_state.blending_enable ? 1 : 0;
+
+		const bool shadow_casters_only = pass_id == RENDER_PASS_ID_SHADOW_MAPPING;
+
+		for( auto& renderable : queue.renderable_list )
+		{
+			if( not renderable->is_enabled || ( shadow_casters_only && not renderable->is_casting_shadows ) ||
+				not frustum.Intersects( renderable->WorldBounds() ) )
+				continue;
+
+			if( shadow_casters_only &&
+				( ( shadow_caster_selection == ShadowCasterSelection::StaticOnly  && not renderable->is_static ) ||
+				  ( shadow_caster_selection == ShadowCasterSelection::DynamicOnly &&	 renderable->is_static ) ) )
+				continue;
+
+			const u16 depth = sorting_mode != SortingMode::None && renderable->HasWorldTransform()
+								? SortKey::QuantizeDepth( Math::DistanceSquared( camera_position, renderable->WorldPosition() ) )
+								: 0;
+
+			/* Shadow casters are drawn with a single built-in shader regardless of their Materials; Leaving those fields zero groups them by mesh alone, keeping runs of the same mesh adjacent. */
+			draw_packet_list.push_back( DrawPacket
+										{
+											.sort_key = SortKey::Compose( pass_id.id,
+																		  state,
+																		  shadow_casters_only ? 0 : renderable->material->shader->Id().id,
+																		  shadow_casters_only ? 0 : ( u32 )renderable->material->ParameterHash(),
+																		  renderable->mesh->VertexArrayId().id,
+																		  depth,
+																		  sorting_mode ),
+											.renderable = renderable
+										} );
+		}
+
+		/* No sorting => preserve insertion order. */
+		if( sorting_mode != SortingMode::None )
+			RadixSort( draw_packet_list, draw_packet_list_sort_scratch );
+	}
+
+	void Renderer::RenderDrawPacketList( const std::vector< DrawPacket >& draw_packet_list )
+	{
+		const RHI::Shader* current_shader   = nullptr;
+		Material*          current_material = nullptr;
+		const Mesh*        current_mesh     = nullptr;
+
+		/* Packets are sorted, so each of the state changes below happens only once per contiguous run of equal (key) fields. */
+		for( std::size_t packet_index = 0; packet_index < draw_packet_list.size(); )
+		{
+			auto& renderable = *draw_packet_list[ packet_index ].renderable;
+
+			if( renderable.material->shader != current_shader )
+			{
+				current_shader = renderable.material->shader;
+				current_shader->Bind();
+
+				current_material = nullptr; // Material uniforms need to be re-uploaded for the newly bound program.
+			}
+
+			if( renderable.material != current_material )
+			{
+				current_material = renderable.material;
+				current_material->UploadUniforms();
+			}
+
+			if( renderable.mesh != current_mesh )
+			{
+				current_mesh = renderable.mesh;
+				current_mesh->Bind();
+			}
+
+			if( renderable.HasWorldTransform() )
+			{
+				if( current_shader->UsesDrawTransformBuffer() && current_mesh->IsPooled() )
+				{
+					/* Pooled Meshes of the same GeometryPool page share the bound VAO; Submit the whole run (with an equivalent Material) as a single indirect multi-draw. */
+					const std::size_t run_end = FindMultiDrawRunEnd( draw_packet_list, packet_index, true );
+
+					DrawMeshes_MultiDrawIndirect( draw_packet_list, packet_index, run_end );
+
+					packet_index = run_end;
+					continue;
+				}
+
+				if( current_shader->UsesDrawTransformBuffer() && not current_mesh->HasInstancing() )
+				{
+					/* Packets sharing both the Mesh & an equivalent Material are adjacent after sorting; Merge them into a single instanced draw. */
+					const std::size_t run_end = FindDynamicInstancingRunEnd( draw_packet_list, packet_index, true );
+
+					DrawMesh_DynamicallyInstanced( *current_mesh, draw_packet_list, packet_index, run_end );
+
+					packet_index = run_end;
+					continue;
+				}
+
+				/* Shaders that still declare uniform_transform_world (e.g., debug/editor shaders & client shaders). */
+				current_material->SetAndUploadUniform( uniform_handle_transform_world, *renderable.WorldMatrix() );
+			}
+
+			DrawMesh( *current_mesh );
+			packet_index++;
+		}
+	}
+
+	void Renderer::RenderShadowCasterDrawPacketList( const std::vector< DrawPacket >& draw_packet_list )
+	{
+		RHI::Shader& shadow_map_write_shader           = *BuiltinShaders::Get( "Shadow-map Write" );
+		RHI::Shader& shadow_map_write_instanced_shader = *BuiltinShaders::Get( "Shadow-map Write (Instanced)" );
+
+		shadow_map_write_shader.Bind();
+
+		/* Materials are irrelevant for depth-only rendering, so only the Mesh needs to match for dynamic instancing. */
+		for( std::size_t packet_index = 0; packet_index < draw_packet_list.size(); )
+		{
+			const auto& renderable = *draw_packet_list[ packet_index ].renderable;
+
+			if( renderable.mesh->HasInstancing() )
+			{
+				packet_index++;
+				continue;
+			}
+
+			renderable.mesh->Bind();
+
+			if( renderable.HasWorldTransform() && renderable.mesh->IsPooled() )
+			{
+				const std::size_t run_end = FindMultiDrawRunEnd( draw_packet_list, packet_index, false );
+
+				DrawMeshes_MultiDrawIndirect( draw_packet_list, packet_index, run_end );
+
+				packet_index = run_end;
+			}
+			else if( renderable.HasWorldTransform() )
+			{
+				const std::size_t run_end = FindDynamicInstancingRunEnd( draw_packet_list, packet_index, false );
+
+				DrawMesh_DynamicallyInstanced( *renderable.mesh, draw_packet_list, packet_index, run_end );
+
+				packet_index = run_end;
+			}
+			else
+			{
+				DrawMesh( *renderable.mesh );
+				packet_index++;
+			}
+		}
+
+		shadow_map_write_instanced_shader.Bind();
+
+		for( const auto& draw_packet : draw_packet_list )
+		{
+			if( const auto& renderable = *draw_packet.renderable;
+				renderable.mesh->HasInstancing() )
+			{
+				renderable.mesh->Bind();
+
+				DrawMesh( *renderable.mesh );
+			}
+		}
+	}
+
 	void Renderer::SortRenderablesInQueue( const Vector3& camera_position, std::vector< Renderable* >& renderable_array_to_sort, const SortingMode sorting_mode )
 	{
 		switch( sorting_mode )
@@ -1773,22 +2396,22 @@ namespace Kakadu
 
 	void Renderer::EnableFaceCulling()
 	{
-		glEnable( GL_CULL_FACE );
+		RHI::StateCache::SetCapability( GL_CULL_FACE, true );
 	}
 
 	void Renderer::DisableFaceCulling()
 	{
-		glDisable( GL_CULL_FACE );
+		RHI::StateCache::SetCapability( GL_CULL_FACE, false );
 	}
 
 	void Renderer::SetCullFace( const RHI::Face face )
 	{
-		glCullFace( RHI::FaceToGLEnum( face ) );
+		RHI::StateCache::SetCullFace( RHI::FaceToGLEnum( face ) );
 	}
 
 	void Renderer::SetFrontFaceConvention( const RHI::WindingOrder winding_order_of_front_faces )
 	{
-		glFrontFace( RHI::WindingOrderToGLEnum( winding_order_of_front_faces ) );
+		RHI::StateCache::SetFrontFace( RHI::WindingOrderToGLEnum( winding_order_of_front_faces ) );
 	}
 	
 	void Renderer::DetermineMSAASampleCountsPerFormat()
@@ -1834,10 +2457,10 @@ namespace Kakadu
 		introspection_surface->post_processing_effect_map = &post_processing_effect_map;
 		introspection_surface->tone_mapping               = &tone_mapping;
 
-		introspection_surface->shadow_mapping_projection_parameters = &shadow_mapping_projection_parameters;
-
 		introspection_surface->skybox_material = &skybox_material;
 
+		introspection_surface->gpu_profiler = &gpu_profiler;
+
 		introspection_surface->uniform_buffer_management_global    = &uniform_buffer_management_global;
 		introspection_surface->uniform_buffer_management_intrinsic = &uniform_buffer_management_intrinsic;
 	}
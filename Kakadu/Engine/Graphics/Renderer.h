@@ -5,26 +5,37 @@
  * Do not introduce new Render* or Draw* functions without following that document. */
 
 // Engine Includes.
+#include "DrawCommandBuffer.h"
+#include "DrawTransformBuffer.h"
+#include "FrameStatistics.h"
 #include "FullscreenEffect.h"
+#include "LightClusterBuffer.h"
 #include "Renderable.h"
 #include "RenderPass.h"
+#include "ShaderSourceWatcher.h"
 #include "ViewportShadingMode.h"
 #include "Core/BitFlags.hpp"
 #include "Core/DirtyBlob.h"
 #include "Introspection/RendererIntrospectionSurface.h"
+#include "Lighting/CascadedShadowMapSettings.h"
 #include "Lighting/DirectionalLight.h"
+#include "Lighting/LightClusterGrid.h"
 #include "Lighting/PointLight.h"
 #include "Lighting/SpotLight.h"
-#include "Math/OrthographicProjectionParameters.h"
+#include "Math/Frustum.h"
 #include "Math/Percentage.hpp"
 #include "RHI/Framebuffer.h"
 #include "RHI/DeviceInfo.h"
+#include "RHI/GPUProfiler.h"
 #include "RHI/PolygonMode.h"
+#include "RHI/ShaderCompiler.h"
 #include "Scene/Camera.h"
 #include "UniformBufferManagement.hpp"
 
 // std Includes.
+#include <deque>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -148,38 +159,59 @@ namespace Kakadu
 
 		const RHI::Texture* ShadowMapTexture() const { return &( framebuffers[ BuiltinFramebufferIndex::ShadowMapping_DirectionalLight ].depth_attachment ); }
 
+		const CascadedShadowMapSettings& GetShadowMappingSettings() const { return shadow_mapping_settings; }
+		/* The shadow map is recreated on the next Update() if its resolution or cascade count changes. */
+		void SetShadowMappingSettings( const CascadedShadowMapSettings& new_settings );
+
+		/*
+		 * GPU Profiling:
+		 */
+
+			  RHI::GPUProfiler& GetGPUProfiler()		{ return gpu_profiler; }
+		const RHI::GPUProfiler& GetGPUProfiler() const	{ return gpu_profiler; }
+
+		/*
+		 * Frame Statistics:
+		 */
+
+		/* Draws, bindings & uploads of the last completed frame, per pass & queue. */
+		const FrameStatistics& LastFrameStatistics() const { return frame_statistics_recorder.LastFrameStatistics(); }
+
+			  FrameStatisticsRecorder& GetFrameStatisticsRecorder()		  { return frame_statistics_recorder; }
+		const FrameStatisticsRecorder& GetFrameStatisticsRecorder() const { return frame_statistics_recorder; }
+
 		/*
 		 * Shaders:
 		 */
 
-		const void* GetShaderGlobal( const std::string& buffer_name ) const;
-			  void* GetShaderGlobal( const std::string& buffer_name );
+		const void* GetShaderGlobal( const StringID buffer_id ) const;
+			  void* GetShaderGlobal( const StringID buffer_id );
 
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-			void SetShaderGlobal( const std::string& buffer_name, const StructType& value )
+			void SetShaderGlobal( const StringID buffer_id, const StructType& value )
 		{
-			uniform_buffer_management_global.Set( buffer_name, value );
+			uniform_buffer_management_global.Set( buffer_id, value );
 		}
 
 		/* For PARTIAL setting of ARRAY uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-			void SetShaderGlobal( const std::string& buffer_name, const char* uniform_member_array_instance_name, const u32 array_index, const StructType& value )
+			void SetShaderGlobal( const StringID buffer_id, const StringID uniform_member_array_instance_id, const u32 array_index, const StructType& value )
 		{
-			uniform_buffer_management_global.SetPartial_Array( buffer_name, uniform_member_array_instance_name, array_index, value );
+			uniform_buffer_management_global.SetPartial_Array( buffer_id, uniform_member_array_instance_id, array_index, value );
 		}
 
 		/* For PARTIAL setting of STRUCT uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void SetShaderGlobal( const std::string& buffer_name, const char* uniform_member_struct_instance_name, const StructType& value )
+		void SetShaderGlobal( const StringID buffer_id, const StringID uniform_member_struct_instance_id, const StructType& value )
 		{
-			uniform_buffer_management_global.SetPartial_Struct( buffer_name, uniform_member_struct_instance_name, value );
+			uniform_buffer_management_global.SetPartial_Struct( buffer_id, uniform_member_struct_instance_id, value );
 		}
 		
 		/* For PARTIAL setting of NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
 		template< typename UniformType >
-		void SetShaderGlobal( const std::string& buffer_name, const char* uniform_member_name, const UniformType& value )
+		void SetShaderGlobal( const StringID buffer_id, const StringID uniform_member_id, const UniformType& value )
 		{
-			uniform_buffer_management_global.SetPartial( buffer_name, uniform_member_name, value );
+			uniform_buffer_management_global.SetPartial( buffer_id, uniform_member_id, value );
 		}
 
 		const std::unordered_set< RHI::Shader* > RegisteredShaders() const { return shaders_registered; }
@@ -258,6 +290,15 @@ namespace Kakadu
 		void DrawInstanced_Indexed( const Mesh& mesh ) const;
 		void DrawInstanced_NonIndexed( const Mesh& mesh ) const;
 
+		/* Base instance is set to the index of the (first) world transform inside the DrawTransformBuffer. */
+		void DrawMesh_WithDrawTransforms( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const;
+		void DrawWithDrawTransforms_Indexed( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const;
+		void DrawWithDrawTransforms_NonIndexed( const Mesh& mesh, const u32 first_draw_transform_index, const u32 instance_count ) const;
+		/* Dynamic instancing: Draws all renderables of the given packet range (which share the same Mesh) with a single instanced draw call. */
+		void DrawMesh_DynamicallyInstanced( const Mesh& mesh, const std::vector< DrawPacket >& draw_packet_list, const std::size_t range_begin, const std::size_t range_end );
+		/* Draws all renderables of the given packet range (pooled Meshes of the same GeometryPool page) with a single glMultiDrawElementsIndirect(); One command per run of equal Meshes. */
+		void DrawMeshes_MultiDrawIndirect( const std::vector< DrawPacket >& draw_packet_list, const std::size_t range_begin, const std::size_t range_end );
+
 		void RenderFullscreenEffect( FullscreenEffect& effect );
 	
 		void SetIntrinsicsPerPass( const RenderPass& pass );
@@ -266,7 +307,12 @@ namespace Kakadu
 		void UploadIntrinsics();
 		void UploadGlobals();
 
+		void CreateShadowMapFramebuffer();
+		/* Fits the cascades to the view volume of the lighting pass' camera. */
 		void CalculateShadowMappingInformation();
+		/* Renders the shadow casters into each cascade's layer of the shadow map.
+		 * With static caster caching on, only the dynamic casters are rendered, on top of a copy of the cascade's cached static casters. */
+		void RenderShadowMappingPass( const RenderPass& pass );
 
 		void InitializeBuiltinMeshes();
 		void InitializeBuiltinMaterials();
@@ -274,6 +320,9 @@ namespace Kakadu
 		void InitializeBuiltinFullscreenEffects();
 		void InitializeBuiltinPostprocessingEffects();
 
+		/* Swaps in the recompiled Shader only if it compiled & linked successfully, so that a broken edit keeps the old program running. */
+		void ReplaceWithRecompiledShader( RHI::Shader& shader, RHI::Shader& recompiled_shader );
+
 		void SetPolygonMode( const RHI::PolygonMode mode );
 
 		/*
@@ -287,11 +336,12 @@ namespace Kakadu
 
 		enum BuiltinFramebufferIndex : u8
 		{
-			Default                        = 0,
-			ShadowMapping_DirectionalLight = 1,
-			Main                           = 2,
-			PostProcessing                 = 3,
-			Composite                      = 4,
+			Default                             = 0,
+			ShadowMapping_DirectionalLight      = 1,
+			Main                                = 2,
+			PostProcessing                      = 3,
+			Composite                           = 4,
+			ShadowMappingCache_DirectionalLight = 5,
 
 			Count
 		};
@@ -304,6 +354,8 @@ namespace Kakadu
 		const RHI::Framebuffer& PostProcessingFramebuffer() const					{ return framebuffers[ BuiltinFramebufferIndex::PostProcessing ]; }
 			  RHI::Framebuffer& CompositeFramebuffer()								{ return framebuffers[ BuiltinFramebufferIndex::Composite ]; }
 		const RHI::Framebuffer& CompositeFramebuffer() const						{ return framebuffers[ BuiltinFramebufferIndex::Composite ]; }
+			  RHI::Framebuffer& ShadowMappingCacheFramebuffer_DirectionalLight()		{ return framebuffers[ BuiltinFramebufferIndex::ShadowMappingCache_DirectionalLight ]; }
+		const RHI::Framebuffer& ShadowMappingCacheFramebuffer_DirectionalLight() const	{ return framebuffers[ BuiltinFramebufferIndex::ShadowMappingCache_DirectionalLight ]; }
 
 		/*
 		 * Stencil Test:
@@ -323,6 +375,8 @@ namespace Kakadu
 		void DisableDepthTest();
 		void ToggleDepthWrite( const bool enable );
 		void SetDepthComparisonFunction( const RHI::ComparisonFunction comparison_function );
+		void EnableDepthClamp();
+		void DisableDepthClamp();
 
 		/*
 		 * Blending:
@@ -344,6 +398,20 @@ namespace Kakadu
 		void SetRenderState( const RenderState& render_state_to_set, RHI::Framebuffer* target_framebuffer, const bool clear_framebuffer = false );
 		void SortRenderablesInQueue( const Vector3& camera_position, std::vector< Renderable* >& renderable_array_to_sort, const SortingMode sorting_mode );
 
+		/* Which shadow casters to include, for the shadow mapping pass; Ignored for other passes. */
+		enum class ShadowCasterSelection : u8
+		{
+			All,
+			StaticOnly,
+			DynamicOnly
+		};
+
+		void BuildDrawPacketList( RenderQueue& queue, const RenderPassID pass_id, const RenderState& render_state,
+								  const Math::Frustum& frustum, const Vector3& camera_position,
+								  const ShadowCasterSelection shadow_caster_selection = ShadowCasterSelection::All );
+		void RenderDrawPacketList( const std::vector< DrawPacket >& draw_packet_list );
+		void RenderShadowCasterDrawPacketList( const std::vector< DrawPacket >& draw_packet_list );
+
 		/*
 		 * Face Culling:
 		 */
@@ -412,6 +480,20 @@ namespace Kakadu
 			Radians vertical_field_of_view;
 		};
 
+		struct ShadowCascade
+		{
+			Matrix4x4 view_matrix;
+			Matrix4x4 projection_matrix;
+
+			Lighting::ShadowCascadeData data;
+
+			/* Same as the cascade's frustum, but with the near plane pulled back to include the casters between the light & the cascade.
+			 * These get their depths clamped to the near plane (i.e., "pancaking"), so the projection itself does not depend on the casters. */
+			Math::Frustum culling_frustum;
+
+			bool static_cache_is_valid;
+		};
+
 	private:
 
 		/*
@@ -440,10 +522,11 @@ namespace Kakadu
 		DirectionalLight*			light_directional;
 		std::vector< PointLight* >	lights_point;
 		std::vector< SpotLight*	 >	lights_spot;
-		i32 lights_point_active_count;
-		i32 lights_spot_active_count;
+		std::vector< Lighting::PointLightData > lights_point_active_data; // View space; Rebuilt every time lighting intrinsics are set.
+		std::vector< Lighting::SpotLightData  > lights_spot_active_data;  // View space; Rebuilt every time lighting intrinsics are set.
 
-		Matrix4x4 light_directional_view_projection_transform_matrix;
+		LightClusterGrid light_cluster_grid;
+		LightClusterBuffer light_cluster_buffer;
 
 		/*
 		 * Rendering:
@@ -455,6 +538,22 @@ namespace Kakadu
 		std::unordered_set< RHI::Shader* > shaders_registered;
 		std::unordered_map< RHI::Shader*, RHI::Shader::ReferenceCount > shaders_registered_reference_count_map;
 
+		/* Shader hot-reload: */
+		ShaderSourceWatcher shader_source_watcher;
+		std::unique_ptr< RHI::ShaderCompiler > shader_recompiler; // Only while a batch of recompilations is in flight.
+		std::deque< RHI::Shader > shaders_recompiled;
+		std::unordered_map< RHI::Shader*, RHI::Shader* > shader_to_replace_per_recompiled_shader;
+
+		std::vector< DrawPacket > draw_packet_list_sort_scratch;
+
+		DrawTransformBuffer draw_transform_buffer;
+		DrawCommandBuffer draw_command_buffer;
+
+		/* Times every pass, queue & fullscreen effect; See RENDERER_SCOPE() in Renderer.cpp. */
+		RHI::GPUProfiler gpu_profiler;
+		/* Counts the work issued in the same scopes. */
+		FrameStatisticsRecorder frame_statistics_recorder;
+
 		Mesh full_screen_cube_mesh;
 
 		/*
@@ -496,7 +595,15 @@ namespace Kakadu
 		 * Shadow Mapping:
 		 */
 
-		OrthographicProjectionParameters shadow_mapping_projection_parameters;
+		CascadedShadowMapSettings shadow_mapping_settings;
+		CascadedShadowMapSettings shadow_mapping_settings_in_use; // The shadow map framebuffer was created with these.
+
+		std::array< ShadowCascade, CascadedShadowMapSettings::CASCADE_MAX_COUNT > shadow_cascades; // Ordered from the nearest to the farthest.
+		u32 shadow_cascade_active_count;
+
+		std::vector< Math::AABB > shadow_caster_bounds_light_space; // Scratch; Used to extend the cascades' culling frusta towards casters outside them.
+
+		u64 shadow_static_caster_signature; // Changes whenever a static caster is added, removed, toggled or moved; Invalidates the static caster caches.
 
 		/*
 		 * Uniform Management:
@@ -510,6 +617,8 @@ namespace Kakadu
 
 		CameraInfo current_camera_info;
 
+		RHI::Uniform::Handle uniform_handle_transform_world;
+
 		bool shaders_need_uniform_buffer_lighting;
 		bool shaders_need_uniform_buffer_other;
 
@@ -0,0 +1,88 @@
+// Engine Includes.
+#include "ShaderSourceWatcher.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Kakadu
+{
+	ShaderSourceWatcher::ShaderSourceWatcher()
+		:
+		is_enabled( false )
+	{
+	}
+
+	void ShaderSourceWatcher::Enable()
+	{
+		if( is_enabled )
+			return;
+
+		is_enabled = true;
+
+		for( const auto& [ source_file_path, shaders ] : shaders_per_source_file )
+			file_watcher.Watch( source_file_path );
+	}
+
+	void ShaderSourceWatcher::Add( RHI::Shader& shader )
+	{
+		auto source_file_paths = SourceFilePaths( shader );
+
+		for( const auto& source_file_path : source_file_paths )
+		{
+			auto& shaders = shaders_per_source_file[ source_file_path ];
+
+			if( shaders.empty() && is_enabled )
+				file_watcher.Watch( source_file_path );
+
+			shaders.insert( &shader );
+		}
+
+		source_files_per_shader[ &shader ] = std::move( source_file_paths );
+	}
+
+	void ShaderSourceWatcher::Remove( RHI::Shader& shader )
+	{
+		auto iterator = source_files_per_shader.find( &shader );
+		if( iterator == source_files_per_shader.end() )
+			return;
+
+		/* Files stay watched even when no Shader depends on them anymore; Their modifications are simply ignored. */
+		for( const auto& source_file_path : iterator->second )
+			if( auto shaders_iterator = shaders_per_source_file.find( source_file_path );
+				shaders_iterator != shaders_per_source_file.end() )
+				shaders_iterator->second.erase( &shader );
+
+		source_files_per_shader.erase( iterator );
+	}
+
+	std::unordered_set< RHI::Shader* > ShaderSourceWatcher::ConsumeAffectedShaders()
+	{
+		std::unordered_set< RHI::Shader* > affected_shaders;
+
+		for( const auto& modified_file_path : file_watcher.ConsumeModifiedFiles() )
+			if( auto iterator = shaders_per_source_file.find( modified_file_path );
+				iterator != shaders_per_source_file.end() )
+				affected_shaders.insert( iterator->second.begin(), iterator->second.end() );
+
+		return affected_shaders;
+	}
+
+	std::vector< std::string > ShaderSourceWatcher::SourceFilePaths( const RHI::Shader& shader )
+	{
+		std::vector< std::string > source_file_paths;
+
+		source_file_paths.push_back( FileWatcher::NormalizedPath( shader.VertexSourcePath() ) );
+		if( shader.HasGeometryStage() )
+			source_file_paths.push_back( FileWatcher::NormalizedPath( shader.GeometrySourcePath() ) );
+		source_file_paths.push_back( FileWatcher::NormalizedPath( shader.FragmentSourcePath() ) );
+
+		for( const auto& include_path_array : { &shader.VertexSourceIncludePaths(), &shader.GeometrySourceIncludePaths(), &shader.FragmentSourceIncludePaths() } )
+			for( const auto& include_path : *include_path_array )
+				source_file_paths.push_back( FileWatcher::NormalizedPath( include_path ) );
+
+		std::sort( source_file_paths.begin(), source_file_paths.end() );
+		source_file_paths.erase( std::unique( source_file_paths.begin(), source_file_paths.end() ), source_file_paths.end() );
+
+		return source_file_paths;
+	}
+}
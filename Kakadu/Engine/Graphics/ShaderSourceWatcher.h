@@ -0,0 +1,52 @@
+#pragma once
+
+// Engine Includes.
+#include "RHI/Shader.hpp"
+#include "Core/FileWatcher.h"
+#include "Core/Macros.h"
+
+// std Includes.
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Kakadu
+{
+	/* Maps modified source files (stages & #included files alike) to the Shaders depending on them, via a reverse include graph.
+	 * Shaders can be added at any time; Files are only watched (see FileWatcher) after Enable() is called, so that builds without hot-reload do not pay for it. */
+	class ShaderSourceWatcher
+	{
+	public:
+		ShaderSourceWatcher();
+
+		DELETE_COPY_AND_MOVE_CONSTRUCTORS( ShaderSourceWatcher );
+
+	/* Usage: */
+
+		void Enable();
+
+		void Add( RHI::Shader& shader );
+		void Remove( RHI::Shader& shader );
+
+		/* Does not make any system calls. */
+		std::unordered_set< RHI::Shader* > ConsumeAffectedShaders();
+
+	/* Queries: */
+
+		bool IsEnabled() const { return is_enabled; }
+
+	private:
+		static std::vector< std::string > SourceFilePaths( const RHI::Shader& shader );
+
+	private:
+		FileWatcher file_watcher;
+
+		std::unordered_map< std::string, std::unordered_set< RHI::Shader* > > shaders_per_source_file;
+		/* Source files as of Add(), so that Remove() finds the same files even if the Shader was recompiled with a different include graph since. */
+		std::unordered_map< RHI::Shader*, std::vector< std::string > > source_files_per_shader;
+
+		bool is_enabled;
+		/* 7 bytes of padding. */
+	};
+}
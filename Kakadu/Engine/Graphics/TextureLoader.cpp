@@ -1,26 +1,180 @@
 // Engine Includes.
+#include "BuiltinTextures.h"
+#include "Core/Assertion.h"
+#include "Core/JobSystem.h"
 #include "Core/Log.h"
 #include "Core/ServiceLocator.hpp"
+#include "RHI/DebugLabel.h"
+#include "RHI/GLLabelPrefixes.h"
+#include "RHI/PersistentRingBuffer.h" // RHI::WaitForAndDeleteFence().
+#include "RHI/RHI.h"
 #include "RHI/Texture.h"
+#include "RHI/ID/BufferID.h"
 
 // Vendor/stb Includes.
 #include "stb/stb_image.h"
 
 // std Includes.
+#include <algorithm>
 #include <array>
-#include <execution>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Kakadu
 {
 	constexpr i32 DESIRED_CHANNELS = 4;
 
+	/*
+	 * Asynchronous loading state:
+	 */
+
+	/* Decoding happens in JobSystem jobs, one per image; Everything GL related happens on the main thread, in ProcessAsyncUploads().
+	 * Jobs are tracked by the address of their (placeholder) Texture plus a serial number, so that a result of a cancelled job can never reach a new Texture living at the same address. */
+	struct AsyncDecodeJob
+	{
+		RHI::Texture* texture;
+		u64 serial;
+		std::string file_path; // Empty when decoding from memory.
+		std::vector< std::byte > file_bytes; // Copy of the still-encoded file contents; The caller's memory may be gone by the time a worker gets to it.
+		RHI::Texture::ImportSettings import_settings;
+	};
+
+	struct AsyncDecodedImage
+	{
+		RHI::Texture* texture;
+		u64 serial;
+		stbi_uc* pixels; // nullptr if decoding failed (or was skipped due to shutdown).
+		i32 width, height;
+		RHI::Texture::ImportSettings import_settings;
+	};
+
+	/* Staging memory for the pixel uploads: A persistently & coherently mapped pixel unpack buffer, split into REGION_COUNT regions.
+	 * Same scheme as RHI::PersistentRingBuffer, but of a fixed size: Each ProcessAsyncUploads() call that has work fills the next region & fences it. Images not fitting into a region are uploaded directly. */
+	struct AsyncUploadStaging
+	{
+		static constexpr u32 REGION_COUNT = 3;
+		static constexpr u32 REGION_SIZE  = 16 * 1024 * 1024; // In bytes.
+
+		RHI::BufferID buffer_id;
+		std::byte* mapped_memory = nullptr;
+		u32 region_index = 0;
+		u32 region_cursor = 0; // Bytes used in the current region so far.
+		std::array< GLsync, REGION_COUNT > fences = {};
+	};
+
+	struct AsyncLoadState
+	{
+		std::mutex mutex;
+		std::deque< AsyncDecodedImage > upload_queue;
+		std::unordered_map< const RHI::Texture*, u64 > pending_serials; // Scheduled, decoding or decoded; Erased on upload or cancellation.
+		u64 next_serial = 0;
+		std::atomic< bool > stop_requested = false;
+
+		/* Tracks the decode jobs in flight, so that shutdown can wait for them. */
+		JobSystem::Counter decode_job_counter;
+
+		AsyncUploadStaging staging;
+	};
+
+	internal_function AsyncLoadState& AsyncState()
+	{
+		local_persist AsyncLoadState state;
+		return state;
+	}
+
+	internal_function bool AsyncDecodeJobIsPending( const AsyncLoadState& state, const AsyncDecodeJob& job )
+	{
+		const auto it = state.pending_serials.find( job.texture );
+		return it != state.pending_serials.end() && it->second == job.serial;
+	}
+
+	internal_function void ExecuteAsyncDecodeJob( const AsyncDecodeJob& job )
+	{
+		auto& state = AsyncState();
+
+		{
+			std::scoped_lock lock( state.mutex );
+
+			/* Cancelled before the job got to run. */
+			if( not AsyncDecodeJobIsPending( state, job ) )
+				return;
+		}
+
+		AsyncDecodedImage decoded{ .texture = job.texture, .serial = job.serial, .pixels = nullptr, .width = 0, .height = 0, .import_settings = job.import_settings };
+
+		/* Skipped on shutdown; The (failed) result still goes to the upload queue, so that the shutdown can reset the Texture's loading state. */
+		if( not state.stop_requested.load( std::memory_order_relaxed ) )
+		{
+			// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
+			stbi_set_flip_vertically_on_load_thread( job.import_settings.flip_vertically );
+
+			i32 number_of_channels = -1;
+			if( job.file_path.empty() )
+				decoded.pixels = stbi_load_from_memory( ( stbi_uc* )job.file_bytes.data(), ( i32 )job.file_bytes.size(),
+														&decoded.width, &decoded.height, &number_of_channels, DESIRED_CHANNELS );
+			else
+				decoded.pixels = stbi_load( job.file_path.c_str(), &decoded.width, &decoded.height, &number_of_channels, DESIRED_CHANNELS );
+		}
+
+		{
+			std::scoped_lock lock( state.mutex );
+
+			if( AsyncDecodeJobIsPending( state, job ) )
+			{
+				state.upload_queue.push_back( decoded );
+				return;
+			}
+		}
+
+		// Cancelled while decoding:
+		stbi_image_free( decoded.pixels );
+	}
+
+	internal_function void EnqueueAsyncDecodeJob( AsyncDecodeJob&& job )
+	{
+		auto& state = AsyncState();
+
+		{
+			std::scoped_lock lock( state.mutex );
+
+			job.serial = state.next_serial++;
+			state.pending_serials[ job.texture ] = job.serial;
+		}
+
+		ServiceLocator< JobSystem >::Get().Run( [ job = std::move( job ) ]() { ExecuteAsyncDecodeJob( job ); }, &state.decode_job_counter );
+	}
+
+	internal_function void CreateAsyncUploadStaging( AsyncUploadStaging& staging )
+	{
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		constexpr GLsizeiptr size  = ( GLsizeiptr )AsyncUploadStaging::REGION_SIZE * AsyncUploadStaging::REGION_COUNT;
+
+		glCreateBuffers( 1, &staging.buffer_id.id );
+		glNamedBufferStorage( staging.buffer_id.id, size, nullptr, flags );
+		staging.mapped_memory = reinterpret_cast< std::byte* >( glMapNamedBufferRange( staging.buffer_id.id, 0, size, flags ) );
+
+		ASSERT_DEBUG_ONLY( staging.mapped_memory && "Texture upload staging buffer could not be mapped!" );
+
+#ifdef _EDITOR
+		RHI::DebugLabel::Set( GL_BUFFER, staging.buffer_id.id, GL_LABEL_PREFIX_PIXEL_UNPACK_BUFFER "Texture Upload Staging" );
+#endif // _EDITOR
+
+		staging.region_index  = 0;
+		staging.region_cursor = 0;
+	}
+
 	std::optional< RHI::Texture > RHI::Texture::Loader::FromFile( const::std::string_view name, const std::string& file_path, const RHI::Texture::ImportSettings& import_settings )
 	{
 		//auto& instance = Instance();
 
 		// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
-		stbi_set_flip_vertically_on_load( import_settings.flip_vertically );
+		stbi_set_flip_vertically_on_load_thread( import_settings.flip_vertically );
 
 		std::optional< RHI::Texture > maybe_texture;
 
@@ -56,8 +210,10 @@ namespace Kakadu
 
 		/* OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
 		 *
-		 * BUT: cube-map coordinate space has the inverse v behavior, so the image's should not be flipped. */
-		stbi_set_flip_vertically_on_load( false ); // Override whatever is in import_settings.flip_vertically.
+		 * BUT: cube-map coordinate space has the inverse v behavior, so the image's should not be flipped.
+		 *
+		 * The faces are decoded on JobSystem workers, which may have a per-thread flip setting left over from asynchronous decode jobs; That one takes precedence over the global setting,
+		 * so it is set per face below instead. */
 
 		std::array< stbi_uc*, 6 > image_data_array;
 
@@ -66,12 +222,12 @@ namespace Kakadu
 
 		bool error_encountered = false;
 
-		constexpr std::array< u8, 6 > indices = { 0, 1, 2, 3, 4, 5 };
-
-		std::for_each( std::execution::par, indices.cbegin(), indices.cend(), [ & ]( u8 i )
+		ServiceLocator< JobSystem >::Get().ParallelFor( 6, 1, [ & ]( const std::size_t i, const std::size_t /* end: Always i + 1. */ )
 		{
 			const auto& file_path( ( cubemap_file_paths.begin() + i ) );
 
+			stbi_set_flip_vertically_on_load_thread( false ); // Override whatever is in import_settings.flip_vertically.
+
 			image_data_array[ i ] = stbi_load( file_path->c_str(), &width, &height, &number_of_channels, DESIRED_CHANNELS );
 			if( image_data_array[ i ] == nullptr )
 			{
@@ -95,10 +251,8 @@ namespace Kakadu
 														  import_settings.min_filter,
 														  import_settings.mag_filter );
 
-		std::for_each( std::execution::par, indices.cbegin(), indices.cend(), [ & ]( u8 i )
-		{
-			stbi_image_free( image_data_array[ i ] );
-		} );
+		for( auto image_data : image_data_array )
+			stbi_image_free( image_data );
 		
 		return maybe_texture;
 	}
@@ -114,7 +268,7 @@ namespace Kakadu
 		std::optional< RHI::Texture > maybe_texture;
 
 		// OpenGL expects uv coordinate v = 0 to be on the most bottom whereas stb loads image data with v = 0 to be top.
-		stbi_set_flip_vertically_on_load( import_settings.flip_vertically );
+		stbi_set_flip_vertically_on_load_thread( import_settings.flip_vertically );
 
 		i32 width, height;
 		i32 number_of_channels = -1;
@@ -161,4 +315,200 @@ namespace Kakadu
 									  import_settings.min_filter, import_settings.mag_filter );
 		return maybe_texture;
 	}
+
+	/* Creates a copy of the built-in "Missing" texture, which is shown until the actual image is uploaded in place by ProcessAsyncUploads(). */
+	RHI::Texture RHI::Texture::Loader::Placeholder( const std::string_view name, const RHI::Texture::ImportSettings& import_settings )
+	{
+		const Texture& missing = *BuiltinTextures::Get( "Missing" );
+
+		Texture placeholder( name,
+							 nullptr,
+							 missing.PixelFormat(),
+							 missing.Width(), missing.Height(),
+							 false,
+							 import_settings.wrap_u, import_settings.wrap_v,
+							 import_settings.border_color,
+							 import_settings.min_filter, import_settings.mag_filter );
+
+		glCopyImageSubData( missing.Id().id,	 GL_TEXTURE_2D, 0, 0, 0, 0,
+							placeholder.Id().id, GL_TEXTURE_2D, 0, 0, 0, 0,
+							missing.Width(), missing.Height(), 1 );
+
+		placeholder.GenerateMipmaps();
+		placeholder.Unbind();
+
+		return placeholder;
+	}
+
+	void RHI::Texture::Loader::FromFile_Async( RHI::Texture& placeholder, const std::string& file_path, const RHI::Texture::ImportSettings& import_settings )
+	{
+		placeholder.is_loading = true;
+
+		EnqueueAsyncDecodeJob( AsyncDecodeJob{ .texture = &placeholder, .serial = 0, .file_path = file_path, .file_bytes = {}, .import_settings = import_settings } );
+	}
+
+	/* 'data' argument here contains the parsed file contents that are still encoded and need to be decoded before actual use. It is copied, so it does not need to outlive this call. */
+	void RHI::Texture::Loader::FromFileBytes_Async( RHI::Texture& placeholder, const std::byte* data, const i32 length, const RHI::Texture::ImportSettings& import_settings )
+	{
+		placeholder.is_loading = true;
+
+		EnqueueAsyncDecodeJob( AsyncDecodeJob{ .texture = &placeholder, .serial = 0, .file_path = {}, .file_bytes = std::vector< std::byte >( data, data + length ),
+											   .import_settings = import_settings } );
+	}
+
+	void RHI::Texture::Loader::CancelAsync( const RHI::Texture& asset )
+	{
+		auto& state = AsyncState();
+
+		std::scoped_lock lock( state.mutex );
+
+		/* Decode jobs notice the missing serial themselves & skip decoding or discard their result. */
+		state.pending_serials.erase( &asset );
+
+		std::erase_if( state.upload_queue, [ & ]( const AsyncDecodedImage& decoded )
+		{
+			if( decoded.texture != &asset )
+				return false;
+
+			stbi_image_free( decoded.pixels );
+			return true;
+		} );
+	}
+
+	void RHI::Texture::Loader::ProcessAsyncUploads( const float time_budget_in_milliseconds )
+	{
+		auto& state = AsyncState();
+		auto& staging = state.staging;
+
+		const auto start_time = std::chrono::steady_clock::now();
+
+		bool region_started = false;
+
+		while( true )
+		{
+			AsyncDecodedImage decoded;
+
+			{
+				std::scoped_lock lock( state.mutex );
+
+				if( state.upload_queue.empty() )
+					break;
+
+				decoded = state.upload_queue.front();
+				state.upload_queue.pop_front();
+				state.pending_serials.erase( decoded.texture );
+			}
+
+			Texture& texture = *decoded.texture;
+			texture.is_loading = false;
+
+			if( not decoded.pixels )
+			{
+				std::cerr << R"(Texture ")" << texture.name << R"(": Could not load image data asynchronously; Keeping the placeholder.)" << "\n";
+				Log::Error( R"(Texture ")" + texture.name + R"(": Could not load image data asynchronously; Keeping the placeholder.)" "\n" );
+				continue;
+			}
+
+			const Format format = DetermineActualFormat( decoded.import_settings.format );
+			const std::size_t byte_count = ( std::size_t )decoded.width * decoded.height * DESIRED_CHANNELS;
+
+			texture.Bind();
+
+			/* Re-specifying the image in place keeps the GL id (& thus every reference to it in Materials etc.) valid. */
+			if( byte_count <= AsyncUploadStaging::REGION_SIZE )
+			{
+				if( not region_started )
+				{
+					if( not staging.buffer_id )
+						CreateAsyncUploadStaging( staging );
+
+					staging.region_index  = ( staging.region_index + 1 ) % AsyncUploadStaging::REGION_COUNT;
+					staging.region_cursor = 0;
+					RHI::WaitForAndDeleteFence( staging.fences[ staging.region_index ] );
+
+					region_started = true;
+				}
+
+				if( staging.region_cursor + byte_count > AsyncUploadStaging::REGION_SIZE )
+				{
+					/* Region is full; Put it back & try again next frame. */
+					texture.is_loading = true;
+
+					std::scoped_lock lock( state.mutex );
+					state.pending_serials[ decoded.texture ] = decoded.serial;
+					state.upload_queue.push_front( decoded );
+					break;
+				}
+
+				const std::size_t offset = ( std::size_t )staging.region_index * AsyncUploadStaging::REGION_SIZE + staging.region_cursor;
+				std::memcpy( staging.mapped_memory + offset, decoded.pixels, byte_count );
+				staging.region_cursor += ( u32 )byte_count;
+
+				glBindBuffer( GL_PIXEL_UNPACK_BUFFER, staging.buffer_id.id );
+				glTexImage2D( GL_TEXTURE_2D, 0, InternalFormat( format ), decoded.width, decoded.height, 0, PixelDataFormat( format ), PixelDataType( format ),
+							  reinterpret_cast< const void* >( offset ) );
+				glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+			}
+			else
+			{
+				glTexImage2D( GL_TEXTURE_2D, 0, InternalFormat( format ), decoded.width, decoded.height, 0, PixelDataFormat( format ), PixelDataType( format ),
+							  decoded.pixels );
+			}
+
+			if( decoded.import_settings.generate_mipmaps )
+			{
+				glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000 ); // GL default.
+				glGenerateMipmap( GL_TEXTURE_2D );
+			}
+			else
+				glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0 );
+
+			texture.Unbind();
+
+			stbi_image_free( decoded.pixels );
+
+			texture.size            = Vector2I( decoded.width, decoded.height );
+			texture.import_settings = decoded.import_settings;
+			texture.import_settings.format = format;
+
+			if( std::chrono::duration< float, std::milli >( std::chrono::steady_clock::now() - start_time ).count() >= time_budget_in_milliseconds )
+				break;
+		}
+
+		if( region_started )
+			staging.fences[ staging.region_index ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+	}
+
+	void RHI::Texture::Loader::ShutdownAsync()
+	{
+		auto& state = AsyncState();
+
+		state.stop_requested = true;
+
+		/* Jobs that have not started decoding yet skip it. */
+		ServiceLocator< JobSystem >::Get().Wait( state.decode_job_counter );
+
+		/* Textures still waiting keep showing their placeholders. */
+		for( auto& decoded : state.upload_queue )
+		{
+			decoded.texture->is_loading = false;
+			stbi_image_free( decoded.pixels );
+		}
+
+		state.upload_queue.clear();
+		state.pending_serials.clear();
+
+		auto& staging = state.staging;
+
+		for( auto& fence : staging.fences )
+			RHI::WaitForAndDeleteFence( fence );
+
+		if( staging.buffer_id )
+		{
+			glUnmapNamedBuffer( staging.buffer_id.id );
+			glDeleteBuffers( 1, &staging.buffer_id.id );
+			staging.buffer_id.Reset();
+			staging.mapped_memory = nullptr;
+		}
+	}
 }
@@ -3,6 +3,7 @@
 // Engine Includes.
 #include "UniformBufferManager.h"
 #include "Core/DirtyBlob.h"
+#include "Core/StringID.h"
 #include "RHI/Buffer.h"
 #include "RHI/Std140StructTag.h"
 #include "RHI/Uniform.h"
@@ -15,6 +16,15 @@ namespace Kakadu
 	template< typename BlobType > requires( std::is_base_of_v< Blob, BlobType > )
 	class UniformBufferManagement
 	{
+	public:
+		/* Everything about a single buffer, so that every operation does a single (integer) lookup. */
+		struct BufferRecord
+		{
+			RHI::Uniform::BufferInformation info;
+			RHI::Buffer* buffer;
+			BlobType blob;
+		};
+
 	public:
 		UniformBufferManagement() = default;
 
@@ -25,16 +35,40 @@ namespace Kakadu
 		~UniformBufferManagement() = default;
 
 	/* Queries: */
-		const std::unordered_map< std::string, const RHI::Uniform::BufferInformation >& GetBufferInformationMap() const { return buffer_info_map; }
+		/* Keys are interned; Use StringID::Name() to get the buffer names back. */
+		const std::unordered_map< StringID, BufferRecord >& GetBufferRecordMap() const { return buffer_record_map; }
+
+		bool HasBuffer( const StringID buffer_id ) const { return buffer_record_map.contains( buffer_id ); }
+
+		/* Whether both have the same buffers with the same contents. */
+		bool HasEqualBlobs( const UniformBufferManagement& other ) const
+		{
+			if( buffer_record_map.size() != other.buffer_record_map.size() )
+				return false;
+
+			for( const auto& [ buffer_id, buffer_record ] : buffer_record_map )
+			{
+				const auto iterator = other.buffer_record_map.find( buffer_id );
+				if( iterator == other.buffer_record_map.cend() || not( buffer_record.blob == iterator->second.blob ) )
+					return false;
+			}
+
+			return true;
+		}
 
 	/* Register/Unregister Buffer API: */
 		void RegisterBuffer( const std::string& buffer_name, const RHI::Uniform::BufferInformation buffer_info )
 		{
-			if( buffer_info_map.try_emplace( buffer_name, buffer_info ).second ) // .second returns whether the emplace was successfull or not.
-			{
-				buffer_map.emplace( buffer_name, UniformBufferManager::CreateOrRequest( buffer_name, buffer_info ) );
+			const StringID buffer_id = StringID::Intern( buffer_name );
 
-				blob_map.emplace( buffer_name, buffer_info.size );
+			if( not buffer_record_map.contains( buffer_id ) )
+			{
+				buffer_record_map.try_emplace( buffer_id, BufferRecord
+											   {
+												   .info   = buffer_info,
+												   .buffer = UniformBufferManager::CreateOrRequest( buffer_name, buffer_info ),
+												   .blob   = BlobType( buffer_info.size )
+											   } );
 			}
 		}
 
@@ -42,134 +76,104 @@ namespace Kakadu
 		 * Since RHI::Uniform::BufferInformation holds pointers to Shader data, it is effectively lost/corrupted when the host Shader is destroyed (upon recompilation). */
 		void RegisterBuffer_ForceUpdateBufferInfoIfBufferExists( const std::string& buffer_name, const RHI::Uniform::BufferInformation& buffer_info )
 		{
-			if( buffer_info_map.contains( buffer_name ) )
+			if( auto iterator = buffer_record_map.find( StringID( buffer_name ) );
+				iterator != buffer_record_map.end() )
 			{
-				buffer_info_map.erase( buffer_name );
-				buffer_info_map.emplace( buffer_name, buffer_info );
+				iterator->second.info = buffer_info;
 			}
 			else
 				RegisterBuffer( buffer_name, buffer_info );
 		}
 
-		void UnregisterBuffer( const std::string& buffer_name )
+		void UnregisterBuffer( const StringID buffer_id )
 		{
-			if( const auto& iterator = buffer_info_map.find( buffer_name );
-				iterator != buffer_info_map.cend() )
-			{
-				buffer_map.erase( buffer_name );
-				buffer_info_map.erase( buffer_name );
-				blob_map.erase( buffer_name );
-			}
+			buffer_record_map.erase( buffer_id );
 		}
 
 		void UnregisterAllBuffers()
 		{
-			if( not buffer_info_map.empty() )
-			{
-				buffer_map.clear();
-				buffer_info_map.clear();
-				blob_map.clear();
-			}
+			buffer_record_map.clear();
 		}
 
 	/* Uniform Set/Get: */
-		const void* Get( const std::string& buffer_name ) const
+		const void* Get( const StringID buffer_id ) const
 		{
-			return blob_map.at( buffer_name ).Get( 0 );
+			return buffer_record_map.at( buffer_id ).blob.Get( 0 );
 		}
 
-		void* Get( const std::string& buffer_name )
+		void* Get( const StringID buffer_id )
 		{
-			return blob_map[ buffer_name ].Get( 0 );
+			return buffer_record_map.at( buffer_id ).blob.Get( 0 );
 		}
 
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void Set( const std::string& buffer_name, const StructType& value )
+		void Set( const StringID buffer_id, const StructType& value )
 		{
-			const auto& buffer_info = buffer_info_map[ buffer_name ];
+			auto& buffer_record = buffer_record_map.at( buffer_id );
 
-			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), 0 /* because every buffer has its own blob. */, buffer_info.size );
+			buffer_record.blob.Set( reinterpret_cast< const std::byte* >( &value ), 0 /* because every buffer has its own blob. */, buffer_record.info.size );
 		}
 
 		/* For PARTIAL setting of ARRAY uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void SetPartial_Array( const std::string& buffer_name, const char* uniform_member_array_instance_name, const u32 array_index, const StructType& value )
+		void SetPartial_Array( const StringID buffer_id, const StringID uniform_member_array_instance_id, const u32 array_index, const StructType& value )
 		{
-			const auto& buffer_info              = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_array_info = buffer_info.members_array_map.at( uniform_member_array_instance_name );
-
-			const auto effective_offset = buffer_member_array_info.offset + 
-										  array_index * buffer_member_array_info.stride;
-
-			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), effective_offset, buffer_member_array_info.stride );
+			SetPartial_Array( buffer_id, uniform_member_array_instance_id, array_index, reinterpret_cast< const std::byte* >( &value ) );
 		}
 
 		/* For PARTIAL setting of ARRAY uniforms INSIDE a Uniform Buffer. */
-		void SetPartial_Array( const std::string& buffer_name, const char* uniform_member_array_instance_name, const u32 array_index, const std::byte* value )
+		void SetPartial_Array( const StringID buffer_id, const StringID uniform_member_array_instance_id, const u32 array_index, const std::byte* value )
 		{
-			const auto& buffer_info              = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_array_info = buffer_info.members_array_map.at( uniform_member_array_instance_name );
+			auto& buffer_record                  = buffer_record_map.at( buffer_id );
+			const auto& buffer_member_array_info = buffer_record.info.members_array_map.at( uniform_member_array_instance_id );
 
 			const auto effective_offset = buffer_member_array_info.offset + 
 										  array_index * buffer_member_array_info.stride;
 
 			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( value, effective_offset, buffer_member_array_info.stride );
+			buffer_record.blob.Set( value, effective_offset, buffer_member_array_info.stride );
 		}
 
 		/* For PARTIAL setting of STRUCT uniforms INSIDE a Uniform Buffer. */
 		template< typename StructType > requires( std::is_base_of_v< RHI::Std140StructTag, StructType > )
-		void SetPartial_Struct( const std::string& buffer_name, const char* uniform_member_struct_instance_name, const StructType& value )
+		void SetPartial_Struct( const StringID buffer_id, const StringID uniform_member_struct_instance_id, const StructType& value )
 		{
-			const auto& buffer_info               = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_struct_info = buffer_info.members_struct_map.at( uniform_member_struct_instance_name );
-
-			const auto effective_offset = buffer_member_struct_info.offset;
-
-			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), effective_offset, buffer_member_struct_info.size );
+			SetPartial_Struct( buffer_id, uniform_member_struct_instance_id, reinterpret_cast< const std::byte* >( &value ) );
 		}
 
 		/* For PARTIAL setting of STRUCT uniforms INSIDE a Uniform Buffer. */
-		void SetPartial_Struct( const std::string& buffer_name, const char* uniform_member_struct_instance_name, const std::byte* value )
+		void SetPartial_Struct( const StringID buffer_id, const StringID uniform_member_struct_instance_id, const std::byte* value )
 		{
-			const auto& buffer_info               = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_struct_info = buffer_info.members_struct_map.at( uniform_member_struct_instance_name );
-
-			const auto effective_offset = buffer_member_struct_info.offset;
+			auto& buffer_record                   = buffer_record_map.at( buffer_id );
+			const auto& buffer_member_struct_info = buffer_record.info.members_struct_map.at( uniform_member_struct_instance_id );
 
 			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( value, effective_offset, buffer_member_struct_info.size );
+			buffer_record.blob.Set( value, buffer_member_struct_info.offset, buffer_member_struct_info.size );
 		}
 
 		/* For PARTIAL setting of NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
 		template< typename UniformType > requires( not std::is_pointer_v< UniformType > ) // Don't want to "override" the overload below for actual pointer types.
-		void SetPartial( const std::string& buffer_name, const char* uniform_member_name, const UniformType& value )
+		void SetPartial( const StringID buffer_id, const StringID uniform_member_id, const UniformType& value )
 		{
-			const auto& buffer_info               = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_single_info = buffer_info.members_single_map.at( uniform_member_name );
-
-			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( reinterpret_cast< const std::byte* >( &value ), buffer_member_single_info->offset, buffer_member_single_info->size );
+			SetPartial( buffer_id, uniform_member_id, reinterpret_cast< const std::byte* >( &value ) );
 		}
 
 		/* For PARTIAL setting of NON-AGGREGATE uniforms INSIDE a Uniform Buffer. */
-		void SetPartial( const std::string& buffer_name, const char* uniform_member_name, const std::byte* value )
+		void SetPartial( const StringID buffer_id, const StringID uniform_member_id, const std::byte* value )
 		{
-			const auto& buffer_info               = buffer_info_map[ buffer_name ];
-			const auto& buffer_member_single_info = buffer_info.members_single_map.at( uniform_member_name );
+			auto& buffer_record                   = buffer_record_map.at( buffer_id );
+			const auto& buffer_member_single_info = buffer_record.info.members_single_map.at( uniform_member_id );
 
 			/* Update the value in the internal memory blob: */
-			blob_map[ buffer_name ].Set( value, buffer_member_single_info->offset, buffer_member_single_info->size );
+			buffer_record.blob.Set( value, buffer_member_single_info->offset, buffer_member_single_info->size );
 		}
 
 	/* Uniform Upload: */
 		void UploadAll()
 		{
-			for( auto& [ uniform_buffer_name, uniform_blob ] : blob_map )
+			for( auto& [ buffer_id, buffer_record ] : buffer_record_map )
 			{
-				const auto& uniform_buffer = buffer_map[ uniform_buffer_name ];
+				auto& uniform_blob = buffer_record.blob;
 
 				if constexpr( std::is_same_v< BlobType, DirtyBlob > )
 				{
@@ -178,25 +182,19 @@ namespace Kakadu
 						uniform_blob.MergeConsecutiveDirtySections();
 						const auto& dirty_sections = uniform_blob.DirtySections();
 						for( auto& dirty_section : dirty_sections )
-							uniform_buffer->Upload_Partial( uniform_blob.SpanFromSection( dirty_section ), dirty_section.offset );
+							buffer_record.buffer->Upload_Partial( uniform_blob.SpanFromSection( dirty_section ), dirty_section.offset );
 
 						uniform_blob.ClearDirtySections();
 					}
 				}
 				else // Regular Blob.
 				{
-					uniform_buffer->Upload( uniform_blob.Get( 0 ) );
+					buffer_record.buffer->Upload( uniform_blob.Get( 0 ) );
 				}
 			}
 		}
 
 	private:
-		// TODO: Use hashes instead of strings as keys.
-
-		std::unordered_map< std::string, const RHI::Uniform::BufferInformation > buffer_info_map;
-
-		std::unordered_map< std::string, RHI::Buffer* > buffer_map;
-
-		std::unordered_map< std::string, BlobType > blob_map;
+		std::unordered_map< StringID, BufferRecord > buffer_record_map;
 	};
-}
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include "Graphics/RenderPass.h"
 #include "Graphics/RenderQueue.h"
 #include "Graphics/RHI/Framebuffer.h"
-#include "Math/OrthographicProjectionParameters.h"
+#include "Graphics/RHI/GPUProfiler.h"
 
 // std Includes.
 #include <map>
@@ -23,10 +23,10 @@ namespace Kakadu
 		std::map< std::string, FullscreenEffect* >* post_processing_effect_map;
 		FullscreenEffect* tone_mapping;
 
-		OrthographicProjectionParameters* shadow_mapping_projection_parameters;
-
 		Material* skybox_material;
 
+		RHI::GPUProfiler* gpu_profiler;
+
 		UniformBufferManagement< DirtyBlob >* uniform_buffer_management_global;
 		UniformBufferManagement< DirtyBlob >* uniform_buffer_management_intrinsic;
 	};
@@ -0,0 +1,57 @@
+// Engine Includes.
+#include "AABB.h"
+
+namespace Kakadu::Math
+{
+	AABB AABB::FromPoints( const std::span< const Vector3 > points )
+	{
+		AABB aabb;
+
+		for( const auto& point : points )
+			aabb.Expand( point );
+
+		return aabb;
+	}
+
+	void AABB::Expand( const Vector3& point )
+	{
+		for( auto axis = 0; axis < 3; axis++ )
+		{
+			min[ axis ] = Min( min[ axis ], point[ axis ] );
+			max[ axis ] = Max( max[ axis ], point[ axis ] );
+		}
+	}
+
+	void AABB::Merge( const AABB& other )
+	{
+		for( auto axis = 0; axis < 3; axis++ )
+		{
+			min[ axis ] = Min( min[ axis ], other.min[ axis ] );
+			max[ axis ] = Max( max[ axis ], other.max[ axis ] );
+		}
+	}
+
+	AABB AABB::Transformed( const Matrix4x4& transform ) const
+	{
+		if( IsEmpty() || IsInfinite() )
+			return *this;
+
+		const Vector3 center  = Center();
+		const Vector3 extents = Extents();
+
+		Vector3 new_center( transform.data[ 3 ][ 0 ], transform.data[ 3 ][ 1 ], transform.data[ 3 ][ 2 ] ); // Last row holds the translation in row-major form.
+		Vector3 new_extents;
+
+		/* Row vectors are post-multiplied, so output axis j accumulates input axis i via element [ i ][ j ]. */
+		for( auto j = 0; j < 3; j++ )
+		{
+			for( auto i = 0; i < 3; i++ )
+			{
+				new_center[ j ]  += center[ i ] * transform.data[ i ][ j ];
+				new_extents[ j ] += extents[ i ] * Abs( transform.data[ i ][ j ] );
+			}
+		}
+
+		return AABB( new_center - new_extents, new_center + new_extents );
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+// Engine Includes.
+#include "Matrix.hpp"
+#include "TypeTraits.h"
+#include "Vector.hpp"
+
+// std Includes.
+#include <span>
+
+namespace Kakadu::Math
+{
+	/* Axis-aligned bounding box.
+	 * Default constructed AABBs are "empty" (min > max), so that they can be grown via Expand()/Merge() without special-casing the first point. */
+	struct AABB
+	{
+		constexpr AABB()
+			:
+			min( UNIFORM_INITIALIZATION, +TypeTraits< float >::Infinity() ),
+			max( UNIFORM_INITIALIZATION, -TypeTraits< float >::Infinity() )
+		{}
+
+		constexpr AABB( const Vector3& min, const Vector3& max )
+			:
+			min( min ),
+			max( max )
+		{}
+
+		/* Returns an AABB that contains everything; Used to mark objects which can not be culled. */
+		static constexpr AABB Infinite()
+		{
+			return AABB( Vector3( UNIFORM_INITIALIZATION, -TypeTraits< float >::Infinity() ),
+						 Vector3( UNIFORM_INITIALIZATION, +TypeTraits< float >::Infinity() ) );
+		}
+
+		static AABB FromPoints( const std::span< const Vector3 > points );
+
+	/*
+	 * Queries:
+	 */
+
+		constexpr bool IsEmpty() const { return min[ 0 ] > max[ 0 ] || min[ 1 ] > max[ 1 ] || min[ 2 ] > max[ 2 ]; }
+		constexpr bool IsInfinite() const
+		{
+			return min[ 0 ] == -TypeTraits< float >::Infinity() || max[ 0 ] == TypeTraits< float >::Infinity() ||
+				   min[ 1 ] == -TypeTraits< float >::Infinity() || max[ 1 ] == TypeTraits< float >::Infinity() ||
+				   min[ 2 ] == -TypeTraits< float >::Infinity() || max[ 2 ] == TypeTraits< float >::Infinity();
+		}
+
+		constexpr Vector3 Center()  const { return ( min + max ) * 0.5f; }
+		constexpr Vector3 Extents() const { return ( max - min ) * 0.5f; } // Half-size.
+
+		/* Radius of the bounding sphere centered at Center() that encloses this AABB. */
+		float BoundingSphereRadius() const { return Extents().Magnitude(); }
+
+	/*
+	 * Modification:
+	 */
+
+		void Expand( const Vector3& point );
+		void Merge( const AABB& other );
+
+		/* Returns the AABB enclosing this box after it is transformed by the given (row-major, row-vector convention) affine matrix.
+		 * Uses the absolute-value matrix method (Arvo), which is exact for the transformed box's AABB & does not require transforming 8 corners. */
+		AABB Transformed( const Matrix4x4& transform ) const;
+
+	/*
+	 * Data:
+	 */
+
+		Vector3 min;
+		Vector3 max;
+	};
+}
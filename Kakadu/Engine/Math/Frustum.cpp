@@ -0,0 +1,74 @@
+// Engine Includes.
+#include "Frustum.h"
+
+namespace Kakadu::Math
+{
+	Frustum::Frustum()
+		:
+		planes{}
+	{
+	}
+
+	Frustum::Frustum( const Matrix4x4& view_projection )
+	{
+		/* Clip-space coordinates are ( x, y, z, w ) = p * VP, so each clip coordinate is the dot product of p with a *column* of VP. */
+		const auto& m = view_projection.data;
+
+		const Vector4 column_0( m[ 0 ][ 0 ], m[ 1 ][ 0 ], m[ 2 ][ 0 ], m[ 3 ][ 0 ] );
+		const Vector4 column_1( m[ 0 ][ 1 ], m[ 1 ][ 1 ], m[ 2 ][ 1 ], m[ 3 ][ 1 ] );
+		const Vector4 column_2( m[ 0 ][ 2 ], m[ 1 ][ 2 ], m[ 2 ][ 2 ], m[ 3 ][ 2 ] );
+		const Vector4 column_3( m[ 0 ][ 3 ], m[ 1 ][ 3 ], m[ 2 ][ 3 ], m[ 3 ][ 3 ] );
+
+		planes[ ( int )Plane::Left   ] = column_3 + column_0;
+		planes[ ( int )Plane::Right  ] = column_3 - column_0;
+		planes[ ( int )Plane::Bottom ] = column_3 + column_1;
+		planes[ ( int )Plane::Top    ] = column_3 - column_1;
+		planes[ ( int )Plane::Near   ] = column_3 + column_2;
+		planes[ ( int )Plane::Far    ] = column_3 - column_2;
+
+		/* Normalize so that sphere tests can compare against a world-space radius. */
+		for( auto& plane : planes )
+		{
+			const float normal_magnitude = Vector3( plane.X(), plane.Y(), plane.Z() ).Magnitude();
+			if( normal_magnitude > TypeTraits< float >::Epsilon() )
+				plane /= normal_magnitude;
+		}
+	}
+
+	Frustum::~Frustum()
+	{
+	}
+
+	bool Frustum::Intersects( const AABB& aabb ) const
+	{
+		if( aabb.IsInfinite() )
+			return true;
+
+		if( aabb.IsEmpty() )
+			return false;
+
+		/* Test the "positive vertex" (the corner furthest along the plane normal) against each plane. If it is behind any plane, the whole box is. */
+		for( const auto& plane : planes )
+		{
+			const Vector3 positive_vertex( plane.X() >= 0.0f ? aabb.max.X() : aabb.min.X(),
+										   plane.Y() >= 0.0f ? aabb.max.Y() : aabb.min.Y(),
+										   plane.Z() >= 0.0f ? aabb.max.Z() : aabb.min.Z() );
+
+			if( plane.X() * positive_vertex.X() + plane.Y() * positive_vertex.Y() + plane.Z() * positive_vertex.Z() + plane.W() < 0.0f )
+				return false;
+		}
+
+		return true;
+	}
+
+	bool Frustum::Intersects( const Vector3& sphere_center, const float sphere_radius ) const
+	{
+		for( const auto& plane : planes )
+		{
+			if( plane.X() * sphere_center.X() + plane.Y() * sphere_center.Y() + plane.Z() * sphere_center.Z() + plane.W() < -sphere_radius )
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+// Engine Includes.
+#include "AABB.h"
+#include "Matrix.hpp"
+#include "Vector.hpp"
+
+// std Includes.
+#include <array>
+
+namespace Kakadu::Math
+{
+	/* 6 planes extracted from a view-projection matrix (Gribb-Hartmann method).
+	 * Plane normals (xyz) point inwards; w holds the distance term, so that a point p is inside a plane if Dot( normal, p ) + w >= 0. */
+	class Frustum
+	{
+	public:
+		enum class Plane
+		{
+			Left, Right,
+			Bottom, Top,
+			Near, Far,
+
+			Count
+		};
+
+	public:
+		Frustum();
+
+		/* Expects a row-major view-projection matrix (view * projection, row vectors post-multiplied) with OpenGL clip-space depth ([-1, +1]). */
+		explicit Frustum( const Matrix4x4& view_projection );
+
+		DEFAULT_COPY_AND_MOVE_CONSTRUCTORS( Frustum );
+
+		~Frustum();
+
+	/*
+	 * Queries:
+	 */
+
+		const Vector4& GetPlane( const Plane plane ) const { return planes[ ( int )plane ]; }
+
+		/* Conservative: May return true for some boxes that are actually outside (near frustum corners), never returns false for visible ones. */
+		bool Intersects( const AABB& aabb ) const;
+		bool Intersects( const Vector3& sphere_center, const float sphere_radius ) const;
+
+	private:
+		std::array< Vector4, ( int )Plane::Count > planes;
+	};
+}
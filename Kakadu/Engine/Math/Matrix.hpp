@@ -4,9 +4,13 @@
 #include "Core/Assertion.h"  
 #include "Core/Initialization.h"
 #include "Math/Concepts_Math.h"
+#include "Math/SIMD.hpp"
 #include "Math/TypeTraits.h"
 #include "Math/Vector.hpp"
 
+// std Includes.
+#include <type_traits>
+
 namespace Kakadu::Math
 {
 	/* Row-major. Post-multiplies a row vector to transform it. */
@@ -268,12 +272,27 @@ namespace Kakadu::Math
 
 		static consteval Matrix Identity() { return Matrix(); }
 
+		/* Whether the vectorized code paths (see SIMD.hpp) apply. */
+		static consteval bool IsFloat4x4() { return std::is_same_v< Type, float > && RowSize == 4 && ColumnSize == 4; }
+
 	/* Arithmetic Operations. */
 
 		/* Matrix-matrix multiplication. */
 		template< std::size_t RowSizeOther, std::size_t ColumnSizeOther >
 		constexpr Matrix< Type, RowSize, ColumnSizeOther > operator* ( const Matrix< Type, RowSizeOther, ColumnSizeOther >& other ) const requires( ColumnSize == RowSizeOther )
 		{
+#if defined( SIMD_SSE2 ) || defined( SIMD_NEON )
+			if constexpr( IsFloat4x4() && ColumnSizeOther == 4 )
+			{
+				if( not std::is_constant_evaluated() )
+				{
+					Matrix result( NO_INITIALIZATION );
+					SIMD::Matrix4x4_Multiply( &data[ 0 ][ 0 ], &other.data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] );
+					return result;
+				}
+			}
+#endif // SIMD_SSE2 || SIMD_NEON
+
 			Matrix< Type, RowSize, ColumnSizeOther > result( ZERO_INITIALIZATION );
 			for( auto i = 0; i < RowSize; i++ )
 				for( auto j = 0; j < ColumnSizeOther; j++ )
@@ -301,6 +320,14 @@ namespace Kakadu::Math
 
 		Matrix& Transpose()
 		{
+#if defined( SIMD_SSE2 ) || defined( SIMD_NEON )
+			if constexpr( IsFloat4x4() )
+			{
+				SIMD::Matrix4x4_Transpose( &data[ 0 ][ 0 ], &data[ 0 ][ 0 ] );
+				return *this;
+			}
+#endif // SIMD_SSE2 || SIMD_NEON
+
 			for( auto i = 0; i < RowSize; i++ )
 			{
 				for( auto j = i + 1; j < ColumnSize; j++ )
@@ -315,6 +342,123 @@ namespace Kakadu::Math
 			return Matrix( *this ).Transpose();
 		}
 
+		/* General inverse; The matrix must not be singular. */
+		constexpr Matrix Inverted() const requires( std::is_floating_point_v< Type > && RowSize == 3 && ColumnSize == 3 )
+		{
+			const auto& m = data;
+
+			const Type determinant = Determinant();
+
+			ASSERT_DEBUG_ONLY( determinant != Type( 0 ) && "Matrix::Inverted(): The matrix is singular!" );
+
+			const Type one_over_determinant = Type( 1 ) / determinant;
+
+			return Matrix
+			(
+				{
+					( m[ 1 ][ 1 ] * m[ 2 ][ 2 ] - m[ 1 ][ 2 ] * m[ 2 ][ 1 ] ) * one_over_determinant,
+					( m[ 0 ][ 2 ] * m[ 2 ][ 1 ] - m[ 0 ][ 1 ] * m[ 2 ][ 2 ] ) * one_over_determinant,
+					( m[ 0 ][ 1 ] * m[ 1 ][ 2 ] - m[ 0 ][ 2 ] * m[ 1 ][ 1 ] ) * one_over_determinant,
+
+					( m[ 1 ][ 2 ] * m[ 2 ][ 0 ] - m[ 1 ][ 0 ] * m[ 2 ][ 2 ] ) * one_over_determinant,
+					( m[ 0 ][ 0 ] * m[ 2 ][ 2 ] - m[ 0 ][ 2 ] * m[ 2 ][ 0 ] ) * one_over_determinant,
+					( m[ 0 ][ 2 ] * m[ 1 ][ 0 ] - m[ 0 ][ 0 ] * m[ 1 ][ 2 ] ) * one_over_determinant,
+
+					( m[ 1 ][ 0 ] * m[ 2 ][ 1 ] - m[ 1 ][ 1 ] * m[ 2 ][ 0 ] ) * one_over_determinant,
+					( m[ 0 ][ 1 ] * m[ 2 ][ 0 ] - m[ 0 ][ 0 ] * m[ 2 ][ 1 ] ) * one_over_determinant,
+					( m[ 0 ][ 0 ] * m[ 1 ][ 1 ] - m[ 0 ][ 1 ] * m[ 1 ][ 0 ] ) * one_over_determinant
+				}
+			);
+		}
+
+		/* General inverse; The matrix must not be singular. */
+		constexpr Matrix Inverted() const requires( std::is_floating_point_v< Type > && RowSize == 4 && ColumnSize == 4 )
+		{
+#if defined( SIMD_SSE2 )
+			if constexpr( IsFloat4x4() )
+			{
+				if( not std::is_constant_evaluated() )
+				{
+					Matrix result( NO_INITIALIZATION );
+					if( SIMD::Matrix4x4_Inverse( &data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] ) )
+						return result;
+				}
+			}
+#endif // SIMD_SSE2
+
+			/* Laplace expansion, via the 2x2 sub-determinants of the upper (s) & lower (c) two rows. */
+			const auto& m = data;
+
+			const Type s0 = m[ 0 ][ 0 ] * m[ 1 ][ 1 ] - m[ 1 ][ 0 ] * m[ 0 ][ 1 ];
+			const Type s1 = m[ 0 ][ 0 ] * m[ 1 ][ 2 ] - m[ 1 ][ 0 ] * m[ 0 ][ 2 ];
+			const Type s2 = m[ 0 ][ 0 ] * m[ 1 ][ 3 ] - m[ 1 ][ 0 ] * m[ 0 ][ 3 ];
+			const Type s3 = m[ 0 ][ 1 ] * m[ 1 ][ 2 ] - m[ 1 ][ 1 ] * m[ 0 ][ 2 ];
+			const Type s4 = m[ 0 ][ 1 ] * m[ 1 ][ 3 ] - m[ 1 ][ 1 ] * m[ 0 ][ 3 ];
+			const Type s5 = m[ 0 ][ 2 ] * m[ 1 ][ 3 ] - m[ 1 ][ 2 ] * m[ 0 ][ 3 ];
+
+			const Type c5 = m[ 2 ][ 2 ] * m[ 3 ][ 3 ] - m[ 3 ][ 2 ] * m[ 2 ][ 3 ];
+			const Type c4 = m[ 2 ][ 1 ] * m[ 3 ][ 3 ] - m[ 3 ][ 1 ] * m[ 2 ][ 3 ];
+			const Type c3 = m[ 2 ][ 1 ] * m[ 3 ][ 2 ] - m[ 3 ][ 1 ] * m[ 2 ][ 2 ];
+			const Type c2 = m[ 2 ][ 0 ] * m[ 3 ][ 3 ] - m[ 3 ][ 0 ] * m[ 2 ][ 3 ];
+			const Type c1 = m[ 2 ][ 0 ] * m[ 3 ][ 2 ] - m[ 3 ][ 0 ] * m[ 2 ][ 2 ];
+			const Type c0 = m[ 2 ][ 0 ] * m[ 3 ][ 1 ] - m[ 3 ][ 0 ] * m[ 2 ][ 1 ];
+
+			const Type determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+			ASSERT_DEBUG_ONLY( determinant != Type( 0 ) && "Matrix::Inverted(): The matrix is singular!" );
+
+			const Type one_over_determinant = Type( 1 ) / determinant;
+
+			return Matrix
+			(
+				{
+					( +m[ 1 ][ 1 ] * c5 - m[ 1 ][ 2 ] * c4 + m[ 1 ][ 3 ] * c3 ) * one_over_determinant,
+					( -m[ 0 ][ 1 ] * c5 + m[ 0 ][ 2 ] * c4 - m[ 0 ][ 3 ] * c3 ) * one_over_determinant,
+					( +m[ 3 ][ 1 ] * s5 - m[ 3 ][ 2 ] * s4 + m[ 3 ][ 3 ] * s3 ) * one_over_determinant,
+					( -m[ 2 ][ 1 ] * s5 + m[ 2 ][ 2 ] * s4 - m[ 2 ][ 3 ] * s3 ) * one_over_determinant,
+
+					( -m[ 1 ][ 0 ] * c5 + m[ 1 ][ 2 ] * c2 - m[ 1 ][ 3 ] * c1 ) * one_over_determinant,
+					( +m[ 0 ][ 0 ] * c5 - m[ 0 ][ 2 ] * c2 + m[ 0 ][ 3 ] * c1 ) * one_over_determinant,
+					( -m[ 3 ][ 0 ] * s5 + m[ 3 ][ 2 ] * s2 - m[ 3 ][ 3 ] * s1 ) * one_over_determinant,
+					( +m[ 2 ][ 0 ] * s5 - m[ 2 ][ 2 ] * s2 + m[ 2 ][ 3 ] * s1 ) * one_over_determinant,
+
+					( +m[ 1 ][ 0 ] * c4 - m[ 1 ][ 1 ] * c2 + m[ 1 ][ 3 ] * c0 ) * one_over_determinant,
+					( -m[ 0 ][ 0 ] * c4 + m[ 0 ][ 1 ] * c2 - m[ 0 ][ 3 ] * c0 ) * one_over_determinant,
+					( +m[ 3 ][ 0 ] * s4 - m[ 3 ][ 1 ] * s2 + m[ 3 ][ 3 ] * s0 ) * one_over_determinant,
+					( -m[ 2 ][ 0 ] * s4 + m[ 2 ][ 1 ] * s2 - m[ 2 ][ 3 ] * s0 ) * one_over_determinant,
+
+					( -m[ 1 ][ 0 ] * c3 + m[ 1 ][ 1 ] * c1 - m[ 1 ][ 2 ] * c0 ) * one_over_determinant,
+					( +m[ 0 ][ 0 ] * c3 - m[ 0 ][ 1 ] * c1 + m[ 0 ][ 2 ] * c0 ) * one_over_determinant,
+					( -m[ 3 ][ 0 ] * s3 + m[ 3 ][ 1 ] * s1 - m[ 3 ][ 2 ] * s0 ) * one_over_determinant,
+					( +m[ 2 ][ 0 ] * s3 - m[ 2 ][ 1 ] * s1 + m[ 2 ][ 2 ] * s0 ) * one_over_determinant
+				}
+			);
+		}
+
+		/* Cheaper inverse for affine transformations, i.e., the last column is ( 0, 0, 0, 1 ). The upper 3x3 part may contain scaling & shear, but must not be singular. */
+		constexpr Matrix InvertedAffine() const requires( std::is_floating_point_v< Type > && RowSize == 4 && ColumnSize == 4 )
+		{
+			ASSERT_DEBUG_ONLY( data[ 0 ][ 3 ] == Type( 0 ) && data[ 1 ][ 3 ] == Type( 0 ) && data[ 2 ][ 3 ] == Type( 0 ) && data[ 3 ][ 3 ] == Type( 1 ) &&
+							   "Matrix::InvertedAffine(): The matrix is not affine!" );
+
+#if defined( SIMD_SSE2 )
+			if constexpr( IsFloat4x4() )
+			{
+				if( not std::is_constant_evaluated() )
+				{
+					Matrix result( NO_INITIALIZATION );
+					if( SIMD::Matrix4x4_InverseAffine( &data[ 0 ][ 0 ], &result.data[ 0 ][ 0 ] ) )
+						return result;
+				}
+			}
+#endif // SIMD_SSE2
+
+			const Matrix< Type, 3, 3 > linear_part_inverse( SubMatrix< 3 >().Inverted() );
+			const Vector< Type, 3 > translation( data[ 3 ][ 0 ], data[ 3 ][ 1 ], data[ 3 ][ 2 ] );
+
+			return Matrix( linear_part_inverse, -translation * linear_part_inverse );
+		}
+
 		constexpr Type Trace() const requires( RowSize == ColumnSize )
 		{
 			Type result( 0 );
@@ -343,6 +487,18 @@ namespace Kakadu::Math
 	template< Concepts::Arithmetic Type, std::size_t RowSize, std::size_t ColumnSize >
 	constexpr Vector< Type, RowSize > operator* ( const Vector< Type, RowSize >& vector, const Matrix< Type, RowSize, ColumnSize >& matrix )
 	{
+#if defined( SIMD_SSE2 ) || defined( SIMD_NEON )
+		if constexpr( Matrix< Type, RowSize, ColumnSize >::IsFloat4x4() )
+		{
+			if( not std::is_constant_evaluated() )
+			{
+				Vector< Type, RowSize > vector_transformed( NO_INITIALIZATION );
+				SIMD::Matrix4x4_TransformRowVector( &vector[ 0 ], &matrix.data[ 0 ][ 0 ], &vector_transformed[ 0 ] );
+				return vector_transformed;
+			}
+		}
+#endif // SIMD_SSE2 || SIMD_NEON
+
 		Vector< Type, RowSize > vector_transformed;
 		for( auto j = 0; j < ColumnSize; j++ )
 			for( auto k = 0; k < RowSize; k++ )
@@ -5,9 +5,13 @@
 #include "Angle.hpp"
 #include "Concepts_Math.h"
 #include "Math.hpp"
+#include "SIMD.hpp"
 #include "TypeTraits.h"
 #include "Vector.hpp"
 
+// std Includes.
+#include <type_traits>
+
 namespace Kakadu::Math
 {
 /* Forward Declarations. */
@@ -402,6 +406,20 @@ namespace Kakadu::Math
 		ASSERT_DEBUG_ONLY( q1.IsNormalized() && R"(Quaternion::Slerp() : The quaternion q1 is not normalized!)" );
 		ASSERT_DEBUG_ONLY( q2.IsNormalized() && R"(Quaternion::Slerp() : The quaternion q2 is not normalized!)" );
 
+#if defined( SIMD_SSE2 )
+		if constexpr( std::is_same_v< ComponentType, float > )
+		{
+			if( not std::is_constant_evaluated() )
+			{
+				static_assert( sizeof( Quaternion< float > ) == 4 * sizeof( float ), "The vectorized path expects x, y, z & w to be tightly packed." );
+
+				Quaternion< ComponentType > result;
+				SIMD::QuaternionSlerp( &q1.x, &q2.x, t, Kakadu::TypeTraits< ComponentType >::OneMinusEpsilon(), &result.x );
+				return result;
+			}
+		}
+#endif // SIMD_SSE2
+
 		using RadiansType = Radians< ComponentType >;
 
 		const auto dot = Math::Dot( q1, q2 );
@@ -433,6 +451,20 @@ namespace Kakadu::Math
 	{
 		ASSERT_DEBUG_ONLY( quaternion.IsNormalized() && R"(Math::QuaternionToMatrix(): The quaternion is not normalized!)" );
 
+#if defined( SIMD_SSE2 )
+		if constexpr( std::is_same_v< ComponentType, float > )
+		{
+			if( not std::is_constant_evaluated() )
+			{
+				static_assert( sizeof( Quaternion< float > ) == 4 * sizeof( float ), "The vectorized path expects x, y, z & w to be tightly packed." );
+
+				Matrix< ComponentType, 4, 4 > result( NO_INITIALIZATION );
+				SIMD::QuaternionToMatrix4x4( &quaternion.x, result[ 0 ] );
+				return result;
+			}
+		}
+#endif // SIMD_SSE2
+
 		const auto two_x2  = ComponentType( 2 ) * quaternion.x * quaternion.x;
 		const auto two_y2  = ComponentType( 2 ) * quaternion.y * quaternion.y;
 		const auto two_z2  = ComponentType( 2 ) * quaternion.z * quaternion.z;
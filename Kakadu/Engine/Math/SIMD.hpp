@@ -0,0 +1,351 @@
+#pragma once
+
+/* Vectorized implementations of the hottest 4x4 float matrix & quaternion operations.
+ * Not meant to be used directly; Matrix & Quaternion dispatch here at run-time (never during constant evaluation) & fall back to their generic code otherwise.
+ * All matrices are row-major float[ 16 ]; Quaternions are float[ 4 ] in x, y, z, w order.
+ *
+ * SSE2 is the x64 baseline & is always used there. Building with /arch:AVX2 (or -mavx2 -mfma) additionally enables the AVX2/FMA matrix multiplication.
+ * On ARM64, NEON covers multiplication, transposition & vector transformation; The rest uses the generic code. */
+
+#if defined( _M_X64 ) || defined( __x86_64__ ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) || defined( __SSE2__ )
+#define SIMD_SSE2
+#if defined( __AVX2__ )
+#define SIMD_AVX2
+#endif // __AVX2__
+#elif defined( _M_ARM64 ) || defined( __ARM_NEON )
+#define SIMD_NEON
+#endif
+
+#if defined( SIMD_SSE2 )
+// SSE/AVX Includes.
+#include <immintrin.h>
+#elif defined( SIMD_NEON )
+// NEON Includes.
+#include <arm_neon.h>
+#endif
+
+// Engine Includes.
+#include "Core/Macros.h"
+
+// std Includes.
+#include <cmath>
+
+namespace Kakadu::Math::SIMD
+{
+#if defined( SIMD_SSE2 )
+
+/* Helpers: */
+
+	#define SIMD_SHUFFLE_MASK( x, y, z, w ) ( ( x ) | ( ( y ) << 2 ) | ( ( z ) << 4 ) | ( ( w ) << 6 ) )
+	/* ( a[ x ], a[ y ], b[ z ], b[ w ] ). */
+	#define SIMD_SHUFFLE( a, b, x, y, z, w ) _mm_shuffle_ps( a, b, SIMD_SHUFFLE_MASK( x, y, z, w ) )
+	#define SIMD_SWIZZLE( a, x, y, z, w )	 _mm_shuffle_ps( a, a, SIMD_SHUFFLE_MASK( x, y, z, w ) )
+	#define SIMD_SPLAT( a, x )				 _mm_shuffle_ps( a, a, SIMD_SHUFFLE_MASK( x, x, x, x ) )
+
+	/* Row-vector * matrix: v.x * row_0 + v.y * row_1 + v.z * row_2 + v.w * row_3. */
+	header_function __m128 TransformRow( const __m128 vector, const __m128 row_0, const __m128 row_1, const __m128 row_2, const __m128 row_3 )
+	{
+		return _mm_add_ps( _mm_add_ps( _mm_mul_ps( SIMD_SPLAT( vector, 0 ), row_0 ), _mm_mul_ps( SIMD_SPLAT( vector, 1 ), row_1 ) ),
+						   _mm_add_ps( _mm_mul_ps( SIMD_SPLAT( vector, 2 ), row_2 ), _mm_mul_ps( SIMD_SPLAT( vector, 3 ), row_3 ) ) );
+	}
+
+	header_function __m128 Dot4( const __m128 a, const __m128 b )
+	{
+		__m128 products = _mm_mul_ps( a, b );
+		products = _mm_add_ps( products, SIMD_SWIZZLE( products, 1, 0, 3, 2 ) );
+		return	   _mm_add_ps( products, SIMD_SWIZZLE( products, 2, 3, 0, 1 ) ); // Sum in all lanes.
+	}
+
+	/* 2x2 row-major matrices packed as ( m00, m01, m10, m11 ). */
+
+	/* A * B. */
+	header_function __m128 Matrix2x2_Multiply( const __m128 a, const __m128 b )
+	{
+		return _mm_add_ps( _mm_mul_ps( a, SIMD_SWIZZLE( b, 0, 3, 0, 3 ) ),
+						   _mm_mul_ps( SIMD_SWIZZLE( a, 1, 0, 3, 2 ), SIMD_SWIZZLE( b, 2, 1, 2, 1 ) ) );
+	}
+
+	/* Adjugate( A ) * B. */
+	header_function __m128 Matrix2x2_AdjugateMultiply( const __m128 a, const __m128 b )
+	{
+		return _mm_sub_ps( _mm_mul_ps( SIMD_SWIZZLE( a, 3, 3, 0, 0 ), b ),
+						   _mm_mul_ps( SIMD_SWIZZLE( a, 1, 1, 2, 2 ), SIMD_SWIZZLE( b, 2, 3, 0, 1 ) ) );
+	}
+
+	/* A * Adjugate( B ). */
+	header_function __m128 Matrix2x2_MultiplyAdjugate( const __m128 a, const __m128 b )
+	{
+		return _mm_sub_ps( _mm_mul_ps( a, SIMD_SWIZZLE( b, 3, 0, 3, 0 ) ),
+						   _mm_mul_ps( SIMD_SWIZZLE( a, 1, 0, 3, 2 ), SIMD_SWIZZLE( b, 2, 1, 2, 1 ) ) );
+	}
+
+	/* ( a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x, 0 ) if the w components are zero. */
+	header_function __m128 Cross3( const __m128 a, const __m128 b )
+	{
+		const __m128 a_yzx = SIMD_SWIZZLE( a, 1, 2, 0, 3 );
+		const __m128 b_yzx = SIMD_SWIZZLE( b, 1, 2, 0, 3 );
+		return SIMD_SWIZZLE( _mm_sub_ps( _mm_mul_ps( a, b_yzx ), _mm_mul_ps( a_yzx, b ) ), 1, 2, 0, 3 );
+	}
+
+/* Matrix4x4: */
+
+	/* result must not alias b. */
+	header_function void Matrix4x4_Multiply( const float* a, const float* b, float* result )
+	{
+	#if defined( SIMD_AVX2 )
+		/* Two rows of the result at a time: Each 128-bit lane works on one row of a, against the same (broadcast) rows of b. */
+		const __m256 b_row_0 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( b +  0 ) );
+		const __m256 b_row_1 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( b +  4 ) );
+		const __m256 b_row_2 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( b +  8 ) );
+		const __m256 b_row_3 = _mm256_broadcast_ps( reinterpret_cast< const __m128* >( b + 12 ) );
+
+		for( int row_pair_index = 0; row_pair_index < 2; row_pair_index++ )
+		{
+			const __m256 a_rows = _mm256_loadu_ps( a + row_pair_index * 8 );
+
+			__m256 rows = _mm256_mul_ps( _mm256_shuffle_ps( a_rows, a_rows, SIMD_SHUFFLE_MASK( 0, 0, 0, 0 ) ), b_row_0 );
+			rows = _mm256_fmadd_ps( _mm256_shuffle_ps( a_rows, a_rows, SIMD_SHUFFLE_MASK( 1, 1, 1, 1 ) ), b_row_1, rows );
+			rows = _mm256_fmadd_ps( _mm256_shuffle_ps( a_rows, a_rows, SIMD_SHUFFLE_MASK( 2, 2, 2, 2 ) ), b_row_2, rows );
+			rows = _mm256_fmadd_ps( _mm256_shuffle_ps( a_rows, a_rows, SIMD_SHUFFLE_MASK( 3, 3, 3, 3 ) ), b_row_3, rows );
+
+			_mm256_storeu_ps( result + row_pair_index * 8, rows );
+		}
+	#else
+		const __m128 b_row_0 = _mm_loadu_ps( b +  0 );
+		const __m128 b_row_1 = _mm_loadu_ps( b +  4 );
+		const __m128 b_row_2 = _mm_loadu_ps( b +  8 );
+		const __m128 b_row_3 = _mm_loadu_ps( b + 12 );
+
+		for( int row_index = 0; row_index < 4; row_index++ )
+			_mm_storeu_ps( result + row_index * 4, TransformRow( _mm_loadu_ps( a + row_index * 4 ), b_row_0, b_row_1, b_row_2, b_row_3 ) );
+	#endif // SIMD_AVX2
+	}
+
+	header_function void Matrix4x4_Transpose( const float* matrix, float* result )
+	{
+		__m128 row_0 = _mm_loadu_ps( matrix +  0 );
+		__m128 row_1 = _mm_loadu_ps( matrix +  4 );
+		__m128 row_2 = _mm_loadu_ps( matrix +  8 );
+		__m128 row_3 = _mm_loadu_ps( matrix + 12 );
+
+		_MM_TRANSPOSE4_PS( row_0, row_1, row_2, row_3 );
+
+		_mm_storeu_ps( result +  0, row_0 );
+		_mm_storeu_ps( result +  4, row_1 );
+		_mm_storeu_ps( result +  8, row_2 );
+		_mm_storeu_ps( result + 12, row_3 );
+	}
+
+	/* General inverse via 2x2 blocks: M = | A B |
+	 *									   | C D |
+	 * Returns false (& leaves result untouched) if the matrix is singular. */
+	header_function bool Matrix4x4_Inverse( const float* matrix, float* result )
+	{
+		const __m128 row_0 = _mm_loadu_ps( matrix +  0 );
+		const __m128 row_1 = _mm_loadu_ps( matrix +  4 );
+		const __m128 row_2 = _mm_loadu_ps( matrix +  8 );
+		const __m128 row_3 = _mm_loadu_ps( matrix + 12 );
+
+		const __m128 a = _mm_movelh_ps( row_0, row_1 );
+		const __m128 b = _mm_movehl_ps( row_1, row_0 );
+		const __m128 c = _mm_movelh_ps( row_2, row_3 );
+		const __m128 d = _mm_movehl_ps( row_3, row_2 );
+
+		/* ( |A|, |B|, |C|, |D| ). */
+		const __m128 sub_determinants = _mm_sub_ps( _mm_mul_ps( SIMD_SHUFFLE( row_0, row_2, 0, 2, 0, 2 ), SIMD_SHUFFLE( row_1, row_3, 1, 3, 1, 3 ) ),
+													_mm_mul_ps( SIMD_SHUFFLE( row_0, row_2, 1, 3, 1, 3 ), SIMD_SHUFFLE( row_1, row_3, 0, 2, 0, 2 ) ) );
+		const __m128 determinant_a = SIMD_SPLAT( sub_determinants, 0 );
+		const __m128 determinant_b = SIMD_SPLAT( sub_determinants, 1 );
+		const __m128 determinant_c = SIMD_SPLAT( sub_determinants, 2 );
+		const __m128 determinant_d = SIMD_SPLAT( sub_determinants, 3 );
+
+		const __m128 d_adj_c = Matrix2x2_AdjugateMultiply( d, c );
+		const __m128 a_adj_b = Matrix2x2_AdjugateMultiply( a, b );
+
+		/* Adjugates of the inverse's blocks (up to the determinant). */
+		__m128 x = _mm_sub_ps( _mm_mul_ps( determinant_d, a ), Matrix2x2_Multiply( b, d_adj_c ) );
+		__m128 w = _mm_sub_ps( _mm_mul_ps( determinant_a, d ), Matrix2x2_Multiply( c, a_adj_b ) );
+		__m128 y = _mm_sub_ps( _mm_mul_ps( determinant_b, c ), Matrix2x2_MultiplyAdjugate( d, a_adj_b ) );
+		__m128 z = _mm_sub_ps( _mm_mul_ps( determinant_c, b ), Matrix2x2_MultiplyAdjugate( a, d_adj_c ) );
+
+		/* |M| = |A||D| + |B||C| - trace( Adjugate( A ) B Adjugate( D ) C ). */
+		const __m128 trace = Dot4( a_adj_b, SIMD_SWIZZLE( d_adj_c, 0, 2, 1, 3 ) );
+		const __m128 determinant = _mm_sub_ps( _mm_add_ps( _mm_mul_ps( determinant_a, determinant_d ), _mm_mul_ps( determinant_b, determinant_c ) ), trace );
+
+		if( _mm_cvtss_f32( determinant ) == 0.0f )
+			return false;
+
+		const __m128 one_over_determinant_signed = _mm_div_ps( _mm_setr_ps( 1.0f, -1.0f, -1.0f, 1.0f ), determinant );
+
+		x = _mm_mul_ps( x, one_over_determinant_signed );
+		y = _mm_mul_ps( y, one_over_determinant_signed );
+		z = _mm_mul_ps( z, one_over_determinant_signed );
+		w = _mm_mul_ps( w, one_over_determinant_signed );
+
+		/* Apply the adjugates' swizzle while assembling the rows. */
+		_mm_storeu_ps( result +  0, SIMD_SHUFFLE( x, y, 3, 1, 3, 1 ) );
+		_mm_storeu_ps( result +  4, SIMD_SHUFFLE( x, y, 2, 0, 2, 0 ) );
+		_mm_storeu_ps( result +  8, SIMD_SHUFFLE( z, w, 3, 1, 3, 1 ) );
+		_mm_storeu_ps( result + 12, SIMD_SHUFFLE( z, w, 2, 0, 2, 0 ) );
+
+		return true;
+	}
+
+	/* For affine matrices (last column = ( 0, 0, 0, 1 )), with arbitrary (even sheared) upper 3x3 parts:
+	 *	| L  0 |^-1   |  L^-1      0 |
+	 *	| t  1 |	= | -t L^-1    1 |
+	 * Returns false (& leaves result untouched) if the upper 3x3 part is singular. */
+	header_function bool Matrix4x4_InverseAffine( const float* matrix, float* result )
+	{
+		const __m128 mask_xyz = _mm_castsi128_ps( _mm_setr_epi32( -1, -1, -1, 0 ) );
+
+		const __m128 row_0       = _mm_and_ps( _mm_loadu_ps( matrix +  0 ), mask_xyz );
+		const __m128 row_1       = _mm_and_ps( _mm_loadu_ps( matrix +  4 ), mask_xyz );
+		const __m128 row_2       = _mm_and_ps( _mm_loadu_ps( matrix +  8 ), mask_xyz );
+		const __m128 translation = _mm_and_ps( _mm_loadu_ps( matrix + 12 ), mask_xyz );
+
+		/* Columns of L^-1 are the cross products of L's rows, over the determinant. */
+		__m128 inverse_row_0 = Cross3( row_1, row_2 );
+		__m128 inverse_row_1 = Cross3( row_2, row_0 );
+		__m128 inverse_row_2 = Cross3( row_0, row_1 );
+		__m128 zero			 = _mm_setzero_ps();
+
+		const __m128 determinant = Dot4( row_0, inverse_row_0 );
+
+		if( _mm_cvtss_f32( determinant ) == 0.0f )
+			return false;
+
+		_MM_TRANSPOSE4_PS( inverse_row_0, inverse_row_1, inverse_row_2, zero );
+
+		const __m128 one_over_determinant = _mm_div_ps( _mm_set1_ps( 1.0f ), determinant );
+
+		inverse_row_0 = _mm_mul_ps( inverse_row_0, one_over_determinant );
+		inverse_row_1 = _mm_mul_ps( inverse_row_1, one_over_determinant );
+		inverse_row_2 = _mm_mul_ps( inverse_row_2, one_over_determinant );
+
+		const __m128 inverse_translation = _mm_sub_ps( _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f ),
+													   TransformRow( translation, inverse_row_0, inverse_row_1, inverse_row_2, _mm_setzero_ps() ) );
+
+		_mm_storeu_ps( result +  0, inverse_row_0 );
+		_mm_storeu_ps( result +  4, inverse_row_1 );
+		_mm_storeu_ps( result +  8, inverse_row_2 );
+		_mm_storeu_ps( result + 12, inverse_translation );
+
+		return true;
+	}
+
+	/* result = vector * matrix. */
+	header_function void Matrix4x4_TransformRowVector( const float* vector, const float* matrix, float* result )
+	{
+		_mm_storeu_ps( result, TransformRow( _mm_loadu_ps( vector ),
+											 _mm_loadu_ps( matrix + 0 ), _mm_loadu_ps( matrix + 4 ), _mm_loadu_ps( matrix + 8 ), _mm_loadu_ps( matrix + 12 ) ) );
+	}
+
+/* Quaternion: */
+
+	header_function void QuaternionToMatrix4x4( const float* quaternion, float* result )
+	{
+		const __m128 mask_xyz = _mm_castsi128_ps( _mm_setr_epi32( -1, -1, -1, 0 ) );
+
+		const __m128 q		   = _mm_loadu_ps( quaternion );
+		const __m128 q_doubled = _mm_add_ps( q, q );
+
+		/* ( 2yy, 2xx, 2xx ) + ( 2zz, 2zz, 2yy ). */
+		const __m128 squares = _mm_add_ps( _mm_mul_ps( SIMD_SWIZZLE( q, 1, 0, 0, 3 ), SIMD_SWIZZLE( q_doubled, 1, 0, 0, 3 ) ),
+										   _mm_mul_ps( SIMD_SWIZZLE( q, 2, 2, 1, 3 ), SIMD_SWIZZLE( q_doubled, 2, 2, 1, 3 ) ) );
+		/* ( 2xy, 2xz, 2yz ) & ( 2wz, 2wy, 2wx ). */
+		const __m128 mixed		= _mm_mul_ps( SIMD_SWIZZLE( q, 0, 0, 1, 3 ), SIMD_SWIZZLE( q_doubled, 1, 2, 2, 3 ) );
+		const __m128 mixed_by_w = _mm_mul_ps( SIMD_SPLAT( q, 3 ), SIMD_SWIZZLE( q_doubled, 2, 1, 0, 3 ) );
+
+		const __m128 diagonal = _mm_and_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), squares ), mask_xyz ); // ( m00, m11, m22, 0 ).
+		const __m128 sum	  = _mm_and_ps( _mm_add_ps( mixed, mixed_by_w ), mask_xyz );			  // ( m01, m20, m12, 0 ).
+		const __m128 difference = _mm_and_ps( _mm_sub_ps( mixed, mixed_by_w ), mask_xyz );		  // ( m10, m02, m21, 0 ).
+
+		_mm_storeu_ps( result +  0, SIMD_SHUFFLE( SIMD_SHUFFLE( diagonal, sum, 0, 0, 0, 0 ), difference, 0, 2, 1, 3 ) );
+		_mm_storeu_ps( result +  4, SIMD_SHUFFLE( SIMD_SHUFFLE( difference, diagonal, 0, 0, 1, 1 ), sum, 0, 2, 2, 3 ) );
+		_mm_storeu_ps( result +  8, SIMD_SHUFFLE( SIMD_SHUFFLE( sum, difference, 1, 1, 2, 2 ), diagonal, 0, 2, 2, 3 ) );
+		_mm_storeu_ps( result + 12, _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f ) );
+	}
+
+	/* Shortest-arc spherical interpolation of unit quaternions; Falls back to normalized linear interpolation when they are too close. */
+	header_function void QuaternionSlerp( const float* quaternion_1, const float* quaternion_2, const float t, const float one_minus_epsilon, float* result )
+	{
+		const __m128 q1 = _mm_loadu_ps( quaternion_1 );
+		__m128		 q2 = _mm_loadu_ps( quaternion_2 );
+
+		const float dot = _mm_cvtss_f32( Dot4( q1, q2 ) );
+
+		/* Negate one of the input quaternions, to take the shorter 4D "arc". */
+		if( dot < 0.0f )
+			q2 = _mm_sub_ps( _mm_setzero_ps(), q2 );
+
+		const float cos_theta = std::fabs( dot );
+
+		__m128 interpolated;
+		if( cos_theta > one_minus_epsilon )
+		{
+			interpolated = _mm_add_ps( q1, _mm_mul_ps( _mm_set1_ps( t ), _mm_sub_ps( q2, q1 ) ) );
+			interpolated = _mm_div_ps( interpolated, _mm_sqrt_ps( Dot4( interpolated, interpolated ) ) );
+		}
+		else
+		{
+			const float sin_theta		   = std::sqrt( 1.0f - cos_theta * cos_theta );
+			const float theta			   = std::atan2( sin_theta, cos_theta );
+			const float one_over_sin_theta = 1.0f / sin_theta;
+
+			interpolated = _mm_add_ps( _mm_mul_ps( q1, _mm_set1_ps( std::sin( ( 1.0f - t ) * theta ) * one_over_sin_theta ) ),
+									   _mm_mul_ps( q2, _mm_set1_ps( std::sin( t * theta ) * one_over_sin_theta ) ) );
+		}
+
+		_mm_storeu_ps( result, interpolated );
+	}
+
+	#undef SIMD_SHUFFLE_MASK
+	#undef SIMD_SHUFFLE
+	#undef SIMD_SWIZZLE
+	#undef SIMD_SPLAT
+
+#elif defined( SIMD_NEON )
+
+/* Matrix4x4: */
+
+	header_function float32x4_t TransformRow( const float32x4_t vector, const float32x4_t row_0, const float32x4_t row_1, const float32x4_t row_2, const float32x4_t row_3 )
+	{
+		float32x4_t result = vmulq_laneq_f32( row_0, vector, 0 );
+		result = vfmaq_laneq_f32( result, row_1, vector, 1 );
+		result = vfmaq_laneq_f32( result, row_2, vector, 2 );
+		return	 vfmaq_laneq_f32( result, row_3, vector, 3 );
+	}
+
+	/* result must not alias b. */
+	header_function void Matrix4x4_Multiply( const float* a, const float* b, float* result )
+	{
+		const float32x4_t b_row_0 = vld1q_f32( b +  0 );
+		const float32x4_t b_row_1 = vld1q_f32( b +  4 );
+		const float32x4_t b_row_2 = vld1q_f32( b +  8 );
+		const float32x4_t b_row_3 = vld1q_f32( b + 12 );
+
+		for( int row_index = 0; row_index < 4; row_index++ )
+			vst1q_f32( result + row_index * 4, TransformRow( vld1q_f32( a + row_index * 4 ), b_row_0, b_row_1, b_row_2, b_row_3 ) );
+	}
+
+	header_function void Matrix4x4_Transpose( const float* matrix, float* result )
+	{
+		/* De-interleaving load: The i'th register receives every 4th element starting from i, i.e., the i'th column. */
+		const float32x4x4_t columns = vld4q_f32( matrix );
+
+		vst1q_f32( result +  0, columns.val[ 0 ] );
+		vst1q_f32( result +  4, columns.val[ 1 ] );
+		vst1q_f32( result +  8, columns.val[ 2 ] );
+		vst1q_f32( result + 12, columns.val[ 3 ] );
+	}
+
+	/* result = vector * matrix. */
+	header_function void Matrix4x4_TransformRowVector( const float* vector, const float* matrix, float* result )
+	{
+		vst1q_f32( result, TransformRow( vld1q_f32( vector ),
+										 vld1q_f32( matrix + 0 ), vld1q_f32( matrix + 4 ), vld1q_f32( matrix + 8 ), vld1q_f32( matrix + 12 ) ) );
+	}
+
+#endif // SIMD_SSE2 / SIMD_NEON
+}
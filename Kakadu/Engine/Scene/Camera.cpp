@@ -11,14 +11,22 @@ namespace Kakadu
 		plane_far( far_plane ),
 		aspect_ratio( aspect_ratio ),
 		vertical_field_of_view( vertical_field_of_view ),
-		projection_matrix_needs_update( true )
+		transform_version_last_seen( 0 ),
+		projection_matrix_needs_update( true ),
+		view_projection_matrix_needs_update( true )
 	{}
 
 /* Matrix Getters: */
 
 	const Matrix4x4& Camera::GetViewMatrix()
 	{
-		view_matrix = transform->GetInverseOfFinalMatrix_NoScale();
+		if( transform->Version() != transform_version_last_seen )
+		{
+			view_matrix = transform->GetInverseOfFinalMatrix_NoScale();
+
+			transform_version_last_seen         = transform->Version();
+			view_projection_matrix_needs_update = true;
+		}
 
 		return view_matrix;
 	}
@@ -38,7 +46,15 @@ namespace Kakadu
 	
 	const Matrix4x4& Camera::GetViewProjectionMatrix()
 	{
-		view_projection_matrix = GetViewMatrix() * GetProjectionMatrix();
+		/* Both may set view_projection_matrix_needs_update. */
+		GetViewMatrix();
+		GetProjectionMatrix();
+
+		if( view_projection_matrix_needs_update )
+		{
+			view_projection_matrix = view_matrix * projection_matrix;
+			view_projection_matrix_needs_update = false;
+		}
 
 		return view_projection_matrix;
 	}
@@ -149,11 +165,12 @@ namespace Kakadu
 
 	void Camera::SetProjectionMatrixDirty()
 	{
-		projection_matrix_needs_update = true;
+		projection_matrix_needs_update = view_projection_matrix_needs_update = true;
 	}
 
 	void Camera::SetCustomProjectionMatrixDirty()
 	{
-		projection_matrix_needs_update = false;
+		projection_matrix_needs_update      = false;
+		view_projection_matrix_needs_update = true;
 	}
 }
@@ -72,14 +72,12 @@ namespace Kakadu
 		float aspect_ratio;
 		Radians vertical_field_of_view;
 
-		/* There are intentionally no view_matrix_needs_update / view_projection_matrix_needs_update flags:
-		 * GetViewMatrix() and GetViewProjectionMatrix() always recompute. The only way to know the view had changed used to be
-		 * Transform's is_dirty, which was an artefact => removed. With no way left to detect a transform change, a
-		 * projection-only dirty flag would leave the view-projection matrix stale whenever the camera moves, so it can not
-		 * be cached safely. projection_matrix_needs_update is kept because the projection changes only through explicit
-		 * setters, which it fully captures. To bring view-projection caching back in the future, a monotonic version
-		 * counter (bumped on mutation) could be added to Transform and the observes can cache the last-seen version and check that. */
+		/* The view matrix is recomputed only when the Transform's version differs from the last one seen (0 = never seen).
+		 * projection_matrix_needs_update is set by the projection setters, which fully capture projection changes.
+		 * view_projection_matrix_needs_update is set whenever either of the two changes. */
+		u32 transform_version_last_seen;
 		bool projection_matrix_needs_update;
-		/* 7 bytes of padding. */
+		bool view_projection_matrix_needs_update;
+		/* 2 bytes of padding. */
 	};
 }
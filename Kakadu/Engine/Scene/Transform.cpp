@@ -4,13 +4,21 @@
 
 #include "Transform.h"
 
+// std Includes.
+#include <atomic>
+
 namespace Kakadu
 {
+	/* Versions are drawn from a single global counter instead of being counted per Transform, so that assigning a (freshly constructed/copied)
+	 * Transform can never bring back a version an observer has already seen for different values. */
+	internal_variable std::atomic< u32 > VERSION_COUNTER = 0;
+
 	Transform::Transform()
 		:
 		scale( Vector3( 1.0f, 1.0f, 1.0f ) ),
 		translation( ZERO_INITIALIZATION ),
 		rotation(),
+		version( NextVersion() ),
 		scaling_needsUpdate( true ),
 		rotation_needsUpdate( true ),
 		translation_needsUpdate( true ),
@@ -23,6 +31,7 @@ namespace Kakadu
 		scale( scale ),
 		translation( ZERO_INITIALIZATION ),
 		rotation(),
+		version( NextVersion() ),
 		scaling_needsUpdate( true ),
 		rotation_needsUpdate( true ),
 		translation_needsUpdate( true ),
@@ -35,6 +44,7 @@ namespace Kakadu
 		scale( scale ),
 		translation( translation ),
 		rotation(),
+		version( NextVersion() ),
 		scaling_needsUpdate( true ),
 		rotation_needsUpdate( true ),
 		translation_needsUpdate( true ),
@@ -47,6 +57,7 @@ namespace Kakadu
 		scale( scale ),
 		translation( translation ),
 		rotation( rotation ),
+		version( NextVersion() ),
 		scaling_needsUpdate( true ),
 		rotation_needsUpdate( true ),
 		translation_needsUpdate( true ),
@@ -58,6 +69,11 @@ namespace Kakadu
 	{
 	}
 
+	u32 Transform::NextVersion()
+	{
+		return VERSION_COUNTER.fetch_add( 1, std::memory_order_relaxed ) + 1;
+	}
+
 	Transform& Transform::Reset()
 	{
 		return ResetScaling().ResetRotation().ResetTranslation();
@@ -87,6 +103,7 @@ namespace Kakadu
 	{
 		this->scale = new_scale;
 		scaling_needsUpdate = final_matrix_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
@@ -95,6 +112,7 @@ namespace Kakadu
 	{
 		this->scale.Set( new_x_scale, new_y_scale, new_z_scale );
 		scaling_needsUpdate = final_matrix_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
@@ -125,6 +143,7 @@ namespace Kakadu
 
 		this->rotation = new_rotation;
 		rotation_needsUpdate = final_matrix_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
@@ -163,6 +182,7 @@ namespace Kakadu
 	{
 		this->translation = new_translation;
 		translation_needsUpdate = final_matrix_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
@@ -171,6 +191,7 @@ namespace Kakadu
 	{
 		this->translation.Set( new_x, new_y, new_z );
 		translation_needsUpdate = final_matrix_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
@@ -204,6 +225,7 @@ namespace Kakadu
 		ASSERT_DEBUG_ONLY( Matrix::SRT( scale, rotation, translation ) == srt_matrix );
 
 		final_matrix_needsUpdate = scaling_needsUpdate = rotation_needsUpdate = translation_needsUpdate = true;
+		version = NextVersion();
 
 		return *this;
 	}
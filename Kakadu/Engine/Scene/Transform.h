@@ -82,6 +82,12 @@ namespace Kakadu
 		/* If the caller knows there's no scaling involved (for example; Transform of a Camera), calling this function is more preferrable, as it is cheaper to execute. */
 		const Matrix4x4 GetInverseOfFinalMatrix_NoScale();
 
+		/* Changes on every modification; Observers can cache whatever they derive from this Transform along with the version they last saw.
+		 * Drawn from a global monotonic counter (shared by all Transforms & never 0), so 0 can be used as "never seen". */
+		u32 Version() const { return version; }
+		/* Returns a fresh version from the global counter; Also used by TransformHierarchy, so versions of different sources never collide either. */
+		static u32 NextVersion();
+
 		const Vector3& Right();
 		const Vector3& Up();
 		const Vector3& Forward();
@@ -105,6 +111,8 @@ namespace Kakadu
 
 		Matrix4x4 final_matrix;
 
+		u32 version;
+
 		/* 4 flags below are for internal (Transform) use. */
 		bool scaling_needsUpdate;
 		bool rotation_needsUpdate;
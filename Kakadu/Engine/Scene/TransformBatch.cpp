@@ -0,0 +1,296 @@
+// Engine Includes.
+#include "TransformBatch.h"
+#include "Math/Matrix.h"
+#include "Math/SIMD.hpp"
+#include "Core/Assertion.h"
+#include "Core/JobSystem.h"
+#include "Core/ServiceLocator.hpp"
+
+// std Includes.
+#include <algorithm>
+
+namespace Kakadu::TransformBatch
+{
+	/* Large enough to amortize the scheduling overhead, small enough to keep every worker busy for a few thousand elements. Multiple of 8 (lane count). */
+	constexpr std::size_t PARALLEL_CHUNK_ELEMENT_COUNT = 1024;
+	/* Transforms are gathered into SoA arrays on the stack in blocks of this many elements. Multiple of 8 (lane count). */
+	constexpr std::size_t GATHER_BLOCK_ELEMENT_COUNT = 128;
+
+	static_assert( sizeof( Vector3 ) == 3 * sizeof( float ) && sizeof( Quaternion ) == 4 * sizeof( float ), "The vectorized paths expect tightly packed components." );
+	static_assert( sizeof( Matrix4x4 ) == 16 * sizeof( float ), "Matrix4x4 output is written to as a float array." );
+
+	internal_function void ComposeSingle( const Vector3& scale, const Quaternion& rotation, const Vector3& translation, float* output, const Layout layout )
+	{
+		Matrix4x4 srt_matrix;
+		Matrix::SRT( srt_matrix, scale, rotation, translation );
+
+		if( layout != Layout::RowMajor )
+			srt_matrix.Transpose();
+
+		std::copy_n( srt_matrix.Data(), FloatCountPerElement( layout ), output );
+	}
+
+#if defined( SIMD_SSE2 )
+
+/* Lane-count agnostic math, so that the same code serves 4 (SSE) & 8 (AVX) lanes: */
+
+	header_function __m128 Add( const __m128 a, const __m128 b ) { return _mm_add_ps( a, b ); }
+	header_function __m128 Sub( const __m128 a, const __m128 b ) { return _mm_sub_ps( a, b ); }
+	header_function __m128 Mul( const __m128 a, const __m128 b ) { return _mm_mul_ps( a, b ); }
+
+#if defined( SIMD_AVX2 )
+	header_function __m256 Add( const __m256 a, const __m256 b ) { return _mm256_add_ps( a, b ); }
+	header_function __m256 Sub( const __m256 a, const __m256 b ) { return _mm256_sub_ps( a, b ); }
+	header_function __m256 Mul( const __m256 a, const __m256 b ) { return _mm256_mul_ps( a, b ); }
+#endif // SIMD_AVX2
+
+	/* Computes the upper-left 3x3 part of Scale * Rotate for every lane, i.e., row i of the rotation matrix scaled by scale[ i ].
+	 * Translation needs no computation, as it is the last row as-is. */
+	template< typename Register >
+	internal_function void ComposeScaleRotation( const Register ( &scale )[ 3 ], const Register ( &rotation )[ 4 ], const Register one, Register ( &scale_rotation )[ 3 ][ 3 ] )
+	{
+		const Register& x = rotation[ 0 ];
+		const Register& y = rotation[ 1 ];
+		const Register& z = rotation[ 2 ];
+		const Register& w = rotation[ 3 ];
+
+		const Register two_x = Add( x, x );
+		const Register two_y = Add( y, y );
+		const Register two_z = Add( z, z );
+
+		const Register two_x2  = Mul( two_x, x );
+		const Register two_y2  = Mul( two_y, y );
+		const Register two_z2  = Mul( two_z, z );
+		const Register two_x_y = Mul( two_x, y );
+		const Register two_x_z = Mul( two_x, z );
+		const Register two_y_z = Mul( two_y, z );
+		const Register two_w_x = Mul( two_x, w );
+		const Register two_w_y = Mul( two_y, w );
+		const Register two_w_z = Mul( two_z, w );
+
+		scale_rotation[ 0 ][ 0 ] = Mul( scale[ 0 ], Sub( Sub( one, two_y2 ), two_z2 ) );
+		scale_rotation[ 0 ][ 1 ] = Mul( scale[ 0 ], Add( two_x_y, two_w_z ) );
+		scale_rotation[ 0 ][ 2 ] = Mul( scale[ 0 ], Sub( two_x_z, two_w_y ) );
+
+		scale_rotation[ 1 ][ 0 ] = Mul( scale[ 1 ], Sub( two_x_y, two_w_z ) );
+		scale_rotation[ 1 ][ 1 ] = Mul( scale[ 1 ], Sub( Sub( one, two_x2 ), two_z2 ) );
+		scale_rotation[ 1 ][ 2 ] = Mul( scale[ 1 ], Add( two_y_z, two_w_x ) );
+
+		scale_rotation[ 2 ][ 0 ] = Mul( scale[ 2 ], Add( two_x_z, two_w_y ) );
+		scale_rotation[ 2 ][ 1 ] = Mul( scale[ 2 ], Sub( two_y_z, two_w_x ) );
+		scale_rotation[ 2 ][ 2 ] = Mul( scale[ 2 ], Sub( Sub( one, two_x2 ), two_y2 ) );
+	}
+
+/* AoS <-> SoA conversion, 4 elements at a time: */
+
+	/* 4 packed Vector3s (3 loads) -> xxxx, yyyy, zzzz. */
+	internal_function void LoadVector3x4( const Vector3* vectors, __m128 ( &soa )[ 3 ] )
+	{
+		const float* components = &vectors[ 0 ][ 0 ];
+
+		const __m128 x0_y0_z0_x1 = _mm_loadu_ps( components );
+		const __m128 y1_z1_x2_y2 = _mm_loadu_ps( components + 4 );
+		const __m128 z2_x3_y3_z3 = _mm_loadu_ps( components + 8 );
+
+		/* Pair up each component of elements 0 & 1 and of elements 2 & 3 first, then pick one of each pair. Note that _MM_SHUFFLE() lists lanes from last to first. */
+		const __m128 x0_x0_x1_x1 = _mm_shuffle_ps( x0_y0_z0_x1, x0_y0_z0_x1, _MM_SHUFFLE( 3, 3, 0, 0 ) );
+		const __m128 x2_x2_x3_x3 = _mm_shuffle_ps( y1_z1_x2_y2, z2_x3_y3_z3, _MM_SHUFFLE( 1, 1, 2, 2 ) );
+		const __m128 y0_y0_y1_y1 = _mm_shuffle_ps( x0_y0_z0_x1, y1_z1_x2_y2, _MM_SHUFFLE( 0, 0, 1, 1 ) );
+		const __m128 y2_y2_y3_y3 = _mm_shuffle_ps( y1_z1_x2_y2, z2_x3_y3_z3, _MM_SHUFFLE( 2, 2, 3, 3 ) );
+		const __m128 z0_z0_z1_z1 = _mm_shuffle_ps( x0_y0_z0_x1, y1_z1_x2_y2, _MM_SHUFFLE( 1, 1, 2, 2 ) );
+		const __m128 z2_z2_z3_z3 = _mm_shuffle_ps( z2_x3_y3_z3, z2_x3_y3_z3, _MM_SHUFFLE( 3, 3, 0, 0 ) );
+
+		soa[ 0 ] = _mm_shuffle_ps( x0_x0_x1_x1, x2_x2_x3_x3, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		soa[ 1 ] = _mm_shuffle_ps( y0_y0_y1_y1, y2_y2_y3_y3, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		soa[ 2 ] = _mm_shuffle_ps( z0_z0_z1_z1, z2_z2_z3_z3, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+	}
+
+	/* 4 Quaternions -> xxxx, yyyy, zzzz, wwww. */
+	internal_function void LoadQuaternionx4( const Quaternion* quaternions, __m128 ( &soa )[ 4 ] )
+	{
+		soa[ 0 ] = _mm_loadu_ps( &quaternions[ 0 ].x );
+		soa[ 1 ] = _mm_loadu_ps( &quaternions[ 1 ].x );
+		soa[ 2 ] = _mm_loadu_ps( &quaternions[ 2 ].x );
+		soa[ 3 ] = _mm_loadu_ps( &quaternions[ 3 ].x );
+
+		_MM_TRANSPOSE4_PS( soa[ 0 ], soa[ 1 ], soa[ 2 ], soa[ 3 ] );
+	}
+
+	/* Transposes 4 SoA registers back into 4 vec4s & writes them to output + offset of 4 consecutive elements. */
+	internal_function void StoreTransposedx4( __m128 a, __m128 b, __m128 c, __m128 d, float* output, const std::size_t stride, const std::size_t offset )
+	{
+		_MM_TRANSPOSE4_PS( a, b, c, d );
+
+		_mm_storeu_ps( output + offset,				 a );
+		_mm_storeu_ps( output + offset + stride,	 b );
+		_mm_storeu_ps( output + offset + 2 * stride, c );
+		_mm_storeu_ps( output + offset + 3 * stride, d );
+	}
+
+	internal_function void Storex4( const __m128 ( &scale_rotation )[ 3 ][ 3 ], const __m128 ( &translation )[ 3 ], float* output, const Layout layout )
+	{
+		const std::size_t stride = FloatCountPerElement( layout );
+
+		if( layout == Layout::RowMajor )
+		{
+			const __m128 zero = _mm_setzero_ps();
+
+			for( std::size_t row = 0; row < 3; row++ )
+				StoreTransposedx4( scale_rotation[ row ][ 0 ], scale_rotation[ row ][ 1 ], scale_rotation[ row ][ 2 ], zero, output, stride, row * 4 );
+
+			StoreTransposedx4( translation[ 0 ], translation[ 1 ], translation[ 2 ], _mm_set1_ps( 1.0f ), output, stride, 12 );
+		}
+		else
+		{
+			/* Row i of the transposed matrix is column i of the original: The scaled rotation column, followed by the translation's i-th component. */
+			for( std::size_t column = 0; column < 3; column++ )
+				StoreTransposedx4( scale_rotation[ 0 ][ column ], scale_rotation[ 1 ][ column ], scale_rotation[ 2 ][ column ], translation[ column ], output, stride, column * 4 );
+
+			if( layout == Layout::Transposed )
+			{
+				const __m128 last_row = _mm_setr_ps( 0.0f, 0.0f, 0.0f, 1.0f );
+
+				for( std::size_t element = 0; element < 4; element++ )
+					_mm_storeu_ps( output + element * stride + 12, last_row );
+			}
+		}
+	}
+
+#endif // SIMD_SSE2
+
+	/* Composes elements [ begin, end ) on the calling thread. */
+	internal_function void ComposeRange( const Vector3* scales, const Quaternion* rotations, const Vector3* translations, float* output, const Layout layout,
+										 const std::size_t begin, const std::size_t end )
+	{
+		const std::size_t stride = FloatCountPerElement( layout );
+
+		std::size_t index = begin;
+
+#if defined( SIMD_AVX2 )
+		{
+			const __m256 one = _mm256_set1_ps( 1.0f );
+
+			for( ; index + 8 <= end; index += 8 )
+			{
+				__m128 scale_lo[ 3 ], scale_hi[ 3 ], rotation_lo[ 4 ], rotation_hi[ 4 ];
+				LoadVector3x4( scales + index,			scale_lo );
+				LoadVector3x4( scales + index + 4,		scale_hi );
+				LoadQuaternionx4( rotations + index,	 rotation_lo );
+				LoadQuaternionx4( rotations + index + 4, rotation_hi );
+
+				__m256 scale[ 3 ], rotation[ 4 ], scale_rotation[ 3 ][ 3 ];
+				for( std::size_t i = 0; i < 3; i++ )
+					scale[ i ] = _mm256_set_m128( scale_hi[ i ], scale_lo[ i ] );
+				for( std::size_t i = 0; i < 4; i++ )
+					rotation[ i ] = _mm256_set_m128( rotation_hi[ i ], rotation_lo[ i ] );
+
+				ComposeScaleRotation( scale, rotation, one, scale_rotation );
+
+				__m128 scale_rotation_lo[ 3 ][ 3 ], scale_rotation_hi[ 3 ][ 3 ];
+				for( std::size_t row = 0; row < 3; row++ )
+				{
+					for( std::size_t column = 0; column < 3; column++ )
+					{
+						scale_rotation_lo[ row ][ column ] = _mm256_castps256_ps128( scale_rotation[ row ][ column ] );
+						scale_rotation_hi[ row ][ column ] = _mm256_extractf128_ps( scale_rotation[ row ][ column ], 1 );
+					}
+				}
+
+				__m128 translation_lo[ 3 ], translation_hi[ 3 ];
+				LoadVector3x4( translations + index,	 translation_lo );
+				LoadVector3x4( translations + index + 4, translation_hi );
+
+				Storex4( scale_rotation_lo, translation_lo, output + index * stride,		   layout );
+				Storex4( scale_rotation_hi, translation_hi, output + ( index + 4 ) * stride, layout );
+			}
+		}
+#endif // SIMD_AVX2
+
+#if defined( SIMD_SSE2 )
+		{
+			const __m128 one = _mm_set1_ps( 1.0f );
+
+			for( ; index + 4 <= end; index += 4 )
+			{
+				__m128 scale[ 3 ], rotation[ 4 ], translation[ 3 ], scale_rotation[ 3 ][ 3 ];
+				LoadVector3x4( scales + index,			 scale );
+				LoadQuaternionx4( rotations + index,	 rotation );
+				LoadVector3x4( translations + index,	 translation );
+
+				ComposeScaleRotation( scale, rotation, one, scale_rotation );
+
+				Storex4( scale_rotation, translation, output + index * stride, layout );
+			}
+		}
+#endif // SIMD_SSE2
+
+		for( ; index < end; index++ )
+			ComposeSingle( scales[ index ], rotations[ index ], translations[ index ], output + index * stride, layout );
+	}
+
+	/* Calls compose_chunk( begin, end ) for consecutive chunks of [ 0, count ), on worker threads if requested & worth it. */
+	template< typename ComposeChunk >
+	internal_function void ForEachChunk( const std::size_t count, const Execution execution, ComposeChunk&& compose_chunk )
+	{
+		if( execution == Execution::Serial )
+			compose_chunk( std::size_t( 0 ), count );
+		else
+			ServiceLocator< JobSystem >::Get().ParallelFor( count, PARALLEL_CHUNK_ELEMENT_COUNT, compose_chunk );
+	}
+
+	void Compose( std::span< const Vector3 > scales, std::span< const Quaternion > rotations, std::span< const Vector3 > translations,
+				  float* output, const Layout layout, const Execution execution )
+	{
+		ASSERT_DEBUG_ONLY( scales.size() == rotations.size() && scales.size() == translations.size() && "TransformBatch::Compose(): All spans must have the same size." );
+
+		ForEachChunk( scales.size(), execution, [ & ]( const std::size_t begin, const std::size_t end )
+		{
+			ComposeRange( scales.data(), rotations.data(), translations.data(), output, layout, begin, end );
+		} );
+	}
+
+	void Compose( std::span< const Vector3 > scales, std::span< const Quaternion > rotations, std::span< const Vector3 > translations,
+				  std::span< Matrix4x4 > output, const Layout layout, const Execution execution )
+	{
+		ASSERT_DEBUG_ONLY( layout != Layout::Transposed3x4 && "TransformBatch::Compose(): Matrix4x4 output can not be packed as 3x4." );
+		ASSERT_DEBUG_ONLY( output.size() >= scales.size() && "TransformBatch::Compose(): Output is too small." );
+
+		Compose( scales, rotations, translations, reinterpret_cast< float* >( output.data() ), layout, execution );
+	}
+
+	void Compose( std::span< const Transform > transforms, float* output, const Layout layout, const Execution execution )
+	{
+		const std::size_t stride = FloatCountPerElement( layout );
+
+		ForEachChunk( transforms.size(), execution, [ & ]( const std::size_t chunk_begin, const std::size_t chunk_end )
+		{
+			Vector3		scale_array[ GATHER_BLOCK_ELEMENT_COUNT ];
+			Quaternion	rotation_array[ GATHER_BLOCK_ELEMENT_COUNT ];
+			Vector3		translation_array[ GATHER_BLOCK_ELEMENT_COUNT ];
+
+			for( std::size_t block_begin = chunk_begin; block_begin < chunk_end; block_begin += GATHER_BLOCK_ELEMENT_COUNT )
+			{
+				const std::size_t block_count = std::min( GATHER_BLOCK_ELEMENT_COUNT, chunk_end - block_begin );
+
+				for( std::size_t i = 0; i < block_count; i++ )
+				{
+					const Transform& transform = transforms[ block_begin + i ];
+
+					scale_array[ i ]	   = transform.GetScaling();
+					rotation_array[ i ]	   = transform.GetRotation();
+					translation_array[ i ] = transform.GetTranslation();
+				}
+
+				ComposeRange( scale_array, rotation_array, translation_array, output + block_begin * stride, layout, 0, block_count );
+			}
+		} );
+	}
+
+	void Compose( std::span< const Transform > transforms, std::span< Matrix4x4 > output, const Layout layout, const Execution execution )
+	{
+		ASSERT_DEBUG_ONLY( layout != Layout::Transposed3x4 && "TransformBatch::Compose(): Matrix4x4 output can not be packed as 3x4." );
+		ASSERT_DEBUG_ONLY( output.size() >= transforms.size() && "TransformBatch::Compose(): Output is too small." );
+
+		Compose( transforms, reinterpret_cast< float* >( output.data() ), layout, execution );
+	}
+}
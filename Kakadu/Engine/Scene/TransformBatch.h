@@ -0,0 +1,45 @@
+#pragma once
+
+// Engine Includes.
+#include "Transform.h"
+
+// std Includes.
+#include <span>
+
+namespace Kakadu::TransformBatch
+{
+	enum class Layout : u8
+	{
+		/* As returned by Matrix::SRT(); 16 floats per element. */
+		RowMajor,
+		/* As returned by Matrix::SRT().Transposed(), e.g., for mat4 vertex attributes (whose major can not be flipped in GLSL); 16 floats per element. */
+		Transposed,
+		/* The first 3 rows of Transposed (the last one is always ( 0, 0, 0, 1 )), e.g., for 3 vec4 vertex attributes; 12 floats per element. */
+		Transposed3x4
+	};
+
+	enum class Execution : u8
+	{
+		Serial,
+		/* Splits the elements across the JobSystem's workers, if there are enough of them to be worth it. */
+		Parallel
+	};
+
+	constexpr std::size_t FloatCountPerElement( const Layout layout ) { return layout == Layout::Transposed3x4 ? 12 : 16; }
+
+	/* Writes the Scale * Rotate * Translate matrix of each element to output, which may as well be a mapped (instance) buffer.
+	 * Elements are processed several at a time (8 with AVX2, 4 with SSE2) in SoA form.
+	 * All spans must have the same size. Rotations must be normalized. Output must hold FloatCountPerElement( layout ) floats per element. */
+	void Compose( std::span< const Vector3 > scales, std::span< const Quaternion > rotations, std::span< const Vector3 > translations,
+				  float* output, const Layout layout = Layout::RowMajor, const Execution execution = Execution::Serial );
+
+	/* Layout must not be Transposed3x4. */
+	void Compose( std::span< const Vector3 > scales, std::span< const Quaternion > rotations, std::span< const Vector3 > translations,
+				  std::span< Matrix4x4 > output, const Layout layout = Layout::RowMajor, const Execution execution = Execution::Serial );
+
+	/* Gathers scaling, rotation & translation from the Transforms; Their cached matrices are neither used nor updated. */
+	void Compose( std::span< const Transform > transforms, float* output, const Layout layout = Layout::RowMajor, const Execution execution = Execution::Serial );
+
+	/* Layout must not be Transposed3x4. */
+	void Compose( std::span< const Transform > transforms, std::span< Matrix4x4 > output, const Layout layout = Layout::RowMajor, const Execution execution = Execution::Serial );
+}
@@ -0,0 +1,162 @@
+// Engine Includes.
+#include "TransformHierarchy.h"
+#include "Math/Matrix.h"
+#include "Transform.h"
+#include "Core/Assertion.h"
+
+// std Includes.
+#include <algorithm>
+
+namespace Kakadu
+{
+	TransformHierarchy::TransformHierarchy()
+		:
+		first_dirty_node_index( 0 )
+	{
+	}
+
+	TransformHierarchy::~TransformHierarchy()
+	{
+	}
+
+	void TransformHierarchy::Reserve( const std::size_t node_count )
+	{
+		parent_index_array.reserve( node_count );
+		scale_array.reserve( node_count );
+		rotation_array.reserve( node_count );
+		translation_array.reserve( node_count );
+		world_matrix_array.reserve( node_count );
+		version_array.reserve( node_count );
+		is_dirty_array.reserve( node_count );
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		parent_index_array.clear();
+		scale_array.clear();
+		rotation_array.clear();
+		translation_array.clear();
+		world_matrix_array.clear();
+		version_array.clear();
+		is_dirty_array.clear();
+
+		first_dirty_node_index = 0;
+	}
+
+	TransformHierarchy::NodeIndex TransformHierarchy::Add( const NodeIndex parent_index, const Vector3& scale, const Quaternion& rotation, const Vector3& translation )
+	{
+		ASSERT_DEBUG_ONLY( ( parent_index == NO_PARENT || parent_index < NodeCount() ) && "TransformHierarchy::Add(): Parents must be added before their children." );
+
+		const NodeIndex node_index = ( NodeIndex )NodeCount();
+
+		parent_index_array.push_back( parent_index );
+		scale_array.push_back( scale );
+		rotation_array.push_back( rotation );
+		translation_array.push_back( translation );
+		world_matrix_array.emplace_back();
+		version_array.push_back( 0 ); // Assigned a fresh version by the first update.
+		is_dirty_array.push_back( 0 );
+
+		/* If nothing was dirty, first_dirty_node_index was equal to the old node count, i.e., this node's index. */
+		SetDirty( node_index );
+
+		return node_index;
+	}
+
+	TransformHierarchy::NodeIndex TransformHierarchy::Add( const NodeIndex parent_index, const Matrix4x4& local_srt_matrix )
+	{
+		Vector3 scale, translation;
+		Quaternion rotation;
+		Matrix::DecomposeSRT( local_srt_matrix, scale, rotation, translation );
+
+		return Add( parent_index, scale, rotation, translation );
+	}
+
+	void TransformHierarchy::SetScaling( const NodeIndex node_index, const Vector3& new_scale )
+	{
+		scale_array[ node_index ] = new_scale;
+		SetDirty( node_index );
+	}
+
+	void TransformHierarchy::SetRotation( const NodeIndex node_index, const Quaternion& new_rotation )
+	{
+		ASSERT_DEBUG_ONLY( new_rotation.IsNormalized() && R"(TransformHierarchy::SetRotation(): The quaternion "new_rotation" is not normalized!)" );
+
+		rotation_array[ node_index ] = new_rotation;
+		SetDirty( node_index );
+	}
+
+	void TransformHierarchy::SetTranslation( const NodeIndex node_index, const Vector3& new_translation )
+	{
+		translation_array[ node_index ] = new_translation;
+		SetDirty( node_index );
+	}
+
+	void TransformHierarchy::SetLocal( const NodeIndex node_index, const Vector3& new_scale, const Quaternion& new_rotation, const Vector3& new_translation )
+	{
+		scale_array[ node_index ]       = new_scale;
+		rotation_array[ node_index ]    = new_rotation;
+		translation_array[ node_index ] = new_translation;
+		SetDirty( node_index );
+	}
+
+	void TransformHierarchy::SetLocal( const NodeIndex node_index, const Matrix4x4& local_srt_matrix )
+	{
+		Matrix::DecomposeSRT( local_srt_matrix, scale_array[ node_index ], rotation_array[ node_index ], translation_array[ node_index ] );
+		SetDirty( node_index );
+	}
+
+	void TransformHierarchy::UpdateWorldMatrices()
+	{
+		if( not IsDirty() )
+			return;
+
+		const std::size_t node_count = NodeCount();
+
+		Matrix4x4 local_matrix;
+
+		/* Parents precede their children, so a parent's flag (& world matrix) is final by the time its children are visited. */
+		for( std::size_t node_index = first_dirty_node_index; node_index < node_count; node_index++ )
+		{
+			const NodeIndex parent_index = parent_index_array[ node_index ];
+
+			if( parent_index != NO_PARENT && is_dirty_array[ parent_index ] )
+				is_dirty_array[ node_index ] = 1;
+
+			if( not is_dirty_array[ node_index ] )
+				continue;
+
+			Matrix::SRT( local_matrix, scale_array[ node_index ], rotation_array[ node_index ], translation_array[ node_index ] );
+
+			world_matrix_array[ node_index ] = parent_index == NO_PARENT
+												? local_matrix
+												: local_matrix * world_matrix_array[ parent_index ];
+
+			version_array[ node_index ] = Transform::NextVersion();
+		}
+
+		std::fill( is_dirty_array.begin() + first_dirty_node_index, is_dirty_array.end(), u8( 0 ) );
+
+		first_dirty_node_index = node_count;
+	}
+
+	const Matrix4x4& TransformHierarchy::WorldMatrix( const NodeIndex node_index )
+	{
+		UpdateWorldMatrices();
+
+		return world_matrix_array[ node_index ];
+	}
+
+	TransformHierarchy::Version TransformHierarchy::WorldMatrixVersion( const NodeIndex node_index )
+	{
+		UpdateWorldMatrices();
+
+		return version_array[ node_index ];
+	}
+
+	void TransformHierarchy::SetDirty( const NodeIndex node_index )
+	{
+		is_dirty_array[ node_index ] = 1;
+		first_dirty_node_index       = std::min( first_dirty_node_index, std::size_t( node_index ) );
+	}
+}
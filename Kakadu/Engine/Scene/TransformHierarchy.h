@@ -0,0 +1,92 @@
+#pragma once
+
+// Engine Includes.
+#include "Math/Matrix.hpp"
+#include "Math/Quaternion.hpp"
+#include "Math/Vector.hpp"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+// std Includes.
+#include <vector>
+
+namespace Kakadu
+{
+	/* A forest of transform nodes, stored as parallel (SoA) arrays in topological order: A node is always added after its parent, so parents precede their children.
+	 * Modifying a node only marks it dirty; UpdateWorldMatrices() then recomputes the world matrices of dirty nodes & their descendants in a single linear pass,
+	 * starting from the first dirty node. Nodes whose world matrix did not change are only visited for a flag check.
+	 * Each node carries a version (drawn from the same global counter as Transform versions), renewed whenever its world matrix changes, so that observers can skip unchanged matrices.
+	 * World matrices are composed as full matrices, so they may contain shear (e.g., rotated children of non-uniformly scaled parents). */
+	class TransformHierarchy
+	{
+	public:
+		using NodeIndex = u32;
+		using Version   = u32;
+
+		static constexpr NodeIndex NO_PARENT = ~NodeIndex( 0 );
+
+	public:
+		TransformHierarchy();
+
+		DELETE_COPY_CONSTRUCTORS( TransformHierarchy );
+		DEFAULT_MOVE_CONSTRUCTORS( TransformHierarchy );
+
+		~TransformHierarchy();
+
+	/* Construction: */
+
+		void Reserve( const std::size_t node_count );
+		void Clear();
+
+		/* The parent must already exist (or be NO_PARENT). */
+		NodeIndex Add( const NodeIndex parent_index, const Vector3& scale, const Quaternion& rotation, const Vector3& translation );
+		/* SRT = Scale * Rotate * Translate. The matrix is decomposed & must not contain shear. */
+		NodeIndex Add( const NodeIndex parent_index, const Matrix4x4& local_srt_matrix );
+
+	/* Modification (all in the node's local space, i.e., relative to its parent): */
+
+		void SetScaling( const NodeIndex node_index, const Vector3& new_scale );
+		void SetRotation( const NodeIndex node_index, const Quaternion& new_rotation );
+		void SetTranslation( const NodeIndex node_index, const Vector3& new_translation );
+		void SetLocal( const NodeIndex node_index, const Vector3& new_scale, const Quaternion& new_rotation, const Vector3& new_translation );
+		/* SRT = Scale * Rotate * Translate. The matrix is decomposed & must not contain shear. */
+		void SetLocal( const NodeIndex node_index, const Matrix4x4& local_srt_matrix );
+
+		/* Does nothing if no node is dirty. */
+		void UpdateWorldMatrices();
+
+	/* Queries: */
+
+		std::size_t NodeCount()	const { return parent_index_array.size(); }
+		bool IsDirty()			const { return first_dirty_node_index < NodeCount(); }
+
+		NodeIndex ParentIndex( const NodeIndex node_index ) const { return parent_index_array[ node_index ]; }
+
+		const Vector3&		GetScaling( const NodeIndex node_index )		const { return scale_array[ node_index ]; }
+		const Quaternion&	GetRotation( const NodeIndex node_index )		const { return rotation_array[ node_index ]; }
+		const Vector3&		GetTranslation( const NodeIndex node_index )	const { return translation_array[ node_index ]; }
+
+		/* Updates dirty nodes first, if there are any. */
+		const Matrix4x4& WorldMatrix( const NodeIndex node_index );
+		/* Updates dirty nodes first, if there are any. Starts at 1, so 0 can be used as "never seen". */
+		Version WorldMatrixVersion( const NodeIndex node_index );
+
+	private:
+		void SetDirty( const NodeIndex node_index );
+
+	private:
+		std::vector< NodeIndex > parent_index_array;
+
+		std::vector< Vector3	> scale_array;
+		std::vector< Quaternion	> rotation_array;
+		std::vector< Vector3	> translation_array;
+
+		std::vector< Matrix4x4	> world_matrix_array;
+		std::vector< Version	> version_array;
+
+		/* Set for modified nodes; During UpdateWorldMatrices(), also for their descendants. Cleared by UpdateWorldMatrices(). */
+		std::vector< u8 > is_dirty_array;
+		/* == NodeCount() if there are no dirty nodes. */
+		std::size_t first_dirty_node_index;
+	};
+}